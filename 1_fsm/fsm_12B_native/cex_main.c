@@ -0,0 +1,197 @@
+/*
+ * File: cex_main.c
+ *
+ * Reads the output of an ESBMC run on an fsm_12B harness, replays its
+ * counterexample against the native fsm_12B_step and writes a regression
+ * test for it.
+ *
+ *   cex [-o test.c] [-q] [log]
+ *
+ * The log is read from stdin when not given, so the verifier can be piped
+ * in directly.  The test goes to test.c (default cex_test.c) and builds
+ * with fsm_12B_req.c and fsm_12B.c.  -q prints only the verdict.
+ *
+ * Exit status: 0 violation confirmed, 1 the replay diverges from the trace
+ * or the requirement holds natively, 2 usage or setup error, 3 no
+ * counterexample or no native check for the violated property.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "fsm_12B_cex.h"
+#include "fsm_12B_req.h"
+#include "rtwtypes.h"
+
+typedef struct {
+  fsm_12B_CexReplay replay;
+  fsm_12B_CexTest test;
+  const char_T *path;
+  const char_T *source;
+  FILE *out;                           /* opened at the first event */
+  boolean_T failed;
+  real_T seconds;                      /* in the native model */
+} Sinks;
+
+static Sinks sinks;
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: cex [-o test.c] [-q] [log]\n");
+}
+
+static real_T now(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (real_T)ts.tv_sec + 1.0e-9 * (real_T)ts.tv_nsec;
+}
+
+static void both(void *arg, const fsm_12B_CexEvent *ev)
+{
+  Sinks *s = (Sinks *)arg;
+  if (ev->kind == FSM_12B_CEX_CALL) {
+    const real_T t0 = now();
+    fsm_12B_cex_replay(&s->replay, ev);
+    s->seconds += now() - t0;
+  } else {
+    fsm_12B_cex_replay(&s->replay, ev);
+  }
+
+  if ((s->out == NULL) && !s->failed) {
+    const char_T *name = strrchr(s->path, '/');
+    s->out = fopen(s->path, "w");
+    s->failed = (s->out == NULL);
+    if (!s->failed) {
+      fsm_12B_cex_test_begin(&s->test, s->out, (name != NULL) ? name + 1 :
+        s->path, s->source);
+    }
+  }
+
+  if (s->out != NULL) {
+    fsm_12B_cex_test(&s->test, ev);
+  }
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  static fsm_12B_CexParser p;
+  static char_T line[FSM_12B_CEX_LINE];
+  const char_T *log = NULL;
+  boolean_T quiet = false;
+  FILE *in;
+  int_T req;
+  int_T i;
+  sinks.path = "cex_test.c";
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (opt[0] != '-') {
+      if (log != NULL) {
+        usage();
+        return 2;
+      }
+
+      log = opt;
+      continue;
+    }
+
+    if (strcmp(opt, "-q") == 0) {
+      quiet = true;
+      continue;
+    }
+
+    if (strcmp(opt, "-o") == 0) {
+      sinks.path = val;
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  in = (log != NULL) ? fopen(log, "r") : stdin;
+  if (in == NULL) {
+    fprintf(stderr, "cex: cannot read %s\n", log);
+    return 2;
+  }
+
+  sinks.source = (log != NULL) ? log : "stdin";
+  fsm_12B_cex_init(&p);
+  fsm_12B_cex_replay_init(&sinks.replay);
+  while (fgets(line, sizeof(line), in) != NULL) {
+    const size_t n = strlen(line);
+    fsm_12B_cex_line(&p, line, both, &sinks);
+
+    /* The rest of an overlong line, a huge array value, is dropped */
+    if ((n > 0U) && (line[n - 1U] != '\n')) {
+      int c;
+      do {
+        c = fgetc(in);
+      } while ((c != EOF) && (c != '\n'));
+    }
+  }
+
+  fsm_12B_cex_end(&p, both, &sinks);
+  if (in != stdin) {
+    (void)fclose(in);
+  }
+
+  if (sinks.out != NULL) {
+    fsm_12B_cex_test_end(&sinks.test, &p);
+    sinks.failed = (fclose(sinks.out) != 0) || sinks.failed;
+  }
+
+  if (sinks.failed) {
+    fprintf(stderr, "cex: cannot write %s\n", sinks.path);
+    return 2;
+  }
+
+  if (p.message[0] == '\0') {
+    printf("no counterexample in %s\n", sinks.source);
+    return 3;
+  }
+
+  req = fsm_12B_cex_requirement(p.message);
+  if (!quiet) {
+    printf("trace:    %d states, %d assignments, %d initialize, %d steps\n",
+           p.states, p.assignments, p.calls[0], p.calls[1]);
+    printf("property: %s\n          %s line %d: %s\n", p.message, p.file,
+           p.property_line, p.condition);
+    printf("replay:   %d steps, %.1f us in the model, ", sinks.replay.steps,
+           1.0e6 * sinks.seconds);
+    if (sinks.replay.mismatches == 0) {
+      printf("model assignments match the trace\n");
+    } else {
+      printf("%d mismatches, first %s\n", sinks.replay.mismatches,
+             sinks.replay.mismatch);
+    }
+
+    printf("test:     %s\n", sinks.path);
+  }
+
+  if (req < 0) {
+    printf("UNCHECKED: no native check for \"%s\"\n", p.message);
+    return 3;
+  }
+
+  if ((sinks.replay.mismatches != 0) || !fsm_12B_cex_violated(&sinks.replay,
+       req)) {
+    printf("NOT CONFIRMED: requirement %d %s\n", fsm_12B_requirements[req].id,
+           (sinks.replay.mismatches != 0) ? "replay diverges from the trace" :
+           "holds on the native replay");
+    return 1;
+  }
+
+  printf("CONFIRMED: requirement %d fails on step %d of the native replay\n",
+         fsm_12B_requirements[req].id, sinks.replay.steps);
+  return 0;
+}
+
+/*
+ * File trailer for cex_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,162 @@
+/*
+ * File: domain_main.c
+ *
+ * Prints the value domains of the real_T fields of DW and rewrites a
+ * harness to assume them.
+ *
+ *   domain [-d explore|model] [-m fsm_12B.c] [-i] [-o output] [harness]
+ *
+ * -d explore (the default) takes the values of the states reachable from
+ * fsm_12B_initialize; -d model takes the constants assigned in the model
+ * source, by default fsm_12B.c next to the harness.  With a harness,
+ * every "rtDW.<field> = nondet_double();" in it is replaced by a draw from
+ * the domain, and the result goes to output (stdout by default).  -i
+ * draws integer-valued domains as unsigned char.
+ *
+ * Exit status: 0 done, 2 usage or setup error.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_domain.h"
+#include "fsm_12B_util.h"
+#include "rtwtypes.h"
+
+#define MAX_PATH                       4096
+
+static fsm_12B_Domain domain;
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: domain [-d explore|model] [-m fsm_12B.c] [-i] "
+          "[-o output] [harness]\n");
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  const char_T *source = "explore";
+  const char_T *model = NULL;
+  const char_T *output = NULL;
+  const char_T *harness = NULL;
+  boolean_T integer = false;
+  char_T model_default[MAX_PATH + 16];
+  int_T i;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (opt[0] != '-') {
+      if (harness != NULL) {
+        usage();
+        return 2;
+      }
+
+      harness = opt;
+      continue;
+    }
+
+    if (strcmp(opt, "-i") == 0) {
+      integer = true;
+      continue;
+    }
+
+    if (strcmp(opt, "-d") == 0) {
+      source = val;
+    } else if (strcmp(opt, "-m") == 0) {
+      model = val;
+    } else if (strcmp(opt, "-o") == 0) {
+      output = val;
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if (strcmp(source, "explore") == 0) {
+    if (fsm_12B_domain_explore(&domain) != 0) {
+      fprintf(stderr, "domain: state space exceeds the explorer\n");
+      return 2;
+    }
+  } else if (strcmp(source, "model") == 0) {
+    char_T *text;
+    size_t len;
+    if (model == NULL) {
+      const char_T *slash = (harness != NULL) ? strrchr(harness, '/') : NULL;
+      (void)snprintf(model_default, sizeof(model_default), "%.*sfsm_12B.c",
+                     (slash != NULL) ? (int)(slash - harness + 1) : 0, (harness
+        != NULL) ? harness : "");
+      model = model_default;
+    }
+
+    text = fsm_12B_slurp(model, &len);
+    if (text == NULL) {
+      fprintf(stderr, "domain: cannot read %s\n", model);
+      return 2;
+    }
+
+    fsm_12B_domain_model(&domain, text, len);
+    free(text);
+  } else {
+    usage();
+    return 2;
+  }
+
+  domain.integer = integer;
+  for (i = 0; i < FSM_12B_DOMAIN_FIELDS; i++) {
+    const fsm_12B_DomainField *f = &domain.f[i];
+    FILE *fp = ((harness != NULL) && (output == NULL)) ? stderr : stdout;
+    int_T j;
+    fprintf(fp, "rtDW.%-18s", f->field);
+    if (!f->bounded) {
+      fprintf(fp, " any double\n");
+      continue;
+    }
+
+    for (j = 0; j < f->n; j++) {
+      fprintf(fp, "%s%g", (j == 0) ? " { " : ", ", f->value[j]);
+    }
+
+    fprintf(fp, " }\n");
+  }
+
+  if (harness != NULL) {
+    FILE *fp = (output != NULL) ? fopen(output, "wb") : stdout;
+    char_T *text;
+    char_T *out;
+    size_t len;
+    size_t outlen;
+    int_T count;
+    text = fsm_12B_slurp(harness, &len);
+    if (text == NULL) {
+      fprintf(stderr, "domain: cannot read %s\n", harness);
+      return 2;
+    }
+
+    out = fsm_12B_domain_inject(&domain, text, len, &outlen, &count);
+    if ((out == NULL) || (fp == NULL) || (fwrite(out, 1, outlen, fp) != outlen))
+    {
+      fprintf(stderr, "domain: cannot write %s\n", (output != NULL) ? output :
+              "stdout");
+      return 2;
+    }
+
+    if (fp != stdout) {
+      (void)fclose(fp);
+    }
+
+    fprintf(stderr, "domain: %d nondet_double() state assignments replaced in "
+            "%s\n", count, harness);
+    free(out);
+    free(text);
+  }
+
+  return 0;
+}
+
+/*
+ * File trailer for domain_main.c
+ *
+ * [EOF]
+ */
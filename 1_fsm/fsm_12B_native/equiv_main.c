@@ -0,0 +1,149 @@
+/*
+ * File: equiv_main.c
+ *
+ * Checks that the three generated copies of fsm_12B behave the same
+ * (fsm_12B_equiv.h): first from every reachable state under every input,
+ * then along every input sequence of up to k ticks from initialize.  Meant
+ * to be run after every regeneration of the model.
+ *
+ *   equiv [-k length] [-j threads]
+ *
+ * k defaults to 6, 16^6 sequences; threads to one per online core.
+ *
+ * Exit status: 0 equivalent, 1 divergence, 2 usage or setup error.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_equiv.h"
+#include "fsm_12B_req.h"
+#include "fsm_12B_util.h"
+#include "rtwtypes.h"
+
+static fsm_12B_Explorer ex;
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: equiv [-k length] [-j threads]\n");
+}
+
+static void print_field(const char_T *name, real_T expected, real_T actual)
+{
+  printf("    %-18s %9g %9g%s\n", name, expected, actual, (memcmp(&expected,
+           &actual, sizeof(real_T)) != 0) ? "  <--" : "");
+}
+
+static void print_divergence(const fsm_12B_EquivResult *res)
+{
+  const DW *e = &res->expected;
+  const DW *a = &res->actual;
+  int_T t;
+  printf("DIVERGENCE: %s differs from %s in %s ", fsm_12B_equiv_variants
+         [res->variant].name, fsm_12B_equiv_variants[0].name, res->output ?
+         "the output" : "DW");
+  if (res->length == 0) {
+    printf("after fsm_12B_initialize\n");
+  } else {
+    printf("after %d ticks\n", res->length);
+    printf("    tick  standby apfail supported limits\n");
+    for (t = 0; t < res->length; t++) {
+      const uint8_T k = res->trace[t];
+      printf("    %4d  %7d %6d %9d %6d\n", t, FSM_12B_IN_STANDBY(k),
+             FSM_12B_IN_APFAIL(k), FSM_12B_IN_SUPPORTED(k),
+             FSM_12B_IN_LIMITS(k));
+    }
+  }
+
+  printf("    %-18s %9s %9s\n", "", "expected", "actual");
+  print_field("Merge", e->Merge, a->Merge);
+  print_field("Merge_g", e->Merge_g, a->Merge_g);
+  print_field("UnitDelay_DSTATE", e->UnitDelay_DSTATE, a->UnitDelay_DSTATE);
+  print_field("UnitDelay1_DSTATE", e->UnitDelay1_DSTATE, a->UnitDelay1_DSTATE);
+  print_field("Merge_p[0]", (real_T)e->Merge_p[0], (real_T)a->Merge_p[0]);
+  print_field("Merge_p[1]", (real_T)e->Merge_p[1], (real_T)a->Merge_p[1]);
+  print_field("Merge_p[2]", (real_T)e->Merge_p[2], (real_T)a->Merge_p[2]);
+  print_field("UnitDelay2_DSTATE", (real_T)e->UnitDelay2_DSTATE, (real_T)
+              a->UnitDelay2_DSTATE);
+  if (res->output) {
+    print_field("rtY_pullup", (real_T)res->expected_pullup, (real_T)
+                res->actual_pullup);
+  }
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  fsm_12B_EquivResult res;
+  int_T k = 6;
+  int_T threads = 0;
+  real_T t0;
+  real_T t1;
+  real_T t2;
+  int_T i;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (strcmp(opt, "-k") == 0) {
+      k = atoi(val);
+    } else if (strcmp(opt, "-j") == 0) {
+      threads = atoi(val);
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if ((k < 1) || (k > FSM_12B_EQUIV_MAX_LENGTH)) {
+    fprintf(stderr, "equiv: length must be 1 to %d\n",
+            FSM_12B_EQUIV_MAX_LENGTH);
+    return 2;
+  }
+
+  printf("variants: ");
+  for (i = 0; i < FSM_12B_EQUIV_VARIANTS; i++) {
+    printf("%s%s%s", (i > 0) ? ", " : "", fsm_12B_equiv_variants[i].name,
+           fsm_12B_equiv_variants[i].has_output ? "" : " (no output)");
+  }
+
+  printf("\n");
+  t0 = fsm_12B_now_sec();
+  if (fsm_12B_equiv_states(&ex, &res) != 0) {
+    fprintf(stderr, "equiv: the state space does not fit the explorer\n");
+    return 2;
+  }
+
+  t1 = fsm_12B_now_sec();
+  if (res.diverged) {
+    print_divergence(&res);
+    return 1;
+  }
+
+  printf("states:    %d reachable, %lu (state, input) pairs, %lu steps, "
+         "%.3f ms\n", ex.count, (unsigned long)ex.count * FSM_12B_NUM_INPUTS,
+         (unsigned long)res.steps, 1.0e3 * (t1 - t0));
+  threads = fsm_12B_equiv_sequences(k, threads, &res);
+  t2 = fsm_12B_now_sec();
+  if (threads < 0) {
+    fprintf(stderr, "equiv: cannot run the sequences\n");
+    return 2;
+  }
+
+  if (res.diverged) {
+    print_divergence(&res);
+    return 1;
+  }
+
+  printf("sequences: all up to %d ticks, %lu steps on %d threads, %.3f s\n", k,
+         (unsigned long)res.steps, threads, t2 - t1);
+  printf("EQUIVALENT\n");
+  return 0;
+}
+
+/*
+ * File trailer for equiv_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,209 @@
+/*
+ * File: explore_main.c
+ *
+ * Command line front end of the fsm_12B explicit-state explorer.  Checks
+ * the 13 requirements of 1_fsm/fsm_12B_ert_rtw/ert_main.c over every state
+ * reachable from fsm_12B_initialize and prints a shortest counterexample
+ * for each violated one.  Meant as a pre-filter in front of ESBMC.
+ *
+ *   explore [requirement ...]
+ *   explore -c
+ *
+ * -c instead checks that every reachable state, and bit patterns such as
+ * -0.0 and NaN that none of them holds, come back bit for bit from a
+ * checkpoint (fsm_12B_ckpt.h), and that identical states share a slot.
+ *
+ * Exit status: 0 no violation, 1 at least one violation (-c: a state that
+ * does not round-trip), 2 capacity exceeded.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fsm_12B_ckpt.h"
+#include "fsm_12B_explore.h"
+#include "fsm_12B_state.h"
+
+/* Extra bit patterns for the checkpoint check */
+#define EXTRA_STATES                   3
+
+static fsm_12B_Explorer ex;
+static fsm_12B_ExploreResult results[FSM_12B_NUM_REQUIREMENTS];
+static fsm_12B_CheckpointPool pool;
+
+static const char_T *verdict_name(fsm_12B_Verdict v)
+{
+  switch (v) {
+   case FSM_12B_VERDICT_HOLDS:
+    return "HOLDS";
+
+   case FSM_12B_VERDICT_VIOLATED:
+    return "VIOLATED";
+
+   default:
+    return "VACUOUS";
+  }
+}
+
+static void print_trace(const fsm_12B_ExploreResult *res)
+{
+  int_T t;
+  printf("    tick  standby apfail supported limits\n");
+  for (t = 0; t < res->length; t++) {
+    const uint8_T k = res->trace[t];
+    printf("    %4d  %7d %6d %9d %6d\n", t, FSM_12B_IN_STANDBY(k),
+           FSM_12B_IN_APFAIL(k), FSM_12B_IN_SUPPORTED(k), FSM_12B_IN_LIMITS(k));
+  }
+}
+
+/* Restore c into a scrambled DW and compare it with rtDW */
+static boolean_T round_trips(fsm_12B_Checkpoint c, const DW *rtDW)
+{
+  RT_MODEL rtM;
+  DW out;
+  memset(&out, 0xA5, sizeof(DW));
+  rtM.dwork = &out;
+  fsm_12B_ckpt_restore(&pool, c, &rtM);
+  return fsm_12B_dw_equal(&out, rtDW) && (fsm_12B_ckpt_hash(&pool, c) ==
+    fsm_12B_dw_hash(rtDW));
+}
+
+/* Snapshot and restore every state twice; returns the number of failures */
+static int_T check_checkpoints(void)
+{
+  static fsm_12B_Checkpoint c[FSM_12B_EXPLORE_MAX_STATES + EXTRA_STATES];
+  static DW state[FSM_12B_EXPLORE_MAX_STATES + EXTRA_STATES];
+  const int_T n = ex.count + EXTRA_STATES;
+  const real_T nan = strtod("nan", NULL);
+  int_T bad = 0;
+  int_T i;
+  for (i = 0; i < ex.count; i++) {
+    state[i] = ex.state[i];
+  }
+
+  state[ex.count] = ex.state[0];
+  state[ex.count].Merge = -0.0;
+  state[ex.count + 1] = ex.state[0];
+  state[ex.count + 1].Merge_g = nan;
+  state[ex.count + 2] = ex.state[0];
+  state[ex.count + 2].UnitDelay1_DSTATE = -nan;
+  fsm_12B_ckpt_init(&pool);
+  for (i = 0; i < n; i++) {
+    RT_MODEL rtM;
+    rtM.dwork = &state[i];
+    c[i] = fsm_12B_ckpt_snapshot(&pool, &rtM);
+    if ((c[i] < 0) || !round_trips(c[i], &state[i])) {
+      printf("checkpoint of state %d does not round-trip\n", i);
+      return 1;
+    }
+  }
+
+  /* Every state is distinct, so a second snapshot shares the first slot */
+  for (i = 0; i < n; i++) {
+    RT_MODEL rtM;
+    rtM.dwork = &state[i];
+    if ((fsm_12B_ckpt_snapshot(&pool, &rtM) != c[i]) || !round_trips(c[i],
+         &state[i])) {
+      printf("second checkpoint of state %d is not shared\n", i);
+      bad++;
+    }
+  }
+
+  if (pool.live != (uint32_T)n) {
+    printf("%u live slots for %d distinct states\n", pool.live, n);
+    bad++;
+  }
+
+  /* Releasing half of the references keeps the states intact */
+  for (i = 0; i < n; i++) {
+    fsm_12B_ckpt_release(&pool, c[i]);
+  }
+
+  for (i = 0; i < n; i++) {
+    if (!round_trips(c[i], &state[i])) {
+      printf("checkpoint of state %d changed on release\n", i);
+      bad++;
+    }
+
+    fsm_12B_ckpt_release(&pool, c[i]);
+  }
+
+  if (pool.live != 0U) {
+    printf("%u live slots after the last release\n", pool.live);
+    bad++;
+  }
+
+  printf("checkpoints: %d reachable states and %d bit patterns, %lu "
+         "snapshots, %lu shared, %s\n", ex.count, EXTRA_STATES, (unsigned long)
+         pool.snapshots, (unsigned long)pool.shared, (bad == 0) ? "exact" :
+         "MISMATCH");
+  return bad;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  boolean_T selected[FSM_12B_NUM_REQUIREMENTS];
+  boolean_T check = false;
+  int_T violated = 0;
+  clock_t t0;
+  clock_t t1;
+  int_T r;
+  int_T i;
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    selected[r] = (argc < 2);
+  }
+
+  for (i = 1; i < argc; i++) {
+    const int_T id = atoi(argv[i]);
+    if (strcmp(argv[i], "-c") == 0) {
+      check = true;
+      continue;
+    }
+
+    if ((id < 1) || (id > FSM_12B_NUM_REQUIREMENTS)) {
+      fprintf(stderr, "explore: no requirement %s\n", argv[i]);
+      return 2;
+    }
+
+    selected[id - 1] = true;
+  }
+
+  t0 = clock();
+  if (fsm_12B_explore(&ex, results) != 0) {
+    fprintf(stderr, "explore: state space exceeds %d states or a trace exceeds "
+            "%d ticks\n", FSM_12B_EXPLORE_MAX_STATES, FSM_12B_EXPLORE_MAX_TRACE);
+    return 2;
+  }
+
+  t1 = clock();
+  printf("fsm_12B: %d reachable states, depth %d, %u transitions, %.3f ms\n",
+         ex.count, ex.max_depth, ex.transitions, 1000.0 * (double)(t1 - t0) /
+         CLOCKS_PER_SEC);
+  if (check) {
+    return (check_checkpoints() != 0) ? 1 : 0;
+  }
+
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    const fsm_12B_ExploreResult *res = &results[r];
+    if (!selected[r]) {
+      continue;
+    }
+
+    printf("Requirement %2d: %-8s (%u reached)  %s\n",
+           fsm_12B_requirements[r].id, verdict_name(res->verdict), res->reached,
+           fsm_12B_requirements[r].text);
+    if (res->verdict == FSM_12B_VERDICT_VIOLATED) {
+      print_trace(res);
+      violated++;
+    }
+  }
+
+  return (violated > 0) ? 1 : 0;
+}
+
+/*
+ * File trailer for explore_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,121 @@
+# File: fsm_12B.spec
+#
+# The requirements of ert_main.c as a requirement file for spec
+# (fsm_12B_spec.h).  mode is the autopilot state of the Merge chart, 0
+# TRANSITION, 1 NOMINAL, 2 MANEUVER, 3 STANDBY; sensor is the sensor state
+# of Merge_g, 0 TRANSITION, 1 NOMINAL, 2 FAULT.  The expected verdicts are
+# those of explore over the reachable states.
+
+signal standby = rtU_standby
+signal apfail = rtU_apfail
+signal supported = rtU_supported
+signal limits = rtU_limits
+signal overrun = OverrunFlag
+signal pullup = rtY_pullup
+signal mode = rtDW.Merge
+signal sensor = rtDW.Merge_g
+
+requirement 1
+  text "Exceeding sensor limits shall latch an autopilot pullup"
+  message "Requirement 1 violated: Pullup should be latched"
+  condition limits & !standby & supported & !apfail
+  response pullup
+  expect violated
+end
+
+requirement 2
+  text "Change states from TRANSITION to STANDBY when in control"
+  message "Requirement 2 violated: Should change to STANDBY"
+  condition mode == 0 & standby
+  response mode == 3
+  expect holds
+end
+
+requirement 3
+  text "Change states from TRANSITION to NOMINAL when supported and OverrunFlag is false (data is good)"
+  message "Requirement 3 violated: Should change to NOMINAL"
+  condition mode == 0 & supported & !overrun
+  response mode == 1
+  expect violated
+end
+
+# rt_OneStep does not step the model on an overrun, so this never triggers
+requirement 4
+  text "Change states from NOMINAL to MANEUVER when OverrunFlag is true (data is not good)"
+  message "Requirement 4 violated: Should change to MANEUVER"
+  condition mode == 1 & overrun
+  response mode == 2
+  expect vacuous
+end
+
+requirement 5
+  text "Change states from NOMINAL to STANDBY when in control"
+  message "Requirement 5 violated: Should change to STANDBY"
+  condition mode == 1 & standby
+  response mode == 3
+  expect holds
+end
+
+requirement 6
+  text "Change states from MANEUVER to STANDBY when in control and OverrunFlag is false (data is good)"
+  message "Requirement 6 violated: Should change to STANDBY"
+  condition mode == 2 & standby & !overrun
+  response mode == 3
+  expect holds
+end
+
+requirement 7
+  text "Change states from PULLUP to TRANSITION when supported and OverrunFlag is false (data is good)"
+  message "Requirement 7 violated: Should change to TRANSITION"
+  condition mode == 3 & supported & !overrun
+  response mode == 0
+  expect violated
+end
+
+requirement 8
+  text "Change states from STANDBY to TRANSITION when not in control"
+  message "Requirement 8 violated: Should change to TRANSITION"
+  condition mode == 3 & !standby
+  response mode == 0
+  expect violated
+end
+
+requirement 9
+  text "Change states from STANDBY to MANEUVER when apfail occurs"
+  message "Requirement 9 violated: Should change to MANEUVER"
+  condition mode == 3 & apfail
+  response mode == 2
+  expect holds
+end
+
+requirement 10
+  text "Change sensor states from NOMINAL to FAULT when limits are exceeded"
+  message "Requirement 10 violated: Should change to FAULT"
+  condition sensor == 1 & limits
+  response sensor == 2
+  expect violated
+end
+
+requirement 11
+  text "Change sensor states from NOMINAL to TRANSITION when not requested"
+  message "Requirement 11 violated: Should change to TRANSITION"
+  condition sensor == 1 & !supported
+  response sensor == 0
+  expect violated
+end
+
+requirement 12
+  text "Change sensor states from FAULT to TRANSITION when not requested and limits not exceeded"
+  message "Requirement 12 violated: Should change to TRANSITION"
+  condition sensor == 2 & !supported & !limits
+  response sensor == 0
+  expect violated
+end
+
+requirement 13
+  text "Change sensor states from TRANSITION to NOMINAL when requested and mode is correct"
+  message "Requirement 13 violated: Should change to NOMINAL"
+  condition sensor == 0 & supported
+  response sensor == 1
+  expect violated
+end
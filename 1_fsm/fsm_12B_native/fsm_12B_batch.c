@@ -0,0 +1,169 @@
+/*
+ * File: fsm_12B_batch.c
+ *
+ * Batched multi-instance entry points for Simulink model 'fsm_12B'.
+ *
+ * fsm_12B_step_batch evaluates the same If/Switch chains as fsm_12B_step,
+ * written as single-level selects over per-instance columns so that the
+ * loop body has no data-dependent control flow and if-converts into
+ * vector blends (build with -O3 and an -march that has AVX2 or wider).
+ * The If subsystems test for mutually exclusive constants, so every
+ * action subsystem output can be computed up front and selected
+ * afterwards without changing which one fires.  A state outside
+ * 0.0..3.0 keeps its previous Merge value and Merge_p, exactly as the
+ * generated code does.
+ */
+
+#include "fsm_12B_batch.h"
+#include "rtwtypes.h"
+
+/* Model initialize function, n instances */
+void fsm_12B_initialize_batch(int_T n, const DW_Batch *rtDWb)
+{
+  boolean_T *UnitDelay2_DSTATE = rtDWb->UnitDelay2_DSTATE;
+  int_T i;
+  for (i = 0; i < n; i++) {
+    /* InitializeConditions for UnitDelay: '<S1>/Unit Delay2' */
+    UnitDelay2_DSTATE[i] = true;
+  }
+}
+
+/*
+ * Step kernel.  Every column is a separate restrict-qualified parameter so
+ * that the loop can be vectorized without runtime alias checks.
+ */
+static void fsm_12B_step_kernel(int_T n, real_T *restrict Merge, real_T
+  *restrict Merge_g, real_T *restrict UnitDelay_DSTATE, real_T *restrict
+  UnitDelay1_DSTATE, boolean_T *restrict Merge_p0, boolean_T *restrict Merge_p1,
+  boolean_T *restrict Merge_p2, boolean_T *restrict UnitDelay2_DSTATE, const
+  boolean_T *restrict U_standby, const boolean_T *restrict U_apfail, const
+  boolean_T *restrict U_supported, const boolean_T *restrict U_limits,
+  boolean_T *restrict Y_pullup)
+{
+  int_T i;
+  for (i = 0; i < n; i++) {
+    const real_T ud = UnitDelay_DSTATE[i];
+    const real_T ud1 = UnitDelay1_DSTATE[i];
+    const boolean_T ud2 = (UnitDelay2_DSTATE[i] != 0);
+    const boolean_T standby = (U_standby[i] != 0);
+    const boolean_T apfail = (U_apfail[i] != 0);
+    const boolean_T supported = (U_supported[i] != 0);
+    const boolean_T limits = (U_limits[i] != 0);
+    real_T m = Merge[i];
+    real_T g = Merge_g[i];
+    boolean_T p0 = Merge_p0[i];
+    boolean_T p1 = Merge_p1[i];
+    boolean_T p2 = Merge_p2[i];
+
+    /* If: '<S4>/If' incorporates:
+     *  SubSystem: '<S4>/Transition'
+     *  SubSystem: '<S4>/Nominal'
+     *  SubSystem: '<S4>/Maneuver'
+     *  SubSystem: '<S4>/Standby'
+     */
+    real_T m_transition = (supported & ud2) ? 1.0 : ud;
+    real_T m_nominal = ud2 ? 1.0 : 2.0;
+    real_T m_maneuver = (supported & ud2) ? 0.0 : 2.0;
+    real_T m_standby = standby ? 3.0 : 0.0;
+    m_transition = standby ? 3.0 : m_transition;
+    m_nominal = standby ? 3.0 : m_nominal;
+    m_maneuver = (standby & ud2) ? 3.0 : m_maneuver;
+    m_standby = apfail ? 2.0 : m_standby;
+    m = (ud == 0.0) ? m_transition : m;
+    m = (ud == 1.0) ? m_nominal : m;
+    m = (ud == 2.0) ? m_maneuver : m;
+    m = (ud == 3.0) ? m_standby : m;
+
+    /* If: '<S5>/If' incorporates:
+     *  SubSystem: '<S5>/Transition'
+     *  SubSystem: '<S5>/Nominal'
+     *  SubSystem: '<S5>/Maneuver'
+     *  SubSystem: '<S5>/Standby'
+     */
+    const boolean_T m0 = (m == 0.0);
+    const boolean_T m1 = (m == 1.0);
+    const boolean_T m2 = (m == 2.0);
+    const boolean_T m3 = (m == 3.0);
+    const boolean_T keep = (boolean_T)-(boolean_T)!(m0 | m1 | m2 | m3);
+    p0 = (boolean_T)((p0 & keep) | (m1 | m2 | m3));
+    p1 = (boolean_T)((p1 & keep) | (m0 | m1));
+    p2 = (boolean_T)((p2 & keep) | m2);
+
+    /* If: '<S14>/If' incorporates:
+     *  SubSystem: '<S14>/Nominal'
+     *  SubSystem: '<S14>/Transition'
+     *  SubSystem: '<S14>/Fault'
+     */
+    const boolean_T q0 = (p0 != 0);
+    const boolean_T q1 = (p1 != 0);
+    real_T g_nominal = q1 ? ud1 : 1.0;
+    const real_T g_transition = (q0 & q1) ? 0.0 : 1.0;
+    const real_T g_fault = (q1 & limits) ? 2.0 : 1.0;
+    g_nominal = limits ? 2.0 : g_nominal;
+    g = (ud1 == 0.0) ? g_nominal : g;
+    g = (ud1 == 1.0) ? g_transition : g;
+    g = (ud1 == 2.0) ? g_fault : g;
+
+    Merge[i] = m;
+    Merge_g[i] = g;
+    Merge_p0[i] = p0;
+    Merge_p1[i] = p1;
+    Merge_p2[i] = p2;
+
+    /* Outport: '<Root>/pullup' */
+    Y_pullup[i] = p2;
+
+    /* Update for UnitDelay: '<S1>/Unit Delay' */
+    UnitDelay_DSTATE[i] = m;
+
+    /* Update for UnitDelay: '<S1>/Unit Delay2' */
+    UnitDelay2_DSTATE[i] = !(g == 2.0);
+
+    /* Update for UnitDelay: '<S1>/Unit Delay1' */
+    UnitDelay1_DSTATE[i] = g;
+  }
+}
+
+/* Model step function, n instances */
+void fsm_12B_step_batch(int_T n, const DW_Batch *rtDWb, const boolean_T
+  *rtU_standby, const boolean_T *rtU_apfail, const boolean_T *rtU_supported,
+  const boolean_T *rtU_limits, boolean_T *rtY_pullup)
+{
+  fsm_12B_step_kernel(n, rtDWb->Merge, rtDWb->Merge_g, rtDWb->UnitDelay_DSTATE,
+                      rtDWb->UnitDelay1_DSTATE, rtDWb->Merge_p[0],
+                      rtDWb->Merge_p[1], rtDWb->Merge_p[2],
+                      rtDWb->UnitDelay2_DSTATE, rtU_standby, rtU_apfail,
+                      rtU_supported, rtU_limits, rtY_pullup);
+}
+
+/* Copy one DW into column i */
+void fsm_12B_batch_load(const DW_Batch *rtDWb, int_T i, const DW *rtDW)
+{
+  rtDWb->Merge[i] = rtDW->Merge;
+  rtDWb->Merge_g[i] = rtDW->Merge_g;
+  rtDWb->UnitDelay_DSTATE[i] = rtDW->UnitDelay_DSTATE;
+  rtDWb->UnitDelay1_DSTATE[i] = rtDW->UnitDelay1_DSTATE;
+  rtDWb->Merge_p[0][i] = rtDW->Merge_p[0];
+  rtDWb->Merge_p[1][i] = rtDW->Merge_p[1];
+  rtDWb->Merge_p[2][i] = rtDW->Merge_p[2];
+  rtDWb->UnitDelay2_DSTATE[i] = rtDW->UnitDelay2_DSTATE;
+}
+
+/* Copy column i back into one DW */
+void fsm_12B_batch_store(const DW_Batch *rtDWb, int_T i, DW *rtDW)
+{
+  rtDW->Merge = rtDWb->Merge[i];
+  rtDW->Merge_g = rtDWb->Merge_g[i];
+  rtDW->UnitDelay_DSTATE = rtDWb->UnitDelay_DSTATE[i];
+  rtDW->UnitDelay1_DSTATE = rtDWb->UnitDelay1_DSTATE[i];
+  rtDW->Merge_p[0] = rtDWb->Merge_p[0][i];
+  rtDW->Merge_p[1] = rtDWb->Merge_p[1][i];
+  rtDW->Merge_p[2] = rtDWb->Merge_p[2][i];
+  rtDW->UnitDelay2_DSTATE = rtDWb->UnitDelay2_DSTATE[i];
+}
+
+/*
+ * File trailer for fsm_12B_batch.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,45 @@
+/*
+ * File: fsm_12B_batch.h
+ *
+ * Batched multi-instance entry points for Simulink model 'fsm_12B'.
+ *
+ * The block states of n independent model instances are held as a
+ * structure of arrays, one contiguous column per DW field, so that one
+ * call to fsm_12B_step_batch advances every instance and the compiler is
+ * free to vectorize across instances.  Each column element i, taken
+ * together, is bit-identical to the DW of instance i stepped with
+ * fsm_12B_step.
+ */
+
+#ifndef fsm_12B_batch_h_
+#define fsm_12B_batch_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+
+/* Block signals and states of n instances, structure-of-arrays layout */
+typedef struct {
+  real_T *Merge;                       /* '<S4>/Merge' */
+  real_T *Merge_g;                     /* '<S14>/Merge' */
+  real_T *UnitDelay_DSTATE;            /* '<S1>/Unit Delay' */
+  real_T *UnitDelay1_DSTATE;           /* '<S1>/Unit Delay1' */
+  boolean_T *Merge_p[3];               /* '<S5>/Merge' */
+  boolean_T *UnitDelay2_DSTATE;        /* '<S1>/Unit Delay2' */
+} DW_Batch;
+
+/* Batched model entry point functions */
+extern void fsm_12B_initialize_batch(int_T n, const DW_Batch *rtDWb);
+extern void fsm_12B_step_batch(int_T n, const DW_Batch *rtDWb, const boolean_T
+  *rtU_standby, const boolean_T *rtU_apfail, const boolean_T *rtU_supported,
+  const boolean_T *rtU_limits, boolean_T *rtY_pullup);
+
+/* Conversion between DW and column i of a DW_Batch */
+extern void fsm_12B_batch_load(const DW_Batch *rtDWb, int_T i, const DW *rtDW);
+extern void fsm_12B_batch_store(const DW_Batch *rtDWb, int_T i, DW *rtDW);
+
+#endif                                 /* fsm_12B_batch_h_ */
+
+/*
+ * File trailer for fsm_12B_batch.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,357 @@
+/*
+ * File: fsm_12B_bitslice.c
+ *
+ * Bit-sliced multi-instance engine for Simulink model 'fsm_12B'.
+ *
+ * The step function is instantiated from fsm_12B_bitslice_body.h for
+ * plain uint64_T words and for AVX2 (256 instances per operation) and
+ * AVX-512F (512 instances per operation).  fsm_12B_bs_step uses the
+ * widest backend the compiler targets for whole vectors and the uint64_T
+ * backend for the remaining words.  With GCC or Clang on x86 the vector
+ * backends are built regardless, for their own instruction set, so that
+ * fsm_12B_bs_step_isa can run each one on a CPU that has it.
+ */
+
+#include "fsm_12B_bitslice.h"
+#include "rtwtypes.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BS_X86_TARGETS
+#endif
+
+#if defined(__AVX2__) || defined(BS_X86_TARGETS)
+#define BS_AVX2
+#endif
+
+#if defined(__AVX512F__) || defined(BS_X86_TARGETS)
+#define BS_AVX512F
+#endif
+
+#if defined(BS_AVX2) || defined(BS_AVX512F)
+#include <immintrin.h>
+#endif
+
+#if defined(BS_X86_TARGETS)
+#include <cpuid.h>
+#define BS_TARGET(isa)                 __attribute__((target(isa)))
+#define BS_CPU_HAS(isa, xcr0)          (bs_os_saves(xcr0) && (__builtin_cpu_init(), __builtin_cpu_supports(isa)))
+
+/* XCR0 state components: SSE and AVX, then the three AVX-512 ones */
+#define BS_XCR0_AVX                    0x06U
+#define BS_XCR0_AVX512                 0xE6U
+
+/*
+ * Does the OS save and restore the given register state on a context
+ * switch?  The CPU may have AVX2 or AVX-512F while the OS leaves them
+ * disabled, and the instructions then fault.
+ */
+static boolean_T bs_os_saves(uint32_T xcr0)
+{
+  uint32_T a;
+  uint32_T b;
+  uint32_T c;
+  uint32_T d;
+  if ((__get_cpuid(1U, &a, &b, &c, &d) == 0) || ((c & bit_OSXSAVE) == 0U)) {
+    return false;
+  }
+
+  __asm__ __volatile__ ("xgetbv" : "=a" (a), "=d" (d) : "c" (0U));
+  return (a & xcr0) == xcr0;
+}
+
+#else
+#define BS_TARGET(isa)
+#define BS_CPU_HAS(isa, xcr0)          1
+#endif
+
+const char_T *const fsm_12B_bs_isa_name[FSM_12B_BS_NUM_ISAS] = { "uint64",
+  "avx2", "avx512f" };
+
+/* Portable backend, 64 instances per word */
+#define BS_FN                          fsm_12B_bs_word_u64
+#define BS_ATTR
+#define BS_T                           uint64_T
+#define BS_AND(a, b)                   ((a) & (b))
+#define BS_OR(a, b)                    ((a) | (b))
+#define BS_ANDNOT(a, b)                (~(a) & (b))
+#define BS_NOT(a)                      (~(a))
+#include "fsm_12B_bitslice_body.h"
+#undef BS_FN
+#undef BS_ATTR
+#undef BS_T
+#undef BS_AND
+#undef BS_OR
+#undef BS_ANDNOT
+#undef BS_NOT
+
+/* Words w..nwords-1 on the uint64_T backend */
+static void fsm_12B_bs_step_u64(int_T w, int_T nwords, const DW_BitSlice
+  *rtDWs, const uint64_T *rtU_standby, const uint64_T *rtU_apfail, const
+  uint64_T *rtU_supported, const uint64_T *rtU_limits, uint64_T *rtY_pullup)
+{
+  for (; w < nwords; w++) {
+    fsm_12B_bs_word_u64(&rtDWs->Mode0[w], &rtDWs->Mode1[w], &rtDWs->
+                        SenMode0[w], &rtDWs->SenMode1[w], &rtDWs->UnitDelay2[w],
+                        rtU_standby[w], rtU_apfail[w], rtU_supported[w],
+                        rtU_limits[w], &rtY_pullup[w]);
+  }
+}
+
+#if defined(BS_AVX2)
+
+/* AVX2 backend, 256 instances per vector */
+#define BS_FN                          fsm_12B_bs_word_avx2
+#define BS_ATTR                        BS_TARGET("avx2")
+#define BS_T                           __m256i
+#define BS_AND(a, b)                   _mm256_and_si256((a), (b))
+#define BS_OR(a, b)                    _mm256_or_si256((a), (b))
+#define BS_ANDNOT(a, b)                _mm256_andnot_si256((a), (b))
+#define BS_NOT(a)                      _mm256_xor_si256((a), _mm256_set1_epi64x(-1))
+#include "fsm_12B_bitslice_body.h"
+#undef BS_FN
+#undef BS_ATTR
+#undef BS_T
+#undef BS_AND
+#undef BS_OR
+#undef BS_ANDNOT
+#undef BS_NOT
+
+/* Whole vectors from word w on; returns the first word not stepped */
+static BS_TARGET("avx2") int_T fsm_12B_bs_step_avx2(int_T w, int_T nwords,
+  const DW_BitSlice *rtDWs, const uint64_T *rtU_standby, const uint64_T
+  *rtU_apfail, const uint64_T *rtU_supported, const uint64_T *rtU_limits,
+  uint64_T *rtY_pullup)
+{
+  uint64_T *Mode0 = rtDWs->Mode0;
+  uint64_T *Mode1 = rtDWs->Mode1;
+  uint64_T *SenMode0 = rtDWs->SenMode0;
+  uint64_T *SenMode1 = rtDWs->SenMode1;
+  uint64_T *UnitDelay2 = rtDWs->UnitDelay2;
+  for (; w + 4 <= nwords; w += 4) {
+    __m256i m0 = _mm256_loadu_si256((const __m256i *)&Mode0[w]);
+    __m256i m1 = _mm256_loadu_si256((const __m256i *)&Mode1[w]);
+    __m256i g0 = _mm256_loadu_si256((const __m256i *)&SenMode0[w]);
+    __m256i g1 = _mm256_loadu_si256((const __m256i *)&SenMode1[w]);
+    __m256i d = _mm256_loadu_si256((const __m256i *)&UnitDelay2[w]);
+    __m256i y;
+    fsm_12B_bs_word_avx2(&m0, &m1, &g0, &g1, &d, _mm256_loadu_si256((const
+      __m256i *)&rtU_standby[w]), _mm256_loadu_si256((const __m256i *)
+      &rtU_apfail[w]), _mm256_loadu_si256((const __m256i *)&rtU_supported[w]),
+                         _mm256_loadu_si256((const __m256i *)&rtU_limits[w]),
+                         &y);
+    _mm256_storeu_si256((__m256i *)&Mode0[w], m0);
+    _mm256_storeu_si256((__m256i *)&Mode1[w], m1);
+    _mm256_storeu_si256((__m256i *)&SenMode0[w], g0);
+    _mm256_storeu_si256((__m256i *)&SenMode1[w], g1);
+    _mm256_storeu_si256((__m256i *)&UnitDelay2[w], d);
+    _mm256_storeu_si256((__m256i *)&rtY_pullup[w], y);
+  }
+
+  return w;
+}
+
+#endif                                 /* BS_AVX2 */
+
+#if defined(BS_AVX512F)
+
+/* AVX-512F backend, 512 instances per vector */
+#define BS_FN                          fsm_12B_bs_word_avx512
+#define BS_ATTR                        BS_TARGET("avx512f")
+#define BS_T                           __m512i
+#define BS_AND(a, b)                   _mm512_and_si512((a), (b))
+#define BS_OR(a, b)                    _mm512_or_si512((a), (b))
+#define BS_ANDNOT(a, b)                _mm512_andnot_si512((a), (b))
+#define BS_NOT(a)                      _mm512_xor_si512((a), _mm512_set1_epi64(-1))
+#include "fsm_12B_bitslice_body.h"
+#undef BS_FN
+#undef BS_ATTR
+#undef BS_T
+#undef BS_AND
+#undef BS_OR
+#undef BS_ANDNOT
+#undef BS_NOT
+
+/* Whole vectors from word w on; returns the first word not stepped */
+static BS_TARGET("avx512f") int_T fsm_12B_bs_step_avx512(int_T w, int_T
+  nwords, const DW_BitSlice *rtDWs, const uint64_T *rtU_standby, const
+  uint64_T *rtU_apfail, const uint64_T *rtU_supported, const uint64_T
+  *rtU_limits, uint64_T *rtY_pullup)
+{
+  uint64_T *Mode0 = rtDWs->Mode0;
+  uint64_T *Mode1 = rtDWs->Mode1;
+  uint64_T *SenMode0 = rtDWs->SenMode0;
+  uint64_T *SenMode1 = rtDWs->SenMode1;
+  uint64_T *UnitDelay2 = rtDWs->UnitDelay2;
+  for (; w + 8 <= nwords; w += 8) {
+    __m512i m0 = _mm512_loadu_si512((const void *)&Mode0[w]);
+    __m512i m1 = _mm512_loadu_si512((const void *)&Mode1[w]);
+    __m512i g0 = _mm512_loadu_si512((const void *)&SenMode0[w]);
+    __m512i g1 = _mm512_loadu_si512((const void *)&SenMode1[w]);
+    __m512i d = _mm512_loadu_si512((const void *)&UnitDelay2[w]);
+    __m512i y;
+    fsm_12B_bs_word_avx512(&m0, &m1, &g0, &g1, &d, _mm512_loadu_si512((const
+      void *)&rtU_standby[w]), _mm512_loadu_si512((const void *)&rtU_apfail[w]),
+      _mm512_loadu_si512((const void *)&rtU_supported[w]), _mm512_loadu_si512
+      ((const void *)&rtU_limits[w]), &y);
+    _mm512_storeu_si512((void *)&Mode0[w], m0);
+    _mm512_storeu_si512((void *)&Mode1[w], m1);
+    _mm512_storeu_si512((void *)&SenMode0[w], g0);
+    _mm512_storeu_si512((void *)&SenMode1[w], g1);
+    _mm512_storeu_si512((void *)&UnitDelay2[w], d);
+    _mm512_storeu_si512((void *)&rtY_pullup[w], y);
+  }
+
+  return w;
+}
+
+#endif                                 /* BS_AVX512F */
+
+/* Model initialize function, 64 * nwords instances */
+void fsm_12B_bs_initialize(int_T nwords, const DW_BitSlice *rtDWs)
+{
+  int_T w;
+  for (w = 0; w < nwords; w++) {
+    rtDWs->Mode0[w] = 0ULL;
+    rtDWs->Mode1[w] = 0ULL;
+    rtDWs->SenMode0[w] = 0ULL;
+    rtDWs->SenMode1[w] = 0ULL;
+
+    /* InitializeConditions for UnitDelay: '<S1>/Unit Delay2' */
+    rtDWs->UnitDelay2[w] = ~0ULL;
+  }
+}
+
+/* Model step function, 64 * nwords instances */
+void fsm_12B_bs_step(int_T nwords, const DW_BitSlice *rtDWs, const uint64_T
+                     *rtU_standby, const uint64_T *rtU_apfail, const uint64_T
+                     *rtU_supported, const uint64_T *rtU_limits, uint64_T
+                     *rtY_pullup)
+{
+  int_T w = 0;
+
+#if defined(__AVX512F__)
+
+  w = fsm_12B_bs_step_avx512(w, nwords, rtDWs, rtU_standby, rtU_apfail,
+    rtU_supported, rtU_limits, rtY_pullup);
+
+#endif                                 /* __AVX512F__ */
+
+#if defined(__AVX2__)
+
+  w = fsm_12B_bs_step_avx2(w, nwords, rtDWs, rtU_standby, rtU_apfail,
+    rtU_supported, rtU_limits, rtY_pullup);
+
+#endif                                 /* __AVX2__ */
+
+  fsm_12B_bs_step_u64(w, nwords, rtDWs, rtU_standby, rtU_apfail,
+                      rtU_supported, rtU_limits, rtY_pullup);
+}
+
+boolean_T fsm_12B_bs_step_isa(fsm_12B_BsIsa isa, int_T nwords, const
+  DW_BitSlice *rtDWs, const uint64_T *rtU_standby, const uint64_T *rtU_apfail,
+  const uint64_T *rtU_supported, const uint64_T *rtU_limits, uint64_T
+  *rtY_pullup)
+{
+  int_T w = 0;
+  switch (isa) {
+   case FSM_12B_BS_UINT64:
+    break;
+
+#if defined(BS_AVX2)
+
+   case FSM_12B_BS_AVX2:
+    if (!BS_CPU_HAS("avx2", BS_XCR0_AVX)) {
+      return false;
+    }
+
+    w = fsm_12B_bs_step_avx2(w, nwords, rtDWs, rtU_standby, rtU_apfail,
+      rtU_supported, rtU_limits, rtY_pullup);
+    break;
+
+#endif                                 /* BS_AVX2 */
+
+#if defined(BS_AVX512F)
+
+   case FSM_12B_BS_AVX512F:
+    if (!BS_CPU_HAS("avx512f", BS_XCR0_AVX512)) {
+      return false;
+    }
+
+    w = fsm_12B_bs_step_avx512(w, nwords, rtDWs, rtU_standby, rtU_apfail,
+      rtU_supported, rtU_limits, rtY_pullup);
+    break;
+
+#endif                                 /* BS_AVX512F */
+
+   default:
+    return false;
+  }
+
+  fsm_12B_bs_step_u64(w, nwords, rtDWs, rtU_standby, rtU_apfail,
+                      rtU_supported, rtU_limits, rtY_pullup);
+  return true;
+}
+
+const char_T *fsm_12B_bs_isa(void)
+{
+#if defined(__AVX512F__)
+
+  return fsm_12B_bs_isa_name[FSM_12B_BS_AVX512F];
+
+#elif defined(__AVX2__)
+
+  return fsm_12B_bs_isa_name[FSM_12B_BS_AVX2];
+
+#else
+
+  return fsm_12B_bs_isa_name[FSM_12B_BS_UINT64];
+
+#endif
+}
+
+/* Copy one DW into a lane */
+boolean_T fsm_12B_bs_load(const DW_BitSlice *rtDWs, int_T lane, const DW *rtDW)
+{
+  const real_T ud = rtDW->UnitDelay_DSTATE;
+  const real_T ud1 = rtDW->UnitDelay1_DSTATE;
+  uint32_T mode;
+  uint32_T sen;
+  if (!((ud == 0.0) || (ud == 1.0) || (ud == 2.0) || (ud == 3.0))) {
+    return false;
+  }
+
+  if (!((ud1 == 0.0) || (ud1 == 1.0) || (ud1 == 2.0))) {
+    return false;
+  }
+
+  mode = (uint32_T)ud;
+  sen = (uint32_T)ud1;
+  FSM_12B_BS_SET(rtDWs->Mode0, lane, mode & 1U);
+  FSM_12B_BS_SET(rtDWs->Mode1, lane, mode >> 1);
+  FSM_12B_BS_SET(rtDWs->SenMode0, lane, sen & 1U);
+  FSM_12B_BS_SET(rtDWs->SenMode1, lane, sen >> 1);
+  FSM_12B_BS_SET(rtDWs->UnitDelay2, lane, rtDW->UnitDelay2_DSTATE);
+  return true;
+}
+
+/* Copy a lane back into one DW, rebuilding the merged signals */
+void fsm_12B_bs_store(const DW_BitSlice *rtDWs, int_T lane, DW *rtDW)
+{
+  const uint32_T mode = (uint32_T)FSM_12B_BS_GET(rtDWs->Mode0, lane) |
+    ((uint32_T)FSM_12B_BS_GET(rtDWs->Mode1, lane) << 1);
+  const uint32_T sen = (uint32_T)FSM_12B_BS_GET(rtDWs->SenMode0, lane) |
+    ((uint32_T)FSM_12B_BS_GET(rtDWs->SenMode1, lane) << 1);
+  rtDW->Merge = (real_T)mode;
+  rtDW->UnitDelay_DSTATE = (real_T)mode;
+  rtDW->Merge_g = (real_T)sen;
+  rtDW->UnitDelay1_DSTATE = (real_T)sen;
+  rtDW->Merge_p[0] = (mode != 0U);
+  rtDW->Merge_p[1] = (mode < 2U);
+  rtDW->Merge_p[2] = (mode == 2U);
+  rtDW->UnitDelay2_DSTATE = FSM_12B_BS_GET(rtDWs->UnitDelay2, lane);
+}
+
+/*
+ * File trailer for fsm_12B_bitslice.c
+ *
+ * [EOF]
+ */
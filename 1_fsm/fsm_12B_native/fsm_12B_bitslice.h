@@ -0,0 +1,89 @@
+/*
+ * File: fsm_12B_bitslice.h
+ *
+ * Bit-sliced multi-instance engine for Simulink model 'fsm_12B'.
+ *
+ * Each uint64_T word of a bit-plane holds one bit of 64 independent
+ * instances, lane k of word w being instance 64 * w + k.  The engine keeps
+ * only the states that fsm_12B_step actually reads:
+ *
+ *   Manager mode  '<S1>/Unit Delay'   2 planes  0 Transition  1 Nominal
+ *                                               2 Maneuver    3 Standby
+ *   Sen mode      '<S1>/Unit Delay1'  2 planes  0 Nominal     1 Transition
+ *                                               2 Fault
+ *   '<S1>/Unit Delay2'                1 plane
+ *
+ * '<S4>/Merge', '<S14>/Merge' and '<S5>/Merge' are always rewritten from
+ * these before being read, so they are reconstructed on store.  The
+ * engine is therefore exact for every DW whose delays hold the integral
+ * mode values above, which includes everything reachable from
+ * fsm_12B_initialize.
+ */
+
+#ifndef fsm_12B_bitslice_h_
+#define fsm_12B_bitslice_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+
+/* Number of instances held by one bit-plane word */
+#define FSM_12B_BS_LANES               64
+
+/* Block states of 64 * nwords instances, one array of words per bit-plane */
+typedef struct {
+  uint64_T *Mode0;                     /* '<S1>/Unit Delay', bit 0 */
+  uint64_T *Mode1;                     /* '<S1>/Unit Delay', bit 1 */
+  uint64_T *SenMode0;                  /* '<S1>/Unit Delay1', bit 0 */
+  uint64_T *SenMode1;                  /* '<S1>/Unit Delay1', bit 1 */
+  uint64_T *UnitDelay2;                /* '<S1>/Unit Delay2' */
+} DW_BitSlice;
+
+/* Bit-sliced model entry point functions */
+extern void fsm_12B_bs_initialize(int_T nwords, const DW_BitSlice *rtDWs);
+extern void fsm_12B_bs_step(int_T nwords, const DW_BitSlice *rtDWs, const
+  uint64_T *rtU_standby, const uint64_T *rtU_apfail, const uint64_T
+  *rtU_supported, const uint64_T *rtU_limits, uint64_T *rtY_pullup);
+
+/* Instruction set backends of fsm_12B_bs_step */
+typedef enum {
+  FSM_12B_BS_UINT64 = 0,               /* 1 word per operation */
+  FSM_12B_BS_AVX2,                     /* 4 words per operation */
+  FSM_12B_BS_AVX512F                   /* 8 words per operation */
+} fsm_12B_BsIsa;
+
+#define FSM_12B_BS_NUM_ISAS            3
+
+extern const char_T *const fsm_12B_bs_isa_name[FSM_12B_BS_NUM_ISAS];
+
+/* Name of the instruction set the step kernel was compiled for */
+extern const char_T *fsm_12B_bs_isa(void);
+
+/*
+ * fsm_12B_bs_step on the given backend for whole vectors and on uint64_T
+ * for the remaining words, for testing each backend.  Returns false, and
+ * steps nothing, when the backend is not built in, or this CPU lacks it or
+ * the OS does not enable its registers (XGETBV).
+ */
+extern boolean_T fsm_12B_bs_step_isa(fsm_12B_BsIsa isa, int_T nwords, const
+  DW_BitSlice *rtDWs, const uint64_T *rtU_standby, const uint64_T *rtU_apfail,
+  const uint64_T *rtU_supported, const uint64_T *rtU_limits, uint64_T
+  *rtY_pullup);
+
+/*
+ * Conversion between DW and one lane.  fsm_12B_bs_load returns false and
+ * leaves the lane untouched when a delay is outside the encoded domain.
+ */
+extern boolean_T fsm_12B_bs_load(const DW_BitSlice *rtDWs, int_T lane, const
+  DW *rtDW);
+extern void fsm_12B_bs_store(const DW_BitSlice *rtDWs, int_T lane, DW *rtDW);
+
+/* Lane access on an input or output bit-plane */
+#define FSM_12B_BS_GET(plane, lane)    ((boolean_T)(((plane)[(lane) >> 6] >> ((lane) & 63)) & 1U))
+#define FSM_12B_BS_SET(plane, lane, v) ((plane)[(lane) >> 6] = ((plane)[(lane) >> 6] & ~(1ULL << ((lane) & 63))) | ((uint64_T)((v) != 0) << ((lane) & 63)))
+
+#endif                                 /* fsm_12B_bitslice_h_ */
+
+/*
+ * File trailer for fsm_12B_bitslice.h
+ *
+ * [EOF]
+ */
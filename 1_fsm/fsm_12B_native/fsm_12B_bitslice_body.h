@@ -0,0 +1,83 @@
+/*
+ * File: fsm_12B_bitslice_body.h
+ *
+ * Boolean form of fsm_12B_step for one bit-sliced word, shared by every
+ * instruction set backend of fsm_12B_bitslice.c.  The includer defines
+ *
+ *   BS_FN            name of the generated function
+ *   BS_ATTR          its attributes, such as the target instruction set
+ *   BS_T             word type
+ *   BS_AND(a, b)     a & b
+ *   BS_OR(a, b)      a | b
+ *   BS_ANDNOT(a, b)  ~a & b
+ *   BS_NOT(a)        ~a
+ *
+ * and this file is included once per backend.
+ */
+
+static inline BS_ATTR void BS_FN(BS_T *m0, BS_T *m1, BS_T *g0, BS_T *g1, BS_T
+  *d, BS_T S, BS_T A, BS_T P, BS_T L, BS_T *y)
+{
+  /* One-hot decode of '<S1>/Unit Delay' */
+  const BS_T tr = BS_NOT(BS_OR(*m1, *m0));
+  const BS_T no = BS_ANDNOT(*m1, *m0);
+  const BS_T mv = BS_ANDNOT(*m0, *m1);
+  const BS_T sb = BS_AND(*m1, *m0);
+
+  /* One-hot decode of '<S1>/Unit Delay1' */
+  const BS_T gn = BS_NOT(BS_OR(*g1, *g0));
+  const BS_T gt = BS_ANDNOT(*g1, *g0);
+  const BS_T gf = BS_ANDNOT(*g0, *g1);
+  const BS_T gx = BS_AND(*g1, *g0);
+  const BS_T SD = BS_AND(S, *d);
+  const BS_T PD = BS_AND(P, *d);
+  BS_T n0;
+  BS_T n1;
+  BS_T p1;
+  BS_T h0;
+  BS_T h1;
+
+  /* If: '<S4>/If'
+   *  Transition: 3 if standby, 1 if supported && Unit Delay2, else 0
+   *  Nominal:    3 if standby, 2 if !Unit Delay2, else 1
+   *  Maneuver:   3 if standby && Unit Delay2, 0 if supported && Unit Delay2,
+   *              else 2
+   *  Standby:    2 if apfail, 0 if !standby, else 3
+   */
+  n0 = BS_OR(BS_OR(BS_AND(tr, BS_OR(S, PD)), BS_AND(no, BS_OR(S, *d))), BS_OR
+             (BS_AND(mv, SD), BS_AND(sb, BS_ANDNOT(A, S))));
+  n1 = BS_OR(BS_OR(BS_AND(tr, S), BS_AND(no, BS_NOT(BS_ANDNOT(S, *d)))), BS_OR
+             (BS_AND(mv, BS_NOT(BS_ANDNOT(SD, PD))), BS_AND(sb, BS_OR(A, S))));
+
+  /* If: '<S5>/If'
+   *  Merge_p[0] = Merge != 0, Merge_p[1] = Merge < 2, Merge_p[2] = Merge == 2
+   */
+  p1 = BS_NOT(n1);
+
+  /* If: '<S14>/If'
+   *  Nominal:    2 if limits, 1 if !Merge_p[1], else 0
+   *  Transition: 0 if Merge_p[0] && Merge_p[1], else 1
+   *  Fault:      1 if !Merge_p[1] || !limits, else 2
+   */
+  h0 = BS_OR(BS_OR(BS_AND(gn, BS_ANDNOT(L, n1)), BS_AND(gt, BS_NOT(BS_AND(BS_OR
+    (n0, n1), p1)))), BS_OR(BS_AND(gf, BS_NOT(BS_AND(p1, L))), gx));
+  h1 = BS_OR(BS_OR(BS_AND(gn, L), BS_AND(gf, BS_AND(p1, L))), gx);
+
+  /* Outport: '<Root>/pullup' */
+  *y = BS_ANDNOT(n0, n1);
+
+  /* Update for UnitDelay: '<S1>/Unit Delay2' */
+  *d = BS_NOT(BS_ANDNOT(h0, h1));
+
+  /* Update for UnitDelay: '<S1>/Unit Delay' and '<S1>/Unit Delay1' */
+  *m0 = n0;
+  *m1 = n1;
+  *g0 = h0;
+  *g1 = h1;
+}
+
+/*
+ * File trailer for fsm_12B_bitslice_body.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,691 @@
+/*
+ * File: fsm_12B_cex.c
+ *
+ * Counterexample parser, replayer and test writer of fsm_12B_cex.h.
+ *
+ * The parser follows the layout of ESBMC 7:
+ *
+ *   [Counterexample]
+ *
+ *   State 5 file ert_main.c line 72 column 2 function rt_OneStep thread 0
+ *   ----------------------------------------------------
+ *     rtDW.Merge = 0.000000 (00000000 00000000 ... 00000000)
+ *
+ *   Violated property:
+ *     file ert_main.c line 105 column 3 function rt_OneStep
+ *     Requirement 2 violated: Should change to STANDBY
+ *     rtDW.Merge == 3.0
+ *
+ * The bits in parentheses are used when present, so doubles, NaN
+ * included, are replayed exactly; otherwise the value is read as printed.
+ * A structure value such as "rtDW = { .Merge=0.0, ... }" sets its fields
+ * by name or by position.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B.h"
+#include "fsm_12B_cex.h"
+#include "fsm_12B_req.h"
+#include "rtwtypes.h"
+
+enum {
+  BEFORE = 0,
+  TRACE,
+  PROPERTY,
+  DONE
+};
+
+const char_T *const fsm_12B_cex_slot_name[FSM_12B_CEX_SLOTS + 1] = { "Merge",
+  "Merge_g", "UnitDelay_DSTATE", "UnitDelay1_DSTATE", "Merge_p[0]",
+  "Merge_p[1]", "Merge_p[2]", "UnitDelay2_DSTATE", "rtY_pullup" };
+
+const char_T *const fsm_12B_cex_input_name[4] = { "rtU_standby", "rtU_apfail",
+  "rtU_supported", "rtU_limits" };
+
+static const char_T *const fsm_12B_cex_function[2] = { "fsm_12B_initialize",
+  "fsm_12B_step" };
+
+/* Slots of DW that hold a boolean_T */
+static boolean_T is_boolean(int_T i)
+{
+  return i >= 4;
+}
+
+real_T fsm_12B_cex_get(const DW *rtDW, int_T i)
+{
+  switch (i) {
+   case 0:
+    return rtDW->Merge;
+
+   case 1:
+    return rtDW->Merge_g;
+
+   case 2:
+    return rtDW->UnitDelay_DSTATE;
+
+   case 3:
+    return rtDW->UnitDelay1_DSTATE;
+
+   case 7:
+    return rtDW->UnitDelay2_DSTATE ? 1.0 : 0.0;
+
+   default:
+    return rtDW->Merge_p[i - 4] ? 1.0 : 0.0;
+  }
+}
+
+void fsm_12B_cex_set(DW *rtDW, int_T i, real_T v)
+{
+  switch (i) {
+   case 0:
+    rtDW->Merge = v;
+    break;
+
+   case 1:
+    rtDW->Merge_g = v;
+    break;
+
+   case 2:
+    rtDW->UnitDelay_DSTATE = v;
+    break;
+
+   case 3:
+    rtDW->UnitDelay1_DSTATE = v;
+    break;
+
+   case 7:
+    rtDW->UnitDelay2_DSTATE = (v != 0.0);
+    break;
+
+   default:
+    rtDW->Merge_p[i - 4] = (v != 0.0);
+    break;
+  }
+}
+
+void fsm_12B_cex_init(fsm_12B_CexParser *p)
+{
+  memset(p, 0, sizeof(fsm_12B_CexParser));
+  p->model = -1;
+}
+
+static void emit(fsm_12B_CexParser *p, fsm_12B_CexKind kind, int_T slot,
+                 real_T value, fsm_12B_CexSink sink, void *arg)
+{
+  fsm_12B_CexEvent ev;
+  ev.kind = kind;
+  ev.slot = slot;
+  ev.value = value;
+  ev.state = p->state;
+  ev.line = p->line;
+  sink(arg, &ev);
+}
+
+/*
+ * Value of the text at s up to end: the bits in parentheses when there are
+ * 64 of them (a double) or at most 32 (an integer or a boolean), else TRUE,
+ * FALSE or a number as printed.  False when there is none.
+ */
+static boolean_T value_of(const char_T *s, const char_T *end, real_T *v)
+{
+  const char_T *open = (const char_T *)memchr(s, '(', (size_t)(end - s));
+  char_T buf[64];
+  char_T *stop;
+  size_t n;
+  if (open != NULL) {
+    const char_T *q = open + 1;
+    uint64_T bits = 0U;
+    int_T nbits = 0;
+    while ((q < end) && ((*q == '0') || (*q == '1') || (*q == ' '))) {
+      if (*q != ' ') {
+        bits = (bits << 1) | (uint64_T)(*q - '0');
+        nbits++;
+      }
+
+      q++;
+    }
+
+    if ((q < end) && (*q == ')') && (nbits == 64)) {
+      memcpy(v, &bits, sizeof(real_T));
+      return true;
+    }
+
+    if ((q < end) && (*q == ')') && (nbits > 0) && (nbits <= 32)) {
+      *v = (real_T)bits;
+      return true;
+    }
+
+    end = open;
+  }
+
+  while ((s < end) && (*s == ' ')) {
+    s++;
+  }
+
+  n = (size_t)(end - s);
+  if (n >= sizeof(buf)) {
+    n = sizeof(buf) - 1U;
+  }
+
+  memcpy(buf, s, n);
+  buf[n] = '\0';
+  if ((strncmp(buf, "TRUE", 4U) == 0) || (strncmp(buf, "true", 4U) == 0)) {
+    *v = 1.0;
+    return true;
+  }
+
+  if ((strncmp(buf, "FALSE", 5U) == 0) || (strncmp(buf, "false", 5U) == 0)) {
+    *v = 0.0;
+    return true;
+  }
+
+  *v = strtod(buf, &stop);
+  return stop != buf;
+}
+
+/* Slot of a DW field name, "Merge_p" giving its first element; or -1 */
+static int_T slot_of(const char_T *name, size_t n)
+{
+  int_T i;
+  for (i = 0; i < FSM_12B_CEX_SLOTS + 1; i++) {
+    if ((strlen(fsm_12B_cex_slot_name[i]) == n) && (strncmp(name,
+          fsm_12B_cex_slot_name[i], n) == 0)) {
+      return i;
+    }
+  }
+
+  return ((n == 7U) && (strncmp(name, "Merge_p", 7U) == 0)) ? 4 : -1;
+}
+
+/* Send one assignment to slot i, as the harness or the model made it */
+static void assign(fsm_12B_CexParser *p, int_T i, real_T v, fsm_12B_CexSink
+                   sink, void *arg)
+{
+  if ((i < 0) || (i > FSM_12B_CEX_PULLUP)) {
+    return;
+  }
+
+  if (p->model >= 0) {
+    emit(p, FSM_12B_CEX_MODEL, i, v, sink, arg);
+  } else {
+    emit(p, (i == FSM_12B_CEX_PULLUP) ? FSM_12B_CEX_OUTPUT : FSM_12B_CEX_STATE,
+         i, v, sink, arg);
+  }
+
+  p->assignments++;
+}
+
+/* "{ .Merge=0.0, .Merge_p={ 0, 1, 0 }, ... }" from slot i on */
+static void structure(fsm_12B_CexParser *p, const char_T *s, int_T i,
+                      fsm_12B_CexSink sink, void *arg)
+{
+  while (*s != '\0') {
+    const char_T *end;
+    real_T v;
+    if ((*s == '{') || (*s == '}') || (*s == ',') || (*s == ' ')) {
+      s++;
+      continue;
+    }
+
+    if (*s == '.') {
+      const char_T *eq = strchr(s, '=');
+      if (eq == NULL) {
+        return;
+      }
+
+      i = slot_of(s + 1, (size_t)(eq - s - 1));
+      s = eq + 1;
+      continue;
+    }
+
+    end = s;
+    while ((*end != '\0') && (*end != ',') && (*end != '}')) {
+      end++;
+    }
+
+    if ((i >= 0) && (i < FSM_12B_CEX_SLOTS) && value_of(s, end, &v)) {
+      assign(p, i, v, sink, arg);
+    }
+
+    i = (i >= 0) ? i + 1 : i;
+    s = end;
+  }
+}
+
+/* "lhs = value" of a state */
+static void assignment(fsm_12B_CexParser *p, const char_T *s, fsm_12B_CexSink
+  sink, void *arg)
+{
+  const char_T *eq = strstr(s, " = ");
+  const char_T *name = s;
+  const char_T *value;
+  const char_T *q;
+  size_t n;
+  real_T v;
+  int_T i;
+  if (eq == NULL) {
+    return;
+  }
+
+  /* The last component of rtDW.Merge, rtM->dwork->Merge, f::1::OverrunFlag */
+  for (q = s; q < eq; q++) {
+    if ((*q == '.') || (*q == '*')) {
+      name = q + 1;
+    } else if (((q[0] == '-') && (q[1] == '>')) || ((q[0] == ':') && (q[1] ==
+                 ':'))) {
+      name = q + 2;
+    } else if (*q == '[') {
+      while ((q < eq) && (*q != ']')) {
+        q++;
+      }
+    }
+  }
+
+  n = (size_t)(eq - name);
+  value = eq + 3;
+  if (*value == '{') {
+    if (((n == 4U) && (strncmp(name, "rtDW", 4U) == 0)) || ((n == 5U) &&
+         (strncmp(name, "dwork", 5U) == 0))) {
+      structure(p, value, 0, sink, arg);
+    } else if (slot_of(name, n) == 4) {
+      structure(p, value, 4, sink, arg);
+    }
+
+    return;
+  }
+
+  if (!value_of(value, value + strlen(value), &v)) {
+    return;
+  }
+
+  i = slot_of(name, n);
+  if (i >= 0) {
+    assign(p, i, v, sink, arg);
+    return;
+  }
+
+  if (p->model >= 0) {
+    /* Parameters of fsm_12B_step and anything else in the model */
+    return;
+  }
+
+  for (i = 0; i < 4; i++) {
+    if ((strlen(fsm_12B_cex_input_name[i]) == n) && (strncmp(name,
+          fsm_12B_cex_input_name[i], n) == 0)) {
+      emit(p, FSM_12B_CEX_INPUT, i, v, sink, arg);
+      p->assignments++;
+      return;
+    }
+  }
+
+  if ((n == 11U) && (strncmp(name, "OverrunFlag", 11U) == 0)) {
+    emit(p, FSM_12B_CEX_OVERRUN, 0, v, sink, arg);
+    p->assignments++;
+  }
+}
+
+/* "State 12 file f line 85 column 2 function rt_OneStep thread 0" */
+static void header(fsm_12B_CexParser *p, const char_T *s, fsm_12B_CexSink sink,
+                   void *arg)
+{
+  const char_T *line = strstr(s, " line ");
+  const char_T *function = strstr(s, " function ");
+  int_T model = p->model;
+  p->state = atoi(s + 6);
+  p->line = (line != NULL) ? atoi(line + 6) : p->line;
+  p->states++;
+  if (function != NULL) {
+    const char_T *f = function + 10;
+    size_t n = 0U;
+    int_T i;
+    while ((f[n] != '\0') && (f[n] != ' ')) {
+      n++;
+    }
+
+    model = -1;
+    for (i = 0; i < 2; i++) {
+      if ((strlen(fsm_12B_cex_function[i]) == n) && (strncmp(f,
+            fsm_12B_cex_function[i], n) == 0)) {
+        model = i;
+      }
+    }
+  }
+
+  if (model != p->model) {
+    if (p->model >= 0) {
+      emit(p, FSM_12B_CEX_RETURN, p->model, 0.0, sink, arg);
+    }
+
+    p->model = model;
+    if (model >= 0) {
+      p->calls[model]++;
+      emit(p, FSM_12B_CEX_CALL, model, 0.0, sink, arg);
+    }
+  }
+}
+
+static void copy(char_T *dst, const char_T *src)
+{
+  (void)snprintf(dst, FSM_12B_CEX_TEXT, "%s", src);
+}
+
+void fsm_12B_cex_line(fsm_12B_CexParser *p, const char_T *line,
+                      fsm_12B_CexSink sink, void *arg)
+{
+  char_T buf[FSM_12B_CEX_LINE];
+  const char_T *s = line;
+  size_t n;
+  while ((*s == ' ') || (*s == '\t')) {
+    s++;
+  }
+
+  n = strlen(s);
+  while ((n > 0U) && ((s[n - 1U] == '\n') || (s[n - 1U] == '\r') || (s[n -
+           1U] == ' '))) {
+    n--;
+  }
+
+  if (n >= sizeof(buf)) {
+    n = sizeof(buf) - 1U;
+  }
+
+  memcpy(buf, s, n);
+  buf[n] = '\0';
+  if (strncmp(buf, "[Counterexample]", 16U) == 0) {
+    /* Only the first counterexample of a multi-property run */
+    if (p->section == BEFORE) {
+      p->section = TRACE;
+    } else {
+      fsm_12B_cex_end(p, sink, arg);
+    }
+
+    return;
+  }
+
+  switch (p->section) {
+   case TRACE:
+    if ((strncmp(buf, "State ", 6U) == 0) && (buf[6] >= '0') && (buf[6] <= '9'))
+    {
+      header(p, buf, sink, arg);
+    } else if (strncmp(buf, "Violated property:", 18U) == 0) {
+      if (p->model >= 0) {
+        emit(p, FSM_12B_CEX_RETURN, p->model, 0.0, sink, arg);
+        p->model = -1;
+      }
+
+      p->section = PROPERTY;
+    } else if ((buf[0] != '\0') && (buf[0] != '-')) {
+      assignment(p, buf, sink, arg);
+    }
+    break;
+
+   case PROPERTY:
+    if ((buf[0] == '\0') || (strncmp(buf, "VERIFICATION", 12U) == 0)) {
+      if (p->property_lines > 0) {
+        fsm_12B_cex_end(p, sink, arg);
+      }
+    } else if ((p->property_lines == 0) && (strncmp(buf, "file ", 5U) == 0)) {
+      const char_T *at = strstr(buf, " line ");
+      size_t fl = (at != NULL) ? (size_t)(at - buf - 5) : strlen(buf) - 5U;
+      (void)snprintf(p->file, sizeof(p->file), "%.*s", (int)fl, &buf[5]);
+      p->property_line = (at != NULL) ? atoi(at + 6) : 0;
+      p->property_lines++;
+    } else if (p->message[0] == '\0') {
+      copy(p->message, buf);
+      p->property_lines++;
+    } else if (p->condition[0] == '\0') {
+      copy(p->condition, buf);
+      p->property_lines++;
+    }
+    break;
+
+   default:
+    break;
+  }
+}
+
+void fsm_12B_cex_end(fsm_12B_CexParser *p, fsm_12B_CexSink sink, void *arg)
+{
+  if ((p->section == TRACE) && (p->model >= 0)) {
+    emit(p, FSM_12B_CEX_RETURN, p->model, 0.0, sink, arg);
+    p->model = -1;
+  }
+
+  if (p->section == PROPERTY) {
+    emit(p, FSM_12B_CEX_VIOLATION, 0, 0.0, sink, arg);
+  }
+
+  p->section = (p->section == BEFORE) ? BEFORE : DONE;
+}
+
+void fsm_12B_cex_replay_init(fsm_12B_CexReplay *r)
+{
+  memset(r, 0, sizeof(fsm_12B_CexReplay));
+  r->rtM.dwork = &r->rtDW;
+}
+
+static boolean_T same(int_T i, real_T a, real_T b)
+{
+  if (is_boolean(i)) {
+    return (a != 0.0) == (b != 0.0);
+  }
+
+  return (a == b) || (isnan(a) && isnan(b));
+}
+
+void fsm_12B_cex_replay(void *arg, const fsm_12B_CexEvent *ev)
+{
+  fsm_12B_CexReplay *r = (fsm_12B_CexReplay *)arg;
+  const boolean_T b = (ev->value != 0.0);
+  int_T i;
+  switch (ev->kind) {
+   case FSM_12B_CEX_INPUT:
+    if (ev->slot == 0) {
+      r->rtIn.rtU_standby = b;
+    } else if (ev->slot == 1) {
+      r->rtIn.rtU_apfail = b;
+    } else if (ev->slot == 2) {
+      r->rtIn.rtU_supported = b;
+    } else {
+      r->rtIn.rtU_limits = b;
+    }
+    break;
+
+   case FSM_12B_CEX_STATE:
+    fsm_12B_cex_set(&r->rtDW, ev->slot, ev->value);
+    break;
+
+   case FSM_12B_CEX_OVERRUN:
+    r->rtIn.OverrunFlag = b;
+    break;
+
+   case FSM_12B_CEX_OUTPUT:
+    r->rtY_pullup = b;
+    break;
+
+   case FSM_12B_CEX_CALL:
+    r->assigned = 0U;
+    if (ev->slot == 0) {
+      fsm_12B_initialize(&r->rtM);
+    } else {
+      r->pre = r->rtDW;
+      r->pre_in = r->rtIn;
+      fsm_12B_step(&r->rtM, r->rtIn.rtU_standby, r->rtIn.rtU_apfail,
+                   r->rtIn.rtU_supported, r->rtIn.rtU_limits, &r->rtY_pullup);
+      r->steps++;
+    }
+    break;
+
+   case FSM_12B_CEX_MODEL:
+    r->expected[ev->slot] = ev->value;
+    r->expected_state[ev->slot] = ev->state;
+    r->assigned |= 1U << ev->slot;
+    break;
+
+   case FSM_12B_CEX_RETURN:
+    for (i = 0; i <= FSM_12B_CEX_PULLUP; i++) {
+      const real_T native = (i == FSM_12B_CEX_PULLUP) ? (r->rtY_pullup ? 1.0 :
+        0.0) : fsm_12B_cex_get(&r->rtDW, i);
+      if (((r->assigned & (1U << i)) == 0U) || same(i, native,
+           r->expected[i])) {
+        continue;
+      }
+
+      if (r->mismatches == 0) {
+        (void)snprintf(r->mismatch, sizeof(r->mismatch), "%s %d: %s is %g "
+                       "natively but %g in the trace (state %d)", (ev->slot ==
+          0) ? "fsm_12B_initialize" : "step", r->steps,
+                       fsm_12B_cex_slot_name[i], native, r->expected[i],
+                       r->expected_state[i]);
+      }
+
+      r->mismatches++;
+    }
+
+    r->assigned = 0U;
+    break;
+
+   default:
+    break;
+  }
+}
+
+int_T fsm_12B_cex_requirement(const char_T *message)
+{
+  int_T i;
+  for (i = 0; i < FSM_12B_NUM_REQUIREMENTS; i++) {
+    const char_T *m = fsm_12B_requirements[i].message;
+    if (strncmp(message, m, strlen(m)) == 0) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+boolean_T fsm_12B_cex_violated(const fsm_12B_CexReplay *r, int_T i)
+{
+  const fsm_12B_Requirement *req = &fsm_12B_requirements[i];
+  return (r->steps > 0) && req->assume(&r->pre, &r->pre_in) && !req->check
+    (&r->rtDW, r->rtY_pullup);
+}
+
+/* A C literal that converts back to exactly v */
+static const char_T *literal(int_T i, real_T v, char_T *buf, size_t size)
+{
+  if (is_boolean(i) || (i == FSM_12B_CEX_PULLUP)) {
+    return (v != 0.0) ? "true" : "false";
+  }
+
+  if (isnan(v)) {
+    return "NAN";
+  }
+
+  if (isinf(v)) {
+    return (v > 0.0) ? "INFINITY" : "-INFINITY";
+  }
+
+  (void)snprintf(buf, size, "%.17g", v);
+  if (strpbrk(buf, ".e") == NULL) {
+    const size_t n = strlen(buf);
+    (void)snprintf(&buf[n], size - n, ".0");
+  }
+
+  return buf;
+}
+
+void fsm_12B_cex_test_begin(fsm_12B_CexTest *t, FILE *out, const char_T
+  *name, const char_T *source)
+{
+  t->out = out;
+  t->name = name;
+  t->steps = 0;
+  fprintf(out, "/*\n * File: %s\n *\n * Regression test from the ESBMC "
+          "counterexample in\n * %s.\n * It repeats the harness side of the "
+          "trace against fsm_12B.c and checks\n * the violated requirement on "
+          "the last step.\n *\n * Exit status: 0 the requirement holds, 1 it "
+          "is still violated.\n *\n * Generated by cex; do not edit.\n */\n\n",
+          name, source);
+  fprintf(out, "#include <math.h>\n#include <stdio.h>\n#include \"fsm_12B.h\"\n"
+          "#include \"fsm_12B_req.h\"\n#include \"rtwtypes.h\"\n\n"
+          "static RT_MODEL rtM_;\nstatic DW rtDW;\n"
+          "static DW rtPre;                       /* before the last step */\n"
+          "static fsm_12B_ReqInputs rtIn;\nstatic fsm_12B_ReqInputs rtPreIn;\n"
+          "static boolean_T rtY_pullup;\nstatic int_T steps;\n\n");
+  fprintf(out, "static void step(RT_MODEL *const rtM)\n{\n  rtPre = rtDW;\n"
+          "  rtPreIn = rtIn;\n  fsm_12B_step(rtM, rtIn.rtU_standby, "
+          "rtIn.rtU_apfail, rtIn.rtU_supported,\n               "
+          "rtIn.rtU_limits, &rtY_pullup);\n  steps++;\n}\n\n");
+  fprintf(out, "int_T main(void)\n{\n  RT_MODEL *const rtM = &rtM_;\n"
+          "  rtM->dwork = &rtDW;\n");
+}
+
+void fsm_12B_cex_test(void *arg, const fsm_12B_CexEvent *ev)
+{
+  fsm_12B_CexTest *t = (fsm_12B_CexTest *)arg;
+  char_T buf[64];
+  switch (ev->kind) {
+   case FSM_12B_CEX_INPUT:
+    fprintf(t->out, "  rtIn.%s = %s;\n", fsm_12B_cex_input_name[ev->slot],
+            (ev->value != 0.0) ? "true" : "false");
+    break;
+
+   case FSM_12B_CEX_STATE:
+    fprintf(t->out, "  rtDW.%s = %s;\n", fsm_12B_cex_slot_name[ev->slot],
+            literal(ev->slot, ev->value, buf, sizeof(buf)));
+    break;
+
+   case FSM_12B_CEX_OVERRUN:
+    fprintf(t->out, "  rtIn.OverrunFlag = %s;\n", (ev->value != 0.0) ? "true" :
+            "false");
+    break;
+
+   case FSM_12B_CEX_OUTPUT:
+    fprintf(t->out, "  rtY_pullup = %s;\n", (ev->value != 0.0) ? "true" :
+            "false");
+    break;
+
+   case FSM_12B_CEX_CALL:
+    if (ev->slot == 0) {
+      fprintf(t->out, "  fsm_12B_initialize(rtM);\n");
+    } else {
+      t->steps++;
+      fprintf(t->out, "  step(rtM);%*s/* step %d, state %d */\n", 28, "",
+              t->steps, ev->state);
+    }
+    break;
+
+   default:
+    break;
+  }
+}
+
+void fsm_12B_cex_test_end(fsm_12B_CexTest *t, const fsm_12B_CexParser *p)
+{
+  const int_T i = fsm_12B_cex_requirement(p->message);
+  if (i < 0) {
+    fprintf(t->out, "\n  /* The violated property has no native check */\n"
+            "  printf(\"replayed %%d steps\\n\", steps);\n  return 0;\n");
+  } else {
+    fprintf(t->out, "\n  /* Requirement %d, %s line %d */\n"
+            "  if ((steps > 0) && fsm_12B_requirements[%d].assume(&rtPre, "
+            "&rtPreIn) &&\n      !fsm_12B_requirements[%d].check(&rtDW, "
+            "rtY_pullup)) {\n    printf(\"FAIL: %%s\\n\", "
+            "fsm_12B_requirements[%d].message);\n    return 1;\n  }\n\n"
+            "  printf(\"PASS: requirement %d\\n\");\n  return 0;\n",
+            fsm_12B_requirements[i].id, p->file, p->property_line, i, i, i,
+            fsm_12B_requirements[i].id);
+  }
+
+  fprintf(t->out, "}\n\n/*\n * File trailer for %s\n *\n * [EOF]\n */\n",
+          t->name);
+}
+
+/*
+ * File trailer for fsm_12B_cex.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,140 @@
+/*
+ * File: fsm_12B_cex.h
+ *
+ * ESBMC counterexamples of the fsm_12B harnesses: a streaming parser, a
+ * native replayer and a regression test writer.
+ *
+ * The parser takes the verifier output one line at a time and keeps no
+ * more than the current state header, so a trace of any length is read in
+ * constant memory.  It turns the assignments of the counterexample into
+ * events: the harness setting an input, OverrunFlag, rtY_pullup or a field
+ * of rtDW; the trace entering or leaving fsm_12B_initialize or
+ * fsm_12B_step; the model assigning a field of DW or the output; and
+ * finally the violated property.  A state header whose function is a model
+ * function marks the call, since the trace shows no call itself.
+ *
+ * The replayer is an event sink.  It applies the harness assignments to a
+ * native DW and native inputs, runs the real fsm_12B_step where the trace
+ * enters it, and compares what the model assigned in the trace with the
+ * native state when the trace leaves the step.  The violation is
+ * confirmed when the requirement whose message the property carries
+ * (fsm_12B_req.h) fails natively on the last step.
+ *
+ * The test writer is another sink.  It writes a C program that repeats
+ * the harness side of the trace against fsm_12B.c and exits 1 while the
+ * requirement is still violated on it.
+ */
+
+#ifndef fsm_12B_cex_h_
+#define fsm_12B_cex_h_
+#include <stdio.h>
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+#include "fsm_12B_req.h"
+
+#define FSM_12B_CEX_LINE               4096
+#define FSM_12B_CEX_TEXT               512
+
+/* DW in declaration order, then the output */
+#define FSM_12B_CEX_SLOTS              8
+#define FSM_12B_CEX_PULLUP             8
+
+typedef enum {
+  FSM_12B_CEX_INPUT = 0,               /* rtU_<name> in the harness; slot 0-3 */
+  FSM_12B_CEX_STATE,                   /* rtDW field in the harness; slot */
+  FSM_12B_CEX_OVERRUN,                 /* OverrunFlag */
+  FSM_12B_CEX_OUTPUT,                  /* rtY_pullup in the harness */
+  FSM_12B_CEX_CALL,                    /* slot 0 initialize, 1 step */
+  FSM_12B_CEX_RETURN,
+  FSM_12B_CEX_MODEL,                   /* DW field or the output in the model */
+  FSM_12B_CEX_VIOLATION
+} fsm_12B_CexKind;
+
+typedef struct {
+  fsm_12B_CexKind kind;
+  int_T slot;
+  real_T value;
+  int_T state;                         /* number of the ESBMC state */
+  int_T line;                          /* its source line */
+} fsm_12B_CexEvent;
+
+typedef void (*fsm_12B_CexSink)(void *arg, const fsm_12B_CexEvent *ev);
+
+typedef struct {
+  int_T section;                       /* before, in, property, done */
+  int_T state;
+  int_T line;
+  int_T model;                         /* function: -1, 0 init, 1 step */
+  int_T property_lines;
+  int_T states;                        /* headers read */
+  int_T assignments;                   /* events for assignments sent */
+  int_T calls[2];
+  char_T file[FSM_12B_CEX_TEXT];       /* of the violated property */
+  int_T property_line;
+  char_T message[FSM_12B_CEX_TEXT];
+  char_T condition[FSM_12B_CEX_TEXT];
+} fsm_12B_CexParser;
+
+typedef struct {
+  RT_MODEL rtM;
+  DW rtDW;
+  fsm_12B_ReqInputs rtIn;
+  boolean_T rtY_pullup;
+  DW pre;                              /* before the last step */
+  fsm_12B_ReqInputs pre_in;
+  int_T steps;
+  uint32_T assigned;                   /* slots the model set in this step */
+  real_T expected[FSM_12B_CEX_SLOTS + 1];
+  int_T expected_state[FSM_12B_CEX_SLOTS + 1];
+  int_T mismatches;
+  char_T mismatch[FSM_12B_CEX_TEXT];   /* the first one */
+} fsm_12B_CexReplay;
+
+typedef struct {
+  FILE *out;
+  const char_T *name;
+  int_T steps;
+} fsm_12B_CexTest;
+
+extern const char_T *const fsm_12B_cex_slot_name[FSM_12B_CEX_SLOTS + 1];
+extern const char_T *const fsm_12B_cex_input_name[4];
+
+extern void fsm_12B_cex_init(fsm_12B_CexParser *p);
+
+/* Parse one line of verifier output (with or without its newline) */
+extern void fsm_12B_cex_line(fsm_12B_CexParser *p, const char_T *line,
+  fsm_12B_CexSink sink, void *arg);
+
+/* End of the output: closes a step still open */
+extern void fsm_12B_cex_end(fsm_12B_CexParser *p, fsm_12B_CexSink sink, void
+  *arg);
+
+/* Read and write slot i of rtDW (i < FSM_12B_CEX_SLOTS) */
+extern real_T fsm_12B_cex_get(const DW *rtDW, int_T i);
+extern void fsm_12B_cex_set(DW *rtDW, int_T i, real_T v);
+
+extern void fsm_12B_cex_replay_init(fsm_12B_CexReplay *r);
+extern void fsm_12B_cex_replay(void *arg, const fsm_12B_CexEvent *ev);
+
+/* Index into fsm_12B_requirements of the assertion message, or -1 */
+extern int_T fsm_12B_cex_requirement(const char_T *message);
+
+/*
+ * Does requirement i fail on the last replayed step?  False when nothing
+ * was stepped or the assumption does not hold.
+ */
+extern boolean_T fsm_12B_cex_violated(const fsm_12B_CexReplay *r, int_T i);
+
+extern void fsm_12B_cex_test_begin(fsm_12B_CexTest *t, FILE *out, const
+  char_T *name, const char_T *source);
+extern void fsm_12B_cex_test(void *arg, const fsm_12B_CexEvent *ev);
+extern void fsm_12B_cex_test_end(fsm_12B_CexTest *t, const fsm_12B_CexParser
+  *p);
+
+#endif                                 /* fsm_12B_cex_h_ */
+
+/*
+ * File trailer for fsm_12B_cex.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,120 @@
+/*
+ * File: fsm_12B_ckpt.c
+ *
+ * Checkpoints of RT_MODEL/DW for branching exploration of Simulink model
+ * 'fsm_12B'.
+ */
+
+#include <string.h>
+#include "fsm_12B_ckpt.h"
+#include "fsm_12B_state.h"
+#include "rtwtypes.h"
+
+#define FSM_12B_CKPT_MASK              ((uint32_T)FSM_12B_CKPT_INDEX_SIZE - 1U)
+
+void fsm_12B_ckpt_init(fsm_12B_CheckpointPool *pool)
+{
+  int32_T s;
+  memset(pool, 0, sizeof(fsm_12B_CheckpointPool));
+  for (s = 0; s < FSM_12B_CKPT_SLOTS; s++) {
+    pool->next_free[s] = (s + 1 < FSM_12B_CKPT_SLOTS) ? (s + 1) : -1;
+  }
+
+  pool->free_head = 0;
+}
+
+fsm_12B_Checkpoint fsm_12B_ckpt_snapshot(fsm_12B_CheckpointPool *pool, const
+  RT_MODEL *rtM)
+{
+  const DW *rtDW = rtM->dwork;
+  const uint64_T h = fsm_12B_dw_hash(rtDW);
+  uint32_T i = (uint32_T)h & FSM_12B_CKPT_MASK;
+  int32_T s;
+  pool->snapshots++;
+
+  /* Share the slot of an identical live state */
+  while (pool->index[i] != 0) {
+    s = pool->index[i] - 1;
+    if ((pool->hash[s] == h) && fsm_12B_dw_equal(&pool->state[s], rtDW)) {
+      pool->refs[s]++;
+      pool->shared++;
+      return s;
+    }
+
+    i = (i + 1U) & FSM_12B_CKPT_MASK;
+  }
+
+  s = pool->free_head;
+  if (s < 0) {
+    return -1;
+  }
+
+  pool->free_head = pool->next_free[s];
+  pool->state[s] = *rtDW;
+  pool->hash[s] = h;
+  pool->refs[s] = 1U;
+  pool->index[i] = s + 1;
+  pool->live++;
+  return s;
+}
+
+void fsm_12B_ckpt_restore(const fsm_12B_CheckpointPool *pool,
+  fsm_12B_Checkpoint c, RT_MODEL *const rtM)
+{
+  *rtM->dwork = pool->state[c];
+}
+
+fsm_12B_Checkpoint fsm_12B_ckpt_retain(fsm_12B_CheckpointPool *pool,
+  fsm_12B_Checkpoint c)
+{
+  pool->refs[c]++;
+  return c;
+}
+
+void fsm_12B_ckpt_release(fsm_12B_CheckpointPool *pool, fsm_12B_Checkpoint c)
+{
+  uint32_T i;
+  uint32_T j;
+  if (--pool->refs[c] != 0U) {
+    return;
+  }
+
+  /* Find the index entry of slot c */
+  i = (uint32_T)pool->hash[c] & FSM_12B_CKPT_MASK;
+  while (pool->index[i] != c + 1) {
+    i = (i + 1U) & FSM_12B_CKPT_MASK;
+  }
+
+  /* Backward-shift deletion keeps every probe sequence unbroken */
+  j = i;
+  for (;;) {
+    uint32_T home;
+    j = (j + 1U) & FSM_12B_CKPT_MASK;
+    if (pool->index[j] == 0) {
+      break;
+    }
+
+    home = (uint32_T)pool->hash[pool->index[j] - 1] & FSM_12B_CKPT_MASK;
+    if (((j - home) & FSM_12B_CKPT_MASK) >= ((j - i) & FSM_12B_CKPT_MASK)) {
+      pool->index[i] = pool->index[j];
+      i = j;
+    }
+  }
+
+  pool->index[i] = 0;
+  pool->next_free[c] = pool->free_head;
+  pool->free_head = c;
+  pool->live--;
+}
+
+uint64_T fsm_12B_ckpt_hash(const fsm_12B_CheckpointPool *pool,
+  fsm_12B_Checkpoint c)
+{
+  return pool->hash[c];
+}
+
+/*
+ * File trailer for fsm_12B_ckpt.c
+ *
+ * [EOF]
+ */
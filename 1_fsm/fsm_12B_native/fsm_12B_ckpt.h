@@ -0,0 +1,71 @@
+/*
+ * File: fsm_12B_ckpt.h
+ *
+ * Checkpoints of RT_MODEL/DW for branching exploration of Simulink model
+ * 'fsm_12B'.
+ *
+ * A checkpoint pool is a fixed array of reference-counted DW slots plus a
+ * hash index over their contents.  Snapshotting a state that some slot
+ * already holds, for instance a branch that has not changed since it was
+ * forked or two branches that reached the same state, only takes another
+ * reference to that slot, so identical states are stored once.  A slot is
+ * never written while referenced; restoring copies it into the model.
+ * Snapshot, restore, retain and release are all O(1).
+ */
+
+#ifndef fsm_12B_ckpt_h_
+#define fsm_12B_ckpt_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+
+#ifndef FSM_12B_CKPT_SLOTS
+#define FSM_12B_CKPT_SLOTS             4096 /* maximum distinct live states */
+#endif
+
+#define FSM_12B_CKPT_INDEX_SIZE        (2 * FSM_12B_CKPT_SLOTS) /* power of two */
+
+/* Checkpoint handle, -1 when none */
+typedef int32_T fsm_12B_Checkpoint;
+
+typedef struct {
+  DW state[FSM_12B_CKPT_SLOTS];
+  uint64_T hash[FSM_12B_CKPT_SLOTS];
+  uint32_T refs[FSM_12B_CKPT_SLOTS];   /* 0 for a free slot */
+  int32_T next_free[FSM_12B_CKPT_SLOTS];
+  int32_T index[FSM_12B_CKPT_INDEX_SIZE];/* slot + 1, 0 when empty */
+  int32_T free_head;
+  uint32_T live;                       /* slots in use */
+  uint64_T snapshots;                  /* fsm_12B_ckpt_snapshot calls */
+  uint64_T shared;                     /* of which deduplicated */
+} fsm_12B_CheckpointPool;
+
+extern void fsm_12B_ckpt_init(fsm_12B_CheckpointPool *pool);
+
+/*
+ * Take a checkpoint of rtM->dwork.  Returns a handle holding one
+ * reference, or -1 when every slot holds a different live state.
+ */
+extern fsm_12B_Checkpoint fsm_12B_ckpt_snapshot(fsm_12B_CheckpointPool *pool,
+  const RT_MODEL *rtM);
+
+/* Copy checkpoint c into rtM->dwork; c stays valid */
+extern void fsm_12B_ckpt_restore(const fsm_12B_CheckpointPool *pool,
+  fsm_12B_Checkpoint c, RT_MODEL *const rtM);
+
+/* Add or drop one reference; the slot is recycled at zero */
+extern fsm_12B_Checkpoint fsm_12B_ckpt_retain(fsm_12B_CheckpointPool *pool,
+  fsm_12B_Checkpoint c);
+extern void fsm_12B_ckpt_release(fsm_12B_CheckpointPool *pool,
+  fsm_12B_Checkpoint c);
+
+/* 64-bit hash of the checkpointed state, equal to fsm_12B_dw_hash */
+extern uint64_T fsm_12B_ckpt_hash(const fsm_12B_CheckpointPool *pool,
+  fsm_12B_Checkpoint c);
+
+#endif                                 /* fsm_12B_ckpt_h_ */
+
+/*
+ * File trailer for fsm_12B_ckpt.h
+ *
+ * [EOF]
+ */
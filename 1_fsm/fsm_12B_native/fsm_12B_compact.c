@@ -0,0 +1,229 @@
+/*
+ * File: fsm_12B_compact.c
+ *
+ * Compact state encoding of Simulink model 'fsm_12B'.
+ *
+ * fsm_12B_compact_step follows fsm_12B_step block for block, with each
+ * floating-point If chain replaced by a switch on the 2-bit mode.  A Sen
+ * mode of 3 has no action subsystem and keeps its Merge, just as 3.0 does
+ * in the generated code, so the two step functions agree on every DW that
+ * fsm_12B_compact_from_dw accepts.
+ */
+
+#include "fsm_12B_compact.h"
+#include "rtwtypes.h"
+
+/* Pack one DW_Compact from unpacked fields */
+static uint16_T fsm_12B_compact_pack(uint32_T Merge, uint32_T Merge_g, uint32_T
+  UnitDelay, uint32_T UnitDelay1, uint32_T Merge_p0, uint32_T Merge_p1, uint32_T
+  Merge_p2, uint32_T UnitDelay2)
+{
+  return (uint16_T)((Merge << FSM_12B_C_MERGE_SHIFT) | (Merge_g <<
+    FSM_12B_C_MERGE_G_SHIFT) | (UnitDelay << FSM_12B_C_UNITDELAY_SHIFT) |
+                    (UnitDelay1 << FSM_12B_C_UNITDELAY1_SHIFT) | (Merge_p0 <<
+    FSM_12B_C_MERGE_P_SHIFT) | (Merge_p1 << (FSM_12B_C_MERGE_P_SHIFT + 1U)) |
+                    (Merge_p2 << (FSM_12B_C_MERGE_P_SHIFT + 2U)) | (UnitDelay2 <<
+    FSM_12B_C_UNITDELAY2_SHIFT));
+}
+
+/* Model step function, compact storage */
+void fsm_12B_compact_step(DW_Compact *rtDWc, boolean_T rtU_standby, boolean_T
+  rtU_apfail, boolean_T rtU_supported, boolean_T rtU_limits, boolean_T
+  *rtY_pullup)
+{
+  const uint32_T UnitDelay = FSM_12B_C_UNITDELAY(rtDWc);
+  const uint32_T UnitDelay1 = FSM_12B_C_UNITDELAY1(rtDWc);
+  const boolean_T UnitDelay2 = (boolean_T)FSM_12B_C_UNITDELAY2(rtDWc);
+  uint32_T Merge;
+  uint32_T Merge_g = FSM_12B_C_MERGE_G(rtDWc);
+  uint32_T Merge_p0;
+  uint32_T Merge_p1;
+  uint32_T Merge_p2;
+
+  /* If: '<S4>/If' incorporates:
+   *  UnitDelay: '<S1>/Unit Delay'
+   */
+  switch (UnitDelay) {
+   case fsm_12B_Transition:
+    /* Switch: '<S9>/Switch2' */
+    if (rtU_standby) {
+      Merge = fsm_12B_Standby;
+    } else if (rtU_supported && UnitDelay2) {
+      Merge = fsm_12B_Nominal;
+    } else {
+      Merge = UnitDelay;
+    }
+    break;
+
+   case fsm_12B_Nominal:
+    /* Switch: '<S7>/Switch2' */
+    if (rtU_standby) {
+      Merge = fsm_12B_Standby;
+    } else if (!UnitDelay2) {
+      Merge = fsm_12B_Maneuver;
+    } else {
+      Merge = fsm_12B_Nominal;
+    }
+    break;
+
+   case fsm_12B_Maneuver:
+    /* Switch: '<S6>/Switch2' */
+    if (rtU_standby && UnitDelay2) {
+      Merge = fsm_12B_Standby;
+    } else if (rtU_supported && UnitDelay2) {
+      Merge = fsm_12B_Transition;
+    } else {
+      Merge = fsm_12B_Maneuver;
+    }
+    break;
+
+   default:
+    /* Switch: '<S8>/Switch2' */
+    if (rtU_apfail) {
+      Merge = fsm_12B_Maneuver;
+    } else if (!rtU_standby) {
+      Merge = fsm_12B_Transition;
+    } else {
+      Merge = fsm_12B_Standby;
+    }
+    break;
+  }
+
+  /* If: '<S5>/If' */
+  switch (Merge) {
+   case fsm_12B_Transition:
+    Merge_p0 = 0U;
+    Merge_p1 = 1U;
+    Merge_p2 = 0U;
+    break;
+
+   case fsm_12B_Nominal:
+    Merge_p0 = 1U;
+    Merge_p1 = 1U;
+    Merge_p2 = 0U;
+    break;
+
+   case fsm_12B_Maneuver:
+    Merge_p0 = 1U;
+    Merge_p1 = 0U;
+    Merge_p2 = 1U;
+    break;
+
+   default:
+    Merge_p0 = 1U;
+    Merge_p1 = 0U;
+    Merge_p2 = 0U;
+    break;
+  }
+
+  /* If: '<S14>/If' incorporates:
+   *  UnitDelay: '<S1>/Unit Delay1'
+   */
+  switch (UnitDelay1) {
+   case fsm_12B_SenNominal:
+    /* Switch: '<S17>/Switch2' */
+    if (rtU_limits) {
+      Merge_g = fsm_12B_SenFault;
+    } else if (!Merge_p1) {
+      Merge_g = fsm_12B_SenTransition;
+    } else {
+      Merge_g = UnitDelay1;
+    }
+    break;
+
+   case fsm_12B_SenTransition:
+    /* Switch: '<S18>/Switch1' */
+    if (Merge_p0 && Merge_p1) {
+      Merge_g = fsm_12B_SenNominal;
+    } else {
+      Merge_g = fsm_12B_SenTransition;
+    }
+    break;
+
+   case fsm_12B_SenFault:
+    /* Switch: '<S16>/Switch1' */
+    if ((!Merge_p1) || (!rtU_limits)) {
+      Merge_g = fsm_12B_SenTransition;
+    } else {
+      Merge_g = fsm_12B_SenFault;
+    }
+    break;
+
+   default:
+    break;
+  }
+
+  /* Outport: '<Root>/pullup' */
+  *rtY_pullup = (boolean_T)Merge_p2;
+
+  /* Update for UnitDelay: '<S1>/Unit Delay', '<S1>/Unit Delay1' and
+   * '<S1>/Unit Delay2'
+   */
+  rtDWc->bits = fsm_12B_compact_pack(Merge, Merge_g, Merge, Merge_g, Merge_p0,
+    Merge_p1, Merge_p2, (uint32_T)(Merge_g != fsm_12B_SenFault));
+}
+
+/* Model initialize function, compact storage */
+void fsm_12B_compact_initialize(DW_Compact *rtDWc)
+{
+  /* InitializeConditions for UnitDelay: '<S1>/Unit Delay2' */
+  rtDWc->bits = fsm_12B_compact_pack(0U, 0U, 0U, 0U, 0U, 0U, 0U, 1U);
+}
+
+/* Map 0.0, 1.0, 2.0, 3.0 to 0..3 and anything else to 4 */
+static uint32_T fsm_12B_compact_mode(real_T x)
+{
+  uint32_T mode;
+  if (x == 0.0) {
+    mode = 0U;
+  } else if (x == 1.0) {
+    mode = 1U;
+  } else if (x == 2.0) {
+    mode = 2U;
+  } else if (x == 3.0) {
+    mode = 3U;
+  } else {
+    mode = 4U;
+  }
+
+  return mode;
+}
+
+boolean_T fsm_12B_compact_from_dw(const DW *rtDW, DW_Compact *rtDWc)
+{
+  const uint32_T Merge = fsm_12B_compact_mode(rtDW->Merge);
+  const uint32_T Merge_g = fsm_12B_compact_mode(rtDW->Merge_g);
+  const uint32_T UnitDelay = fsm_12B_compact_mode(rtDW->UnitDelay_DSTATE);
+  const uint32_T UnitDelay1 = fsm_12B_compact_mode(rtDW->UnitDelay1_DSTATE);
+  if ((Merge > 3U) || (Merge_g > 3U) || (UnitDelay > 3U) || (UnitDelay1 > 3U)) {
+    return false;
+  }
+
+  if ((rtDW->Merge_p[0] > 1U) || (rtDW->Merge_p[1] > 1U) || (rtDW->Merge_p[2] >
+       1U) || (rtDW->UnitDelay2_DSTATE > 1U)) {
+    return false;
+  }
+
+  rtDWc->bits = fsm_12B_compact_pack(Merge, Merge_g, UnitDelay, UnitDelay1,
+    rtDW->Merge_p[0], rtDW->Merge_p[1], rtDW->Merge_p[2],
+    rtDW->UnitDelay2_DSTATE);
+  return true;
+}
+
+void fsm_12B_compact_to_dw(const DW_Compact *rtDWc, DW *rtDW)
+{
+  rtDW->Merge = (real_T)FSM_12B_C_MERGE(rtDWc);
+  rtDW->Merge_g = (real_T)FSM_12B_C_MERGE_G(rtDWc);
+  rtDW->UnitDelay_DSTATE = (real_T)FSM_12B_C_UNITDELAY(rtDWc);
+  rtDW->UnitDelay1_DSTATE = (real_T)FSM_12B_C_UNITDELAY1(rtDWc);
+  rtDW->Merge_p[0] = (boolean_T)FSM_12B_C_MERGE_P(rtDWc, 0);
+  rtDW->Merge_p[1] = (boolean_T)FSM_12B_C_MERGE_P(rtDWc, 1);
+  rtDW->Merge_p[2] = (boolean_T)FSM_12B_C_MERGE_P(rtDWc, 2);
+  rtDW->UnitDelay2_DSTATE = (boolean_T)FSM_12B_C_UNITDELAY2(rtDWc);
+}
+
+/*
+ * File trailer for fsm_12B_compact.c
+ *
+ * [EOF]
+ */
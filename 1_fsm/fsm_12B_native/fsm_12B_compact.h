@@ -0,0 +1,84 @@
+/*
+ * File: fsm_12B_compact.h
+ *
+ * Compact state encoding of Simulink model 'fsm_12B'.
+ *
+ * DW_Compact carries every field of DW in one uint16_T: the four discrete
+ * modes as 2-bit enums and the five boolean states as single bits.  It
+ * replaces the 40-byte DW for applications that hold very many instances
+ * and are bound by memory bandwidth.  The encoding keeps the value of each
+ * mode but not the sign of zero: a -0.0 mode decodes as +0.0.  The model
+ * only compares modes with == and copies them, so it steps both alike;
+ * fsm_12B_step itself never produces -0.0.
+ *
+ *   bits  0..1   Merge               '<S4>/Merge'
+ *   bits  2..3   Merge_g             '<S14>/Merge'
+ *   bits  4..5   UnitDelay_DSTATE    '<S1>/Unit Delay'
+ *   bits  6..7   UnitDelay1_DSTATE   '<S1>/Unit Delay1'
+ *   bits  8..10  Merge_p[0..2]       '<S5>/Merge'
+ *   bit   11     UnitDelay2_DSTATE   '<S1>/Unit Delay2'
+ */
+
+#ifndef fsm_12B_compact_h_
+#define fsm_12B_compact_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+
+/* Manager modes, '<S4>/Merge' and '<S1>/Unit Delay' */
+typedef enum {
+  fsm_12B_Transition = 0,
+  fsm_12B_Nominal = 1,
+  fsm_12B_Maneuver = 2,
+  fsm_12B_Standby = 3
+} fsm_12B_Mode;
+
+/* Sen modes, '<S14>/Merge' and '<S1>/Unit Delay1' */
+typedef enum {
+  fsm_12B_SenNominal = 0,
+  fsm_12B_SenTransition = 1,
+  fsm_12B_SenFault = 2
+} fsm_12B_SenMode;
+
+/* Block signals and states (compact storage) for system '<Root>' */
+typedef struct {
+  uint16_T bits;
+} DW_Compact;
+
+#define FSM_12B_C_MERGE_SHIFT          0U
+#define FSM_12B_C_MERGE_G_SHIFT        2U
+#define FSM_12B_C_UNITDELAY_SHIFT      4U
+#define FSM_12B_C_UNITDELAY1_SHIFT     6U
+#define FSM_12B_C_MERGE_P_SHIFT        8U
+#define FSM_12B_C_UNITDELAY2_SHIFT     11U
+
+/* Field access */
+#define FSM_12B_C_GET(dwc, shift, width) ((uint32_T)(((dwc)->bits >> (shift)) & ((1U << (width)) - 1U)))
+#define FSM_12B_C_MERGE(dwc)           FSM_12B_C_GET((dwc), FSM_12B_C_MERGE_SHIFT, 2U)
+#define FSM_12B_C_MERGE_G(dwc)         FSM_12B_C_GET((dwc), FSM_12B_C_MERGE_G_SHIFT, 2U)
+#define FSM_12B_C_UNITDELAY(dwc)       FSM_12B_C_GET((dwc), FSM_12B_C_UNITDELAY_SHIFT, 2U)
+#define FSM_12B_C_UNITDELAY1(dwc)      FSM_12B_C_GET((dwc), FSM_12B_C_UNITDELAY1_SHIFT, 2U)
+#define FSM_12B_C_MERGE_P(dwc, k)      FSM_12B_C_GET((dwc), FSM_12B_C_MERGE_P_SHIFT + (uint32_T)(k), 1U)
+#define FSM_12B_C_UNITDELAY2(dwc)      FSM_12B_C_GET((dwc), FSM_12B_C_UNITDELAY2_SHIFT, 1U)
+
+/* Model entry point functions, compact storage */
+extern void fsm_12B_compact_initialize(DW_Compact *rtDWc);
+extern void fsm_12B_compact_step(DW_Compact *rtDWc, boolean_T rtU_standby,
+  boolean_T rtU_apfail, boolean_T rtU_supported, boolean_T rtU_limits,
+  boolean_T *rtY_pullup);
+
+/*
+ * Conversion to and from DW.  fsm_12B_compact_from_dw returns false when a
+ * mode is not one of 0.0, 1.0, 2.0, 3.0 or a boolean state is neither
+ * false nor true; rtDWc is left untouched in that case.  -0.0 is accepted
+ * as 0.0, so fsm_12B_compact_to_dw gives it back as +0.0.
+ */
+extern boolean_T fsm_12B_compact_from_dw(const DW *rtDW, DW_Compact *rtDWc);
+extern void fsm_12B_compact_to_dw(const DW_Compact *rtDWc, DW *rtDW);
+
+#endif                                 /* fsm_12B_compact_h_ */
+
+/*
+ * File trailer for fsm_12B_compact.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,437 @@
+/*
+ * File: fsm_12B_domain.c
+ *
+ * Domain derivation and injection of fsm_12B_domain.h.
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B.h"
+#include "fsm_12B_domain.h"
+#include "fsm_12B_explore.h"
+#include "rtwtypes.h"
+
+#define MAX_COPIES                     16
+
+static const char_T *const fsm_12B_domain_name[FSM_12B_DOMAIN_FIELDS] = {
+  "Merge", "Merge_g", "UnitDelay_DSTATE", "UnitDelay1_DSTATE" };
+
+static const size_t fsm_12B_domain_offset[FSM_12B_DOMAIN_FIELDS] = { offsetof
+  (DW, Merge), offsetof(DW, Merge_g), offsetof(DW, UnitDelay_DSTATE), offsetof
+  (DW, UnitDelay1_DSTATE) };
+
+static void init(fsm_12B_Domain *d)
+{
+  int_T i;
+  memset(d, 0, sizeof(fsm_12B_Domain));
+  for (i = 0; i < FSM_12B_DOMAIN_FIELDS; i++) {
+    d->f[i].field = fsm_12B_domain_name[i];
+    d->f[i].bounded = true;
+  }
+}
+
+/* Add v to the domain; -0.0 counts as 0.0, as it does for == */
+static boolean_T add(fsm_12B_DomainField *f, real_T v)
+{
+  int_T j;
+  if (!f->bounded) {
+    return false;
+  }
+
+  if (isnan(v) || isinf(v) || (f->n == FSM_12B_DOMAIN_MAX_VALUES)) {
+    f->bounded = false;
+    return true;
+  }
+
+  for (j = 0; j < f->n; j++) {
+    if (f->value[j] == v) {
+      return false;
+    }
+  }
+
+  for (j = f->n; (j > 0) && (f->value[j - 1] > v); j--) {
+    f->value[j] = f->value[j - 1];
+  }
+
+  f->value[j] = (v == 0.0) ? 0.0 : v;
+  f->n++;
+  return true;
+}
+
+int_T fsm_12B_domain_explore(fsm_12B_Domain *d)
+{
+  fsm_12B_Explorer *ex = (fsm_12B_Explorer *)malloc(sizeof(fsm_12B_Explorer));
+  fsm_12B_ExploreResult results[FSM_12B_NUM_REQUIREMENTS];
+  int_T s;
+  int_T i;
+  init(d);
+  if ((ex == NULL) || (fsm_12B_explore(ex, results) != 0)) {
+    free(ex);
+    return -1;
+  }
+
+  for (s = 0; s < ex->count; s++) {
+    const uint8_T *p = (const uint8_T *)&ex->state[s];
+    for (i = 0; i < FSM_12B_DOMAIN_FIELDS; i++) {
+      real_T v;
+      memcpy(&v, p + fsm_12B_domain_offset[i], sizeof(real_T));
+      (void)add(&d->f[i], v);
+    }
+  }
+
+  free(ex);
+  return 0;
+}
+
+static boolean_T is_ident(char_T c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >=
+    '0') && (c <= '9')) || (c == '_');
+}
+
+/* Field named by "rtDW->name" or "rtDW.name" at t[i], or -1; *end after it */
+static int_T field_at(const fsm_12B_Domain *d, const char_T *t, size_t n,
+                      size_t i, size_t *end)
+{
+  char_T name[64];
+  size_t len = 0U;
+  if ((i > 0U) && is_ident(t[i - 1U])) {
+    return -1;
+  }
+
+  if ((i + 6U <= n) && (strncmp(&t[i], "rtDW->", 6) == 0)) {
+    i += 6U;
+  } else if ((i + 5U <= n) && (strncmp(&t[i], "rtDW.", 5) == 0)) {
+    i += 5U;
+  } else {
+    return -1;
+  }
+
+  while ((i < n) && is_ident(t[i]) && (len + 1U < sizeof(name))) {
+    name[len++] = t[i++];
+  }
+
+  name[len] = '\0';
+  *end = i;
+  return fsm_12B_domain_find(d, name);
+}
+
+static size_t skip_space(const char_T *t, size_t n, size_t i)
+{
+  while ((i < n) && ((t[i] == ' ') || (t[i] == '\t') || (t[i] == '\r') || (t[i]
+           == '\n'))) {
+    i++;
+  }
+
+  return i;
+}
+
+void fsm_12B_domain_model(fsm_12B_Domain *d, const char_T *text, size_t len)
+{
+  int_T copy[MAX_COPIES][2];
+  int_T ncopies = 0;
+  boolean_T changed = true;
+  size_t i;
+  int_T c;
+  init(d);
+
+  /* Static initialization */
+  for (c = 0; c < FSM_12B_DOMAIN_FIELDS; c++) {
+    (void)add(&d->f[c], 0.0);
+  }
+
+  for (i = 0U; i < len; i++) {
+    size_t p;
+    size_t q;
+    size_t e;
+    int_T dst = field_at(d, text, len, i, &p);
+    int_T src;
+    char_T rhs[64];
+    char_T *end;
+    real_T v;
+    if (dst < 0) {
+      continue;
+    }
+
+    p = skip_space(text, len, p);
+    if ((p + 1U >= len) || (text[p] != '=') || (text[p + 1U] == '=')) {
+      continue;
+    }
+
+    /* The right-hand side, up to ';' */
+    q = skip_space(text, len, p + 1U);
+    e = q;
+    while ((e < len) && (text[e] != ';')) {
+      e++;
+    }
+
+    while ((e > q) && ((text[e - 1U] == ' ') || (text[e - 1U] == '\n'))) {
+      e--;
+    }
+
+    if (e - q >= sizeof(rhs)) {
+      d->f[dst].bounded = false;
+      continue;
+    }
+
+    memcpy(rhs, &text[q], e - q);
+    rhs[e - q] = '\0';
+    v = strtod(rhs, &end);
+    if ((end != rhs) && (*end == '\0')) {
+      (void)add(&d->f[dst], v);
+    } else if (((src = field_at(d, rhs, e - q, 0U, &p)) >= 0) && (p == e - q) &&
+               (ncopies < MAX_COPIES)) {
+      copy[ncopies][0] = dst;
+      copy[ncopies][1] = src;
+      ncopies++;
+    } else {
+      d->f[dst].bounded = false;
+    }
+  }
+
+  /* Close over the copies between fields */
+  while (changed) {
+    changed = false;
+    for (c = 0; c < ncopies; c++) {
+      fsm_12B_DomainField *to = &d->f[copy[c][0]];
+      const fsm_12B_DomainField *from = &d->f[copy[c][1]];
+      int_T j;
+      if (!from->bounded) {
+        changed = changed || to->bounded;
+        to->bounded = false;
+        continue;
+      }
+
+      for (j = 0; j < from->n; j++) {
+        changed = add(to, from->value[j]) || changed;
+      }
+    }
+  }
+}
+
+int_T fsm_12B_domain_find(const fsm_12B_Domain *d, const char_T *field)
+{
+  int_T i;
+  for (i = 0; i < FSM_12B_DOMAIN_FIELDS; i++) {
+    if (strcmp(d->f[i].field, field) == 0) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/* Append to buf at *pos, as snprintf, counting what does not fit */
+static void put(char_T *buf, size_t size, size_t *pos, const char_T *s)
+{
+  const size_t n = strlen(s);
+  if (*pos < size) {
+    (void)snprintf(&buf[*pos], size - *pos, "%s", s);
+  }
+
+  *pos += n;
+}
+
+int_T fsm_12B_domain_format(const fsm_12B_Domain *d, int_T i, const char_T
+  *lvalue, char_T *buf, size_t size)
+{
+  const fsm_12B_DomainField *f = &d->f[i];
+  char_T lit[64];
+  size_t pos = 0U;
+  boolean_T small = true;
+  boolean_T contiguous = true;
+  int_T j;
+  if (size > 0U) {
+    buf[0] = '\0';
+  }
+
+  if (!f->bounded || (f->n == 0)) {
+    put(buf, size, &pos, lvalue);
+    put(buf, size, &pos, " = nondet_double();");
+    return (int_T)pos;
+  }
+
+  for (j = 0; j < f->n; j++) {
+    small = small && (f->value[j] >= 0.0) && (f->value[j] <= 255.0) &&
+      (f->value[j] == floor(f->value[j]));
+    contiguous = contiguous && ((j == 0) || (f->value[j] == f->value[j - 1] +
+      1.0));
+  }
+
+  if (d->integer && small) {
+    put(buf, size, &pos, "{ unsigned char nondet_uchar(); uint8_T dom_v = "
+        "nondet_uchar(); __ESBMC_assume(");
+    if (contiguous && (f->value[0] == 0.0)) {
+      (void)snprintf(lit, sizeof(lit), "dom_v <= %dU", (int_T)f->value[f->n -
+                     1]);
+      put(buf, size, &pos, lit);
+    } else if (contiguous) {
+      (void)snprintf(lit, sizeof(lit), "dom_v >= %dU && dom_v <= %dU", (int_T)
+                     f->value[0], (int_T)f->value[f->n - 1]);
+      put(buf, size, &pos, lit);
+    } else {
+      for (j = 0; j < f->n; j++) {
+        (void)snprintf(lit, sizeof(lit), "%sdom_v == %dU", (j == 0) ? "" :
+                       " || ", (int_T)f->value[j]);
+        put(buf, size, &pos, lit);
+      }
+    }
+
+    put(buf, size, &pos, "); ");
+    put(buf, size, &pos, lvalue);
+    put(buf, size, &pos, " = (real_T)dom_v; }");
+    return (int_T)pos;
+  }
+
+  put(buf, size, &pos, lvalue);
+  put(buf, size, &pos, " = nondet_double(); __ESBMC_assume(");
+  for (j = 0; j < f->n; j++) {
+    if (f->value[j] == floor(f->value[j])) {
+      (void)snprintf(lit, sizeof(lit), "%.1f", f->value[j]);
+    } else {
+      (void)snprintf(lit, sizeof(lit), "%.17g", f->value[j]);
+    }
+
+    if (j > 0) {
+      put(buf, size, &pos, " || ");
+    }
+
+    put(buf, size, &pos, lvalue);
+    put(buf, size, &pos, " == ");
+    put(buf, size, &pos, lit);
+  }
+
+  put(buf, size, &pos, ");");
+  return (int_T)pos;
+}
+
+/* Append n bytes to *out; false when out of memory */
+static boolean_T append(char_T **out, size_t *len, size_t *cap, const char_T
+  *p, size_t n)
+{
+  if (*len + n + 1U > *cap) {
+    const size_t want = 2U * (*len + n + 1U);
+    char_T *grown = (char_T *)realloc(*out, want);
+    if (grown == NULL) {
+      return false;
+    }
+
+    *out = grown;
+    *cap = want;
+  }
+
+  memcpy(&(*out)[*len], p, n);
+  *len += n;
+  (*out)[*len] = '\0';
+  return true;
+}
+
+/* End of "= nondet_double ( ) ;" starting at i, or 0 */
+static size_t nondet_assignment(const char_T *t, size_t n, size_t i)
+{
+  static const char_T *const token[5] = { "=", "nondet_double", "(", ")", ";" };
+
+  int_T k;
+  for (k = 0; k < 5; k++) {
+    const size_t tl = strlen(token[k]);
+    i = skip_space(t, n, i);
+    if ((i + tl > n) || (strncmp(&t[i], token[k], tl) != 0) || ((k == 0) && (i
+          + 1U < n) && (t[i + 1U] == '='))) {
+      return 0U;
+    }
+
+    i += tl;
+  }
+
+  return i;
+}
+
+char_T *fsm_12B_domain_inject(const fsm_12B_Domain *d, const char_T *text,
+  size_t len, size_t *outlen, int_T *count)
+{
+  char_T line[2048];
+  char_T lvalue[96];
+  char_T *out = NULL;
+  size_t cap = 0U;
+  size_t n = 0U;
+  size_t copied = 0U;
+  size_t i = 0U;
+  boolean_T ok = append(&out, &n, &cap, "", 0U);
+  *count = 0;
+  while (ok && (i < len)) {
+    size_t p;
+    size_t end;
+    size_t j;
+    int_T f;
+    if ((text[i] == '/') && (i + 1U < len) && (text[i + 1U] == '/')) {
+      while ((i < len) && (text[i] != '\n')) {
+        i++;
+      }
+
+      continue;
+    }
+
+    if ((text[i] == '/') && (i + 1U < len) && (text[i + 1U] == '*')) {
+      i += 2U;
+      while ((i + 1U < len) && !((text[i] == '*') && (text[i + 1U] == '/'))) {
+        i++;
+      }
+
+      i += 2U;
+      continue;
+    }
+
+    if ((text[i] == '"') || (text[i] == '\'')) {
+      const char_T quote = text[i++];
+      while ((i < len) && (text[i] != quote) && (text[i] != '\n')) {
+        i += (text[i] == '\\') ? 2U : 1U;
+      }
+
+      i++;
+      continue;
+    }
+
+    f = field_at(d, text, len, i, &p);
+    end = (f >= 0) ? nondet_assignment(text, len, p) : 0U;
+    if ((end == 0U) || (snprintf(lvalue, sizeof(lvalue), "rtDW.%s",
+          d->f[f].field) < 0) || (fsm_12B_domain_format(d, f, lvalue, line,
+          sizeof(line)) >= (int_T)sizeof(line))) {
+      i++;
+      continue;
+    }
+
+    /* The replacement is one line; keep any line breaks of the original */
+    ok = append(&out, &n, &cap, &text[copied], i - copied) && append(&out, &n,
+      &cap, line, strlen(line));
+    for (j = i; ok && (j < end); j++) {
+      if (text[j] == '\n') {
+        ok = append(&out, &n, &cap, "\n", 1U);
+      }
+    }
+
+    (*count)++;
+    copied = end;
+    i = end;
+  }
+
+  if (ok && (copied < len)) {
+    ok = append(&out, &n, &cap, &text[copied], len - copied);
+  }
+
+  if (!ok) {
+    free(out);
+    return NULL;
+  }
+
+  *outlen = n;
+  return out;
+}
+
+/*
+ * File trailer for fsm_12B_domain.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,69 @@
+/*
+ * File: fsm_12B_domain.h
+ *
+ * Value domains of the real_T fields of DW, and harness rewriting that
+ * assumes them.
+ *
+ * fsm_12B_step compares and assigns its modes only as 0.0 to 3.0, but a
+ * harness that seeds rtDW.Merge with nondet_double() makes the solver
+ * search every IEEE-754 value.  A domain is the finite set of values a
+ * field can hold.  It comes either from the explicit-state explorer (the
+ * values in reachable states) or from the constants of fsm_12B.c (every
+ * literal assigned to the field, closed over the copies between fields,
+ * plus the 0.0 of static initialization).
+ */
+
+#ifndef fsm_12B_domain_h_
+#define fsm_12B_domain_h_
+#include <stddef.h>
+#include "rtwtypes.h"
+
+#define FSM_12B_DOMAIN_FIELDS          4
+#define FSM_12B_DOMAIN_MAX_VALUES      32
+
+typedef struct {
+  const char_T *field;                 /* name in DW, e.g. "Merge" */
+  boolean_T bounded;                   /* false: any double */
+  int_T n;
+  real_T value[FSM_12B_DOMAIN_MAX_VALUES];/* ascending */
+} fsm_12B_DomainField;
+
+typedef struct {
+  fsm_12B_DomainField f[FSM_12B_DOMAIN_FIELDS];
+  boolean_T integer;                   /* draw small integers, not doubles */
+} fsm_12B_Domain;
+
+/* Domains of the values in the states reachable from fsm_12B_initialize */
+extern int_T fsm_12B_domain_explore(fsm_12B_Domain *d);
+
+/* Domains from the assignments in the source text of fsm_12B.c */
+extern void fsm_12B_domain_model(fsm_12B_Domain *d, const char_T *text, size_t
+  len);
+
+/* Index of a field name, or -1 */
+extern int_T fsm_12B_domain_find(const fsm_12B_Domain *d, const char_T *field);
+
+/*
+ * One line of C that sets lvalue to a nondet value of field i and assumes
+ * its domain, in place of "lvalue = nondet_double();".  With integer set
+ * and a domain of integers 0 to 255, the value is drawn as an unsigned
+ * char and converted.  Returns the length, as snprintf.
+ */
+extern int_T fsm_12B_domain_format(const fsm_12B_Domain *d, int_T i, const
+  char_T *lvalue, char_T *buf, size_t size);
+
+/*
+ * Malloc'ed copy of a harness in which every "rtDW.<field> =
+ * nondet_double();" is replaced by fsm_12B_domain_format.  Line numbers do
+ * not change.  *count gets the number of replacements.
+ */
+extern char_T *fsm_12B_domain_inject(const fsm_12B_Domain *d, const char_T
+  *text, size_t len, size_t *outlen, int_T *count);
+
+#endif                                 /* fsm_12B_domain_h_ */
+
+/*
+ * File trailer for fsm_12B_domain.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,359 @@
+/*
+ * File: fsm_12B_equiv.c
+ *
+ * Differential equivalence of the generated copies of Simulink model
+ * 'fsm_12B'.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "fsm_12B_equiv.h"
+#include "fsm_12B_req.h"
+#include "fsm_12B_state.h"
+#include "rtwtypes.h"
+
+/* Renamed entry points of the by-value copies */
+extern void fsm_12B_value_initialize(RT_MODEL *const rtM);
+extern void fsm_12B_value_step(RT_MODEL *const rtM, boolean_T rtU_standby,
+  boolean_T rtU_apfail, boolean_T rtU_supported, boolean_T rtU_limits,
+  boolean_T rtY_pullup);
+extern void fsm_12B_simply_initialize(RT_MODEL *const rtM);
+extern void fsm_12B_simply_step(RT_MODEL *const rtM, boolean_T rtU_standby,
+  boolean_T rtU_apfail, boolean_T rtU_supported, boolean_T rtU_limits,
+  boolean_T rtY_pullup);
+
+typedef struct {
+  int_T k;
+  int_T prefix;                        /* ticks fixed per job */
+  uint64_T first;                      /* job range */
+  uint64_T count;
+  int_T limit;                         /* longest trace still of interest */
+  DW stack[FSM_12B_EQUIV_VARIANTS][FSM_12B_EQUIV_MAX_LENGTH + 1];
+  uint8_T trace[FSM_12B_EQUIV_MAX_LENGTH];
+  fsm_12B_EquivResult res;
+} fsm_12B_EquivShard;
+
+static void fsm_12B_equiv_pointer_step(RT_MODEL *const rtM, uint32_T k,
+  boolean_T *rtY_pullup)
+{
+  fsm_12B_step(rtM, FSM_12B_IN_STANDBY(k), FSM_12B_IN_APFAIL(k),
+               FSM_12B_IN_SUPPORTED(k), FSM_12B_IN_LIMITS(k), rtY_pullup);
+}
+
+static void fsm_12B_equiv_value_step(RT_MODEL *const rtM, uint32_T k,
+  boolean_T *rtY_pullup)
+{
+  fsm_12B_value_step(rtM, FSM_12B_IN_STANDBY(k), FSM_12B_IN_APFAIL(k),
+                     FSM_12B_IN_SUPPORTED(k), FSM_12B_IN_LIMITS(k), false);
+  *rtY_pullup = false;
+}
+
+static void fsm_12B_equiv_simply_step(RT_MODEL *const rtM, uint32_T k,
+  boolean_T *rtY_pullup)
+{
+  fsm_12B_simply_step(rtM, FSM_12B_IN_STANDBY(k), FSM_12B_IN_APFAIL(k),
+                      FSM_12B_IN_SUPPORTED(k), FSM_12B_IN_LIMITS(k), false);
+  *rtY_pullup = false;
+}
+
+const fsm_12B_EquivVariant fsm_12B_equiv_variants[FSM_12B_EQUIV_VARIANTS] = {
+  { "1_fsm/fsm_12B_ert_rtw", fsm_12B_initialize, fsm_12B_equiv_pointer_step,
+    true },
+
+  { "fsm_12B_ert_rtw", fsm_12B_value_initialize, fsm_12B_equiv_value_step,
+    false },
+
+  { "fsm_12B_ert_rtw_simply", fsm_12B_simply_initialize,
+    fsm_12B_equiv_simply_step, false }
+};
+
+static void fsm_12B_equiv_clear(fsm_12B_EquivResult *res)
+{
+  memset(res, 0, sizeof(fsm_12B_EquivResult));
+  res->variant = -1;
+  res->length = -1;
+}
+
+/*
+ * Compare the variants after trace[0..length-1] and record the first
+ * difference in res.  Returns true when they all agree.
+ */
+static boolean_T fsm_12B_equiv_compare(DW *const rtDW[FSM_12B_EQUIV_VARIANTS],
+  const boolean_T rtY_pullup[FSM_12B_EQUIV_VARIANTS], const uint8_T *trace,
+  int_T length, fsm_12B_EquivResult *res)
+{
+  int_T out = -1;
+  int_T v;
+  for (v = 0; v < FSM_12B_EQUIV_VARIANTS; v++) {
+    const fsm_12B_EquivVariant *var = &fsm_12B_equiv_variants[v];
+    boolean_T output = false;
+    if (var->has_output && (out < 0)) {
+      out = v;
+    } else if (var->has_output && (rtY_pullup[v] != rtY_pullup[out])) {
+      output = true;
+    }
+
+    if (output || !fsm_12B_dw_equal(rtDW[0], rtDW[v])) {
+      res->diverged = true;
+      res->variant = v;
+      res->output = output;
+      res->length = length;
+      if (length > 0) {
+        memcpy(res->trace, trace, (size_t)length);
+      }
+
+      res->expected = *rtDW[0];
+      res->actual = *rtDW[v];
+      res->expected_pullup = rtY_pullup[output ? out : 0];
+      res->actual_pullup = rtY_pullup[v];
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* Initialize every variant into rtDW and compare them */
+static boolean_T fsm_12B_equiv_initialize(DW *const
+  rtDW[FSM_12B_EQUIV_VARIANTS], fsm_12B_EquivResult *res)
+{
+  boolean_T rtY_pullup[FSM_12B_EQUIV_VARIANTS];
+  RT_MODEL rtM;
+  int_T v;
+  for (v = 0; v < FSM_12B_EQUIV_VARIANTS; v++) {
+    memset(rtDW[v], 0, sizeof(DW));
+    rtM.dwork = rtDW[v];
+    fsm_12B_equiv_variants[v].initialize(&rtM);
+    rtY_pullup[v] = false;
+  }
+
+  return fsm_12B_equiv_compare(rtDW, rtY_pullup, NULL, 0, res);
+}
+
+int_T fsm_12B_equiv_states(fsm_12B_Explorer *ex, fsm_12B_EquivResult *res)
+{
+  fsm_12B_ExploreResult results[FSM_12B_NUM_REQUIREMENTS];
+  DW state[FSM_12B_EQUIV_VARIANTS];
+  DW *rtDW[FSM_12B_EQUIV_VARIANTS];
+  int_T s;
+  int_T v;
+  fsm_12B_equiv_clear(res);
+  for (v = 0; v < FSM_12B_EQUIV_VARIANTS; v++) {
+    rtDW[v] = &state[v];
+  }
+
+  if (!fsm_12B_equiv_initialize(rtDW, res)) {
+    return 0;
+  }
+
+  if (fsm_12B_explore(ex, results) != 0) {
+    return -1;
+  }
+
+  for (s = 0; s < ex->count; s++) {
+    uint32_T k;
+    for (k = 0U; k < FSM_12B_NUM_INPUTS; k++) {
+      boolean_T rtY_pullup[FSM_12B_EQUIV_VARIANTS];
+      uint8_T trace[FSM_12B_EXPLORE_MAX_TRACE];
+      int_T length;
+      RT_MODEL rtM;
+      for (v = 0; v < FSM_12B_EQUIV_VARIANTS; v++) {
+        state[v] = ex->state[s];
+        rtM.dwork = &state[v];
+        fsm_12B_equiv_variants[v].step(&rtM, k, &rtY_pullup[v]);
+      }
+
+      res->steps += FSM_12B_EQUIV_VARIANTS;
+      length = fsm_12B_explore_path(ex, s, trace, FSM_12B_EXPLORE_MAX_TRACE -
+        1);
+      if (length < 0) {
+        return -1;
+      }
+
+      trace[length++] = (uint8_T)k;
+      if (!fsm_12B_equiv_compare(rtDW, rtY_pullup, trace, length, res)) {
+        return 0;
+      }
+    }
+  }
+
+  return 0;
+}
+
+/* Every continuation of stack[.][d] by up to sh->limit - d ticks */
+static void fsm_12B_equiv_dfs(fsm_12B_EquivShard *sh, int_T d)
+{
+  uint32_T k;
+  for (k = 0U; (k < FSM_12B_NUM_INPUTS) && (d < sh->limit); k++) {
+    boolean_T rtY_pullup[FSM_12B_EQUIV_VARIANTS];
+    DW *rtDW[FSM_12B_EQUIV_VARIANTS];
+    RT_MODEL rtM;
+    int_T v;
+    sh->trace[d] = (uint8_T)k;
+    for (v = 0; v < FSM_12B_EQUIV_VARIANTS; v++) {
+      rtDW[v] = &sh->stack[v][d + 1];
+      *rtDW[v] = sh->stack[v][d];
+      rtM.dwork = rtDW[v];
+      fsm_12B_equiv_variants[v].step(&rtM, k, &rtY_pullup[v]);
+    }
+
+    sh->res.steps += FSM_12B_EQUIV_VARIANTS;
+    if (!fsm_12B_equiv_compare(rtDW, rtY_pullup, sh->trace, d + 1, &sh->res))
+    {
+      /* Only shorter traces are of interest from now on */
+      sh->limit = d;
+    } else {
+      fsm_12B_equiv_dfs(sh, d + 1);
+    }
+  }
+}
+
+static void fsm_12B_equiv_shard(fsm_12B_EquivShard *sh)
+{
+  uint64_T job;
+  sh->limit = sh->k;
+  for (job = sh->first; job < sh->first + sh->count; job++) {
+    boolean_T rtY_pullup[FSM_12B_EQUIV_VARIANTS];
+    DW *rtDW[FSM_12B_EQUIV_VARIANTS];
+    RT_MODEL rtM;
+    boolean_T same = true;
+    int_T d;
+    int_T v;
+    for (v = 0; v < FSM_12B_EQUIV_VARIANTS; v++) {
+      rtDW[v] = &sh->stack[v][0];
+      memset(rtDW[v], 0, sizeof(DW));
+      rtM.dwork = rtDW[v];
+      fsm_12B_equiv_variants[v].initialize(&rtM);
+    }
+
+    /* The prefix of the job, most significant input vector first */
+    for (d = 0; (d < sh->prefix) && (d < sh->limit) && same; d++) {
+      const uint32_T k = (uint32_T)(job >> (4 * (sh->prefix - 1 - d))) &
+        (FSM_12B_NUM_INPUTS - 1U);
+      sh->trace[d] = (uint8_T)k;
+      for (v = 0; v < FSM_12B_EQUIV_VARIANTS; v++) {
+        rtDW[v] = &sh->stack[v][d + 1];
+        *rtDW[v] = sh->stack[v][d];
+        rtM.dwork = rtDW[v];
+        fsm_12B_equiv_variants[v].step(&rtM, k, &rtY_pullup[v]);
+      }
+
+      sh->res.steps += FSM_12B_EQUIV_VARIANTS;
+      same = fsm_12B_equiv_compare(rtDW, rtY_pullup, sh->trace, d + 1,
+        &sh->res);
+      if (!same) {
+        sh->limit = d;
+      }
+    }
+
+    if (same && (d == sh->prefix)) {
+      fsm_12B_equiv_dfs(sh, d);
+    }
+  }
+}
+
+static void *fsm_12B_equiv_worker(void *arg)
+{
+  fsm_12B_equiv_shard((fsm_12B_EquivShard *)arg);
+  return NULL;
+}
+
+int_T fsm_12B_equiv_sequences(int_T k, int_T threads, fsm_12B_EquivResult
+  *res)
+{
+  fsm_12B_EquivShard *shard;
+  pthread_t tid[FSM_12B_EQUIV_MAX_THREADS];
+  boolean_T started[FSM_12B_EQUIV_MAX_THREADS];
+  DW state[FSM_12B_EQUIV_VARIANTS];
+  DW *rtDW[FSM_12B_EQUIV_VARIANTS];
+  uint64_T jobs = 1U;
+  int_T prefix = 0;
+  int_T n = threads;
+  int_T i;
+  if ((k < 1) || (k > FSM_12B_EQUIV_MAX_LENGTH)) {
+    return -1;
+  }
+
+  fsm_12B_equiv_clear(res);
+  for (i = 0; i < FSM_12B_EQUIV_VARIANTS; i++) {
+    rtDW[i] = &state[i];
+  }
+
+  if (!fsm_12B_equiv_initialize(rtDW, res)) {
+    return 1;
+  }
+
+  if (n <= 0) {
+    n = (int_T)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  if (n > FSM_12B_EQUIV_MAX_THREADS) {
+    n = FSM_12B_EQUIV_MAX_THREADS;
+  }
+
+  if (n < 1) {
+    n = 1;
+  }
+
+  /* Enough prefixes for an even load */
+  while ((prefix < k) && (jobs < 16U * (uint64_T)n)) {
+    jobs *= FSM_12B_NUM_INPUTS;
+    prefix++;
+  }
+
+  if ((uint64_T)n > jobs) {
+    n = (int_T)jobs;
+  }
+
+  shard = (fsm_12B_EquivShard *)malloc((size_t)n * sizeof(fsm_12B_EquivShard));
+  if (shard == NULL) {
+    return -1;
+  }
+
+  /* Contiguous shards; shard 0 runs on the calling thread */
+  for (i = 0; i < n; i++) {
+    const uint64_T q = jobs / (uint64_T)n;
+    const uint64_T rem = jobs % (uint64_T)n;
+    shard[i].k = k;
+    shard[i].prefix = prefix;
+    shard[i].first = q * (uint64_T)i + (((uint64_T)i < rem) ? (uint64_T)i :
+      rem);
+    shard[i].count = q + (((uint64_T)i < rem) ? 1U : 0U);
+    fsm_12B_equiv_clear(&shard[i].res);
+    started[i] = (i > 0) && (pthread_create(&tid[i], NULL,
+      fsm_12B_equiv_worker, &shard[i]) == 0);
+  }
+
+  for (i = 0; i < n; i++) {
+    if (!started[i]) {
+      (void)fsm_12B_equiv_worker(&shard[i]);
+    }
+  }
+
+  /* Shortest divergence, the first shard breaking ties */
+  for (i = 0; i < n; i++) {
+    const fsm_12B_EquivResult *r = &shard[i].res;
+    if (started[i]) {
+      (void)pthread_join(tid[i], NULL);
+    }
+
+    res->steps += r->steps;
+    if (r->diverged && (!res->diverged || (r->length < res->length))) {
+      const uint64_T steps = res->steps;
+      *res = *r;
+      res->steps = steps;
+    }
+  }
+
+  free(shard);
+  return n;
+}
+
+/*
+ * File trailer for fsm_12B_equiv.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,83 @@
+/*
+ * File: fsm_12B_equiv.h
+ *
+ * Differential equivalence of the generated copies of Simulink model
+ * 'fsm_12B'.
+ *
+ * The repository carries the model three times: ../fsm_12B_ert_rtw,
+ * which returns rtY_pullup through a pointer and is the reference, and
+ * ../../fsm_12B_ert_rtw and ../../fsm_12B_ert_rtw_simply, which take it
+ * by value and so lose it.  The two by-value copies are compiled with
+ * their entry points renamed, e.g.
+ *
+ *   -Dfsm_12B_initialize=fsm_12B_value_initialize
+ *   -Dfsm_12B_step=fsm_12B_value_step
+ *
+ * so that all three link into one program.  After initialize and after
+ * every step, the DW of every variant must have the same bit pattern as
+ * the reference, and every variant that has an output must agree on it.
+ * Merge_p[2], which the by-value copies would have returned, is part of
+ * DW, so their lost output is still compared.
+ */
+
+#ifndef fsm_12B_equiv_h_
+#define fsm_12B_equiv_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+#include "fsm_12B_explore.h"
+
+#define FSM_12B_EQUIV_VARIANTS         3
+#define FSM_12B_EQUIV_MAX_LENGTH       16
+#define FSM_12B_EQUIV_MAX_THREADS      256
+
+typedef struct {
+  const char_T *name;                  /* model directory */
+  void (*initialize)(RT_MODEL *const rtM);
+  void (*step)(RT_MODEL *const rtM, uint32_T k, boolean_T *rtY_pullup);
+  boolean_T has_output;
+} fsm_12B_EquivVariant;
+
+typedef struct {
+  boolean_T diverged;
+  int_T variant;                       /* the one that differs from variant 0 */
+  boolean_T output;                    /* in the output, not in DW */
+  int_T length;                        /* ticks; 0 for fsm_12B_initialize */
+  uint8_T trace[FSM_12B_EXPLORE_MAX_TRACE];/* input vectors */
+  DW expected;                         /* the reference after the trace */
+  DW actual;
+  boolean_T expected_pullup;
+  boolean_T actual_pullup;
+  uint64_T steps;                      /* fsm_12B_step calls, all variants */
+} fsm_12B_EquivResult;
+
+/* Reference first */
+extern const fsm_12B_EquivVariant
+  fsm_12B_equiv_variants[FSM_12B_EQUIV_VARIANTS];
+
+/*
+ * Step every variant from every state reachable from the reference's
+ * fsm_12B_initialize, under every input vector.  States are taken in
+ * breadth-first order, so a divergence comes with a shortest trace.
+ * Returns 0, or -1 when the state space does not fit the explorer.
+ */
+extern int_T fsm_12B_equiv_states(fsm_12B_Explorer *ex, fsm_12B_EquivResult
+  *res);
+
+/*
+ * Run every input sequence of up to k ticks on every variant, each from its
+ * own fsm_12B_initialize, on the given number of threads (0: one per online
+ * core).  Each thread takes a contiguous range of input prefixes.  The
+ * divergence reported is the shortest, and the first in input order among
+ * those, whatever the number of threads.  Returns the number of threads
+ * used, or -1 if k is out of range.
+ */
+extern int_T fsm_12B_equiv_sequences(int_T k, int_T threads,
+  fsm_12B_EquivResult *res);
+
+#endif                                 /* fsm_12B_equiv_h_ */
+
+/*
+ * File trailer for fsm_12B_equiv.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,141 @@
+/*
+ * File: fsm_12B_explore.c
+ *
+ * Explicit-state explorer for Simulink model 'fsm_12B'.
+ */
+
+#include <string.h>
+#include "fsm_12B_explore.h"
+#include "fsm_12B_state.h"
+#include "rtwtypes.h"
+
+/*
+ * Index of rtDW in the visited set, inserting it as a child of parent when
+ * new.  Returns -1 when the set is full.
+ */
+static int_T fsm_12B_explore_visit(fsm_12B_Explorer *ex, const DW *rtDW, int_T
+  parent, uint8_T input)
+{
+  uint32_T i = (uint32_T)fsm_12B_dw_hash(rtDW) & (FSM_12B_EXPLORE_HASH_SIZE -
+    1U);
+  int_T s;
+  while (ex->slot[i] != 0) {
+    s = ex->slot[i] - 1;
+    if (fsm_12B_dw_equal(&ex->state[s], rtDW)) {
+      return s;
+    }
+
+    i = (i + 1U) & (FSM_12B_EXPLORE_HASH_SIZE - 1U);
+  }
+
+  if (ex->count >= FSM_12B_EXPLORE_MAX_STATES) {
+    return -1;
+  }
+
+  s = ex->count++;
+  ex->state[s] = *rtDW;
+  ex->parent[s] = parent;
+  ex->input[s] = input;
+  ex->depth[s] = (parent < 0) ? 0 : (ex->depth[parent] + 1);
+  if (ex->depth[s] > ex->max_depth) {
+    ex->max_depth = ex->depth[s];
+  }
+
+  ex->slot[i] = s + 1;
+  return s;
+}
+
+int_T fsm_12B_explore_path(const fsm_12B_Explorer *ex, int_T s, uint8_T *trace,
+  int_T capacity)
+{
+  const int_T length = ex->depth[s];
+  int_T i;
+  if (length > capacity) {
+    return -1;
+  }
+
+  for (i = length - 1; i >= 0; i--) {
+    trace[i] = ex->input[s];
+    s = ex->parent[s];
+  }
+
+  return length;
+}
+
+int_T fsm_12B_explore(fsm_12B_Explorer *ex, fsm_12B_ExploreResult
+                      results[FSM_12B_NUM_REQUIREMENTS])
+{
+  RT_MODEL rtM;
+  DW rtDW;
+  int_T head;
+  int_T r;
+  memset(ex, 0, sizeof(fsm_12B_Explorer));
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    results[r].verdict = FSM_12B_VERDICT_VACUOUS;
+    results[r].reached = 0U;
+    results[r].length = 0;
+  }
+
+  /* Initialize model, DW in static storage */
+  memset(&rtDW, 0, sizeof(DW));
+  rtM.dwork = &rtDW;
+  fsm_12B_initialize(&rtM);
+  if (fsm_12B_explore_visit(ex, &rtDW, -1, 0U) < 0) {
+    return -1;
+  }
+
+  for (head = 0; head < ex->count; head++) {
+    uint32_T k;
+    for (k = 0U; k < FSM_12B_NUM_INPUTS; k++) {
+      fsm_12B_ReqInputs rtIn;
+      boolean_T rtY_pullup = false;
+
+      /* Requirement branches of rt_OneStep, both values of OverrunFlag */
+      for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+        fsm_12B_ExploreResult *res = &results[r];
+        int_T overrun;
+        for (overrun = 0; overrun < 2; overrun++) {
+          fsm_12B_ReqOutcome outcome;
+          fsm_12B_req_inputs(k, (boolean_T)overrun, &rtIn);
+          outcome = fsm_12B_req_eval(&fsm_12B_requirements[r], &ex->state[head],
+            &rtIn, &rtDW, &rtY_pullup);
+          if ((outcome == FSM_12B_REQ_PASS) || (outcome == FSM_12B_REQ_FAIL)) {
+            res->reached++;
+            if (res->verdict == FSM_12B_VERDICT_VACUOUS) {
+              res->verdict = FSM_12B_VERDICT_HOLDS;
+            }
+          }
+
+          if ((outcome == FSM_12B_REQ_FAIL) && (res->verdict !=
+               FSM_12B_VERDICT_VIOLATED)) {
+            res->length = fsm_12B_explore_path(ex, head, res->trace,
+              FSM_12B_EXPLORE_MAX_TRACE - 1);
+            if (res->length < 0) {
+              return -1;
+            }
+
+            res->trace[res->length++] = (uint8_T)k;
+            res->verdict = FSM_12B_VERDICT_VIOLATED;
+          }
+        }
+      }
+
+      /* Successor under input vector k */
+      rtDW = ex->state[head];
+      fsm_12B_step(&rtM, FSM_12B_IN_STANDBY(k), FSM_12B_IN_APFAIL(k),
+                   FSM_12B_IN_SUPPORTED(k), FSM_12B_IN_LIMITS(k), &rtY_pullup);
+      ex->transitions++;
+      if (fsm_12B_explore_visit(ex, &rtDW, head, (uint8_T)k) < 0) {
+        return -1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+/*
+ * File trailer for fsm_12B_explore.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,65 @@
+/*
+ * File: fsm_12B_explore.h
+ *
+ * Explicit-state explorer for Simulink model 'fsm_12B'.
+ *
+ * Breadth-first search from fsm_12B_initialize over all 16 input vectors,
+ * with a hashed visited set keyed on the bit pattern of DW.  Every
+ * requirement of fsm_12B_req.h is evaluated at every reachable state and
+ * input, and because states are expanded in BFS order the first
+ * violation found for a requirement has a shortest trace.
+ */
+
+#ifndef fsm_12B_explore_h_
+#define fsm_12B_explore_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+#include "fsm_12B_req.h"
+
+#define FSM_12B_EXPLORE_MAX_STATES     1024
+#define FSM_12B_EXPLORE_HASH_SIZE      2048 /* power of two, > 1.5 * MAX_STATES */
+#define FSM_12B_EXPLORE_MAX_TRACE      64
+
+typedef enum {
+  FSM_12B_VERDICT_HOLDS = 0,           /* assertion reached and never violated */
+  FSM_12B_VERDICT_VIOLATED,            /* counterexample in trace */
+  FSM_12B_VERDICT_VACUOUS              /* assertion never reached */
+} fsm_12B_Verdict;
+
+typedef struct {
+  fsm_12B_Verdict verdict;
+  uint32_T reached;                    /* (state, input) pairs reaching assert */
+  int_T length;                        /* ticks in trace */
+  uint8_T trace[FSM_12B_EXPLORE_MAX_TRACE];/* input vectors after initialize */
+} fsm_12B_ExploreResult;
+
+typedef struct {
+  DW state[FSM_12B_EXPLORE_MAX_STATES];
+  int_T parent[FSM_12B_EXPLORE_MAX_STATES];/* -1 for the initial state */
+  uint8_T input[FSM_12B_EXPLORE_MAX_STATES];/* input vector from parent */
+  int_T depth[FSM_12B_EXPLORE_MAX_STATES];
+  int_T slot[FSM_12B_EXPLORE_HASH_SIZE];/* state index + 1, 0 when empty */
+  int_T count;                         /* reachable states */
+  int_T max_depth;                     /* BFS depth of the state space */
+  uint32_T transitions;                /* (state, input) pairs expanded */
+} fsm_12B_Explorer;
+
+/*
+ * Explore the reachable state space and fill one result per requirement,
+ * in the order of fsm_12B_requirements.  Returns 0, or -1 when the state
+ * space or a trace does not fit the fixed capacities above.
+ */
+extern int_T fsm_12B_explore(fsm_12B_Explorer *ex, fsm_12B_ExploreResult
+  results[FSM_12B_NUM_REQUIREMENTS]);
+
+/* Input vectors leading from the initial state to state index s */
+extern int_T fsm_12B_explore_path(const fsm_12B_Explorer *ex, int_T s, uint8_T
+  *trace, int_T capacity);
+
+#endif                                 /* fsm_12B_explore_h_ */
+
+/*
+ * File trailer for fsm_12B_explore.h
+ *
+ * [EOF]
+ */
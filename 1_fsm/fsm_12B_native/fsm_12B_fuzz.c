@@ -0,0 +1,195 @@
+/*
+ * File: fsm_12B_fuzz.c
+ *
+ * Coverage-guided fuzzing of Simulink model 'fsm_12B' over sequences of
+ * ticks.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "fsm_12B_fuzz.h"
+#include "fsm_12B_explore.h"
+#include "rtwtypes.h"
+
+int_T fsm_12B_fuzz_tuple(const DW *rtDW)
+{
+  const real_T manager = rtDW->UnitDelay_DSTATE;
+  const real_T sen = rtDW->UnitDelay1_DSTATE;
+  if (!((manager == 0.0) || (manager == 1.0) || (manager == 2.0) || (manager ==
+        3.0)) || !((sen == 0.0) || (sen == 1.0) || (sen == 2.0))) {
+    return FSM_12B_FUZZ_OTHER;
+  }
+
+  return ((int_T)manager * 3 + (int_T)sen) * 2 + (rtDW->UnitDelay2_DSTATE ? 1 :
+    0);
+}
+
+/* Count feature f, saturating at 255 */
+static void fsm_12B_fuzz_hit(fsm_12B_FuzzRun *run, int_T f)
+{
+  if (run->hits[f] != 255U) {
+    run->hits[f]++;
+  }
+}
+
+/*
+ * Count the features of byte at, a tick that stepped from pre to rtDW, and
+ * evaluate every requirement on it.
+ */
+static void fsm_12B_fuzz_tick(const DW *pre, const DW *rtDW, const
+  fsm_12B_ReqInputs *rtIn, boolean_T rtY_pullup, fsm_12B_FuzzRun *run, size_t
+  at)
+{
+  const int_T from = fsm_12B_fuzz_tuple(pre);
+  const int_T to = fsm_12B_fuzz_tuple(rtDW);
+  int_T r;
+  fsm_12B_fuzz_hit(run, FSM_12B_FUZZ_TUPLE(to));
+  fsm_12B_fuzz_hit(run, FSM_12B_FUZZ_EDGE(from, to));
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    const fsm_12B_Requirement *req = &fsm_12B_requirements[r];
+    if (!req->assume(pre, rtIn)) {
+      continue;
+    }
+
+    fsm_12B_fuzz_hit(run, FSM_12B_FUZZ_ASSUMED(r));
+    if (!req->check(rtDW, rtY_pullup)) {
+      fsm_12B_fuzz_hit(run, FSM_12B_FUZZ_VIOLATED(r));
+      if (run->first[r] < 0) {
+        run->first[r] = (int_T)at;
+      }
+
+      if (run->violated < 0) {
+        run->violated = r;
+      }
+    }
+  }
+}
+
+int_T fsm_12B_fuzz_run(const uint8_T *data, size_t size, fsm_12B_FuzzRun *run)
+{
+  RT_MODEL rtM;
+  DW rtDW;
+  size_t t;
+  int_T count = 0;
+  int_T r;
+  memset(run->hits, 0, sizeof(run->hits));
+  run->ticks = 0;
+  run->violated = -1;
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    run->first[r] = -1;
+  }
+
+  /* Initialize model, DW in static storage */
+  memset(&rtDW, 0, sizeof(DW));
+  rtM.dwork = &rtDW;
+  fsm_12B_initialize(&rtM);
+  fsm_12B_fuzz_hit(run, FSM_12B_FUZZ_TUPLE(fsm_12B_fuzz_tuple(&rtDW)));
+  for (t = 0U; t < size; t++) {
+    const uint32_T k = (uint32_T)data[t] & (FSM_12B_NUM_INPUTS - 1U);
+    fsm_12B_ReqInputs rtIn;
+    boolean_T rtY_pullup = false;
+    DW pre;
+
+    /* Check for overrun */
+    if ((data[t] & FSM_12B_FUZZ_OVERRUN) != 0U) {
+      continue;
+    }
+
+    fsm_12B_req_inputs(k, false, &rtIn);
+    pre = rtDW;
+    fsm_12B_step(&rtM, rtIn.rtU_standby, rtIn.rtU_apfail, rtIn.rtU_supported,
+                 rtIn.rtU_limits, &rtY_pullup);
+    run->ticks++;
+    fsm_12B_fuzz_tick(&pre, &rtDW, &rtIn, rtY_pullup, run, t);
+  }
+
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    if (run->first[r] >= 0) {
+      count++;
+    }
+  }
+
+  return count;
+}
+
+int_T fsm_12B_fuzz_reachable(boolean_T reachable[FSM_12B_FUZZ_FEATURES])
+{
+  static fsm_12B_Explorer ex;
+  static fsm_12B_FuzzRun run;
+  fsm_12B_ExploreResult results[FSM_12B_NUM_REQUIREMENTS];
+  RT_MODEL rtM;
+  DW rtDW;
+  int_T count = 0;
+  int_T s;
+  int_T f;
+  if (fsm_12B_explore(&ex, results) != 0) {
+    return -1;
+  }
+
+  /* Every tick from every reachable state */
+  memset(run.hits, 0, sizeof(run.hits));
+  run.violated = -1;
+  for (f = 0; f < FSM_12B_NUM_REQUIREMENTS; f++) {
+    run.first[f] = -1;
+  }
+
+  rtM.dwork = &rtDW;
+  fsm_12B_fuzz_hit(&run, FSM_12B_FUZZ_TUPLE(fsm_12B_fuzz_tuple(&ex.state[0])));
+  for (s = 0; s < ex.count; s++) {
+    uint32_T k;
+    for (k = 0U; k < FSM_12B_NUM_INPUTS; k++) {
+      fsm_12B_ReqInputs rtIn;
+      boolean_T rtY_pullup = false;
+      fsm_12B_req_inputs(k, false, &rtIn);
+      rtDW = ex.state[s];
+      fsm_12B_step(&rtM, rtIn.rtU_standby, rtIn.rtU_apfail, rtIn.rtU_supported,
+                   rtIn.rtU_limits, &rtY_pullup);
+      fsm_12B_fuzz_tick(&ex.state[s], &rtDW, &rtIn, rtY_pullup, &run, 0U);
+    }
+  }
+
+  for (f = 0; f < FSM_12B_FUZZ_FEATURES; f++) {
+    reachable[f] = (run.hits[f] != 0U);
+    if (reachable[f]) {
+      count++;
+    }
+  }
+
+  return count;
+}
+
+/* "M1 S0 D1" for tuple a */
+static void fsm_12B_fuzz_tuple_name(int_T a, char_T *buf, size_t size)
+{
+  if (a == FSM_12B_FUZZ_OTHER) {
+    (void)snprintf(buf, size, "other");
+  } else {
+    (void)snprintf(buf, size, "M%d S%d D%d", a / 6, (a / 2) % 3, a % 2);
+  }
+}
+
+void fsm_12B_fuzz_name(int_T f, char_T *buf, size_t size)
+{
+  char_T a[40];
+  char_T b[40];
+  if (f < FSM_12B_FUZZ_TUPLES) {
+    fsm_12B_fuzz_tuple_name(f, a, sizeof(a));
+    (void)snprintf(buf, size, "tuple %s", a);
+  } else if (f < FSM_12B_FUZZ_ASSUMED(0)) {
+    const int_T e = f - FSM_12B_FUZZ_TUPLES;
+    fsm_12B_fuzz_tuple_name(e / FSM_12B_FUZZ_TUPLES, a, sizeof(a));
+    fsm_12B_fuzz_tuple_name(e % FSM_12B_FUZZ_TUPLES, b, sizeof(b));
+    (void)snprintf(buf, size, "edge %s -> %s", a, b);
+  } else {
+    const int_T r = (f - FSM_12B_FUZZ_ASSUMED(0)) / 2;
+    (void)snprintf(buf, size, "requirement %d %s", fsm_12B_requirements[r].id,
+                   ((f - FSM_12B_FUZZ_ASSUMED(0)) % 2 == 0) ? "assumed" :
+                   "violated");
+  }
+}
+
+/*
+ * File trailer for fsm_12B_fuzz.c
+ *
+ * [EOF]
+ */
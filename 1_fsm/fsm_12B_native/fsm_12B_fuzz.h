@@ -0,0 +1,77 @@
+/*
+ * File: fsm_12B_fuzz.h
+ *
+ * Coverage-guided fuzzing of Simulink model 'fsm_12B' over sequences of
+ * ticks.
+ *
+ * A fuzz input is one byte per tick after fsm_12B_initialize.  The low
+ * four bits are the input vector of fsm_12B_req.h, bit 4 is OverrunFlag
+ * (the tick is skipped, as rt_OneStep returns early), and the upper bits
+ * are ignored.  Every requirement of fsm_12B_req.h is checked on every
+ * tick that steps: assume on the state and inputs before fsm_12B_step,
+ * check on the state and output after it.
+ *
+ * Besides the code edges the compiler instruments, a run records model
+ * features that a fuzzer can use as feedback: the mode tuple (Manager
+ * mode UnitDelay_DSTATE, Sen mode UnitDelay1_DSTATE, UnitDelay2_DSTATE)
+ * after every tick, the edge between the tuples before and after it, and
+ * per requirement whether its assumption held and whether it was
+ * violated.  hits[] is laid out like the extra counters of libFuzzer.
+ */
+
+#ifndef fsm_12B_fuzz_h_
+#define fsm_12B_fuzz_h_
+#include <stddef.h>
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+#include "fsm_12B_req.h"
+
+#define FSM_12B_FUZZ_OVERRUN           0x10U
+
+/* 4 Manager modes x 3 Sen modes x UnitDelay2, and one for anything else */
+#define FSM_12B_FUZZ_TUPLES            25
+#define FSM_12B_FUZZ_OTHER             24
+
+/* Feature indices */
+#define FSM_12B_FUZZ_TUPLE(a)          (a)
+#define FSM_12B_FUZZ_EDGE(a, b)        (FSM_12B_FUZZ_TUPLES * (1 + (a)) + (b))
+#define FSM_12B_FUZZ_ASSUMED(i)        (FSM_12B_FUZZ_TUPLES * (1 + \
+  FSM_12B_FUZZ_TUPLES) + 2 * (i))
+#define FSM_12B_FUZZ_VIOLATED(i)       (FSM_12B_FUZZ_ASSUMED(i) + 1)
+#define FSM_12B_FUZZ_FEATURES          (FSM_12B_FUZZ_TUPLES * (1 + \
+  FSM_12B_FUZZ_TUPLES) + 2 * FSM_12B_NUM_REQUIREMENTS)
+
+typedef struct {
+  uint8_T hits[FSM_12B_FUZZ_FEATURES]; /* saturating counts */
+  int_T ticks;                         /* stepped, not skipped */
+  int_T violated;                      /* first violated requirement, or -1 */
+  int_T first[FSM_12B_NUM_REQUIREMENTS];/* byte of first violation, or -1 */
+} fsm_12B_FuzzRun;
+
+/* Mode tuple of rtDW, 0 to FSM_12B_FUZZ_OTHER */
+extern int_T fsm_12B_fuzz_tuple(const DW *rtDW);
+
+/*
+ * Run one input from fsm_12B_initialize and fill run.  Returns the number
+ * of requirements violated at least once.
+ */
+extern int_T fsm_12B_fuzz_run(const uint8_T *data, size_t size,
+  fsm_12B_FuzzRun *run);
+
+/*
+ * Mark every feature that some input can produce, using fsm_12B_explore.
+ * Returns the number of features marked, or -1 when the state space does
+ * not fit the explorer.
+ */
+extern int_T fsm_12B_fuzz_reachable(boolean_T reachable[FSM_12B_FUZZ_FEATURES]);
+
+/* Name of feature f, such as "edge M1 S0 D1 -> M2 S0 D1" */
+extern void fsm_12B_fuzz_name(int_T f, char_T *buf, size_t size);
+
+#endif                                 /* fsm_12B_fuzz_h_ */
+
+/*
+ * File trailer for fsm_12B_fuzz.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,117 @@
+/*
+ * File: fsm_12B_lat.c
+ *
+ * Step-latency instrumentation for rt_OneStep of Simulink model 'fsm_12B'.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <string.h>
+#include <time.h>
+#include "fsm_12B_lat.h"
+#include "rtwtypes.h"
+
+static real_T fsm_12B_lat_mono(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (real_T)ts.tv_sec + 1.0e-9 * (real_T)ts.tv_nsec;
+}
+
+real_T fsm_12B_lat_calibrate(void)
+{
+  real_T t0;
+  real_T t1;
+  uint64_T c0;
+  uint64_T c1;
+
+#if defined(__aarch64__)
+
+  uint64_T f;
+  __asm__ __volatile__ ("mrs %0, cntfrq_el0" : "=r" (f));
+  if (f != 0U) {
+    return (real_T)f;
+  }
+
+#endif
+
+  /* Spin 20 ms against the monotonic clock */
+  t0 = fsm_12B_lat_mono();
+  c0 = fsm_12B_lat_now();
+  do {
+    t1 = fsm_12B_lat_mono();
+  } while (t1 - t0 < 0.02);
+
+  c1 = fsm_12B_lat_now();
+  return (real_T)(c1 - c0) / (t1 - t0);
+}
+
+void fsm_12B_lat_init(fsm_12B_Latency *l, real_T period)
+{
+  memset(l, 0, sizeof(fsm_12B_Latency));
+  l->ticks_per_sec = fsm_12B_lat_calibrate();
+  l->budget = (uint64_T)(period * l->ticks_per_sec);
+  l->stats.min = ~(uint64_T)0U;
+}
+
+void fsm_12B_lat_snapshot(const fsm_12B_Latency *l, fsm_12B_LatStats *out)
+{
+  const uint64_T *src = (const uint64_T *)&l->stats;
+  uint64_T *dst = (uint64_T *)out;
+  const size_t n = sizeof(fsm_12B_LatStats) / sizeof(uint64_T);
+  for (;;) {
+    const uint32_T s0 = __atomic_load_n(&l->seq, __ATOMIC_ACQUIRE);
+    size_t i;
+    if ((s0 & 1U) == 0U) {
+      for (i = 0; i < n; i++) {
+        dst[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+      }
+
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+      if (__atomic_load_n(&l->seq, __ATOMIC_RELAXED) == s0) {
+        return;
+      }
+    }
+  }
+}
+
+uint64_T fsm_12B_lat_bucket_low(int_T b)
+{
+  const int_T e = b >> FSM_12B_LAT_SUB_BITS;
+  if (e == 0) {
+    return (uint64_T)b;
+  }
+
+  return ((uint64_T)FSM_12B_LAT_SUB | (uint64_T)(b & (FSM_12B_LAT_SUB - 1))) <<
+    (e - 1);
+}
+
+uint64_T fsm_12B_lat_bucket_high(int_T b)
+{
+  if (b + 1 >= FSM_12B_LAT_BUCKETS) {
+    return ~(uint64_T)0U;
+  }
+
+  return fsm_12B_lat_bucket_low(b + 1) - 1U;
+}
+
+uint64_T fsm_12B_lat_quantile(const fsm_12B_LatStats *s, real_T q)
+{
+  const real_T target = q * (real_T)s->steps;
+  uint64_T seen = 0U;
+  int_T b;
+  for (b = 0; b < FSM_12B_LAT_BUCKETS; b++) {
+    seen += s->hist[b];
+    if ((seen != 0U) && ((real_T)seen >= target)) {
+      return (fsm_12B_lat_bucket_high(b) < s->max) ? fsm_12B_lat_bucket_high(b)
+        : s->max;
+    }
+  }
+
+  return s->max;
+}
+
+/*
+ * File trailer for fsm_12B_lat.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,197 @@
+/*
+ * File: fsm_12B_lat.h
+ *
+ * Step-latency instrumentation for rt_OneStep of Simulink model 'fsm_12B'.
+ *
+ * fsm_12B_lat_enter/fsm_12B_lat_exit bracket one base-rate step and take a
+ * cycle-counter timestamp each (rdtsc on x86-64, cntvct_el0 on AArch64,
+ * CLOCK_MONOTONIC in nanoseconds elsewhere).  The step latency goes into
+ * a log-linear histogram with 2^FSM_12B_LAT_SUB_BITS buckets per power of
+ * two, so every recorded value is known to within 1/16 of itself.  A step
+ * that takes longer than the 0.2 s base rate is an overrun; a step entered
+ * while the previous one is still running is counted as skipped, as the
+ * OverrunFlag check of rt_OneStep would.
+ *
+ * One thread or interrupt context records; any number of threads may read
+ * with fsm_12B_lat_snapshot at any time.  Updates are published through a
+ * sequence counter, so the recording side never waits and never issues a
+ * locked instruction.
+ *
+ * The wrappers compile to the plain step unless FSM_12B_LATENCY is
+ * defined, so the instrumentation can be left in the source.
+ */
+
+#ifndef fsm_12B_lat_h_
+#define fsm_12B_lat_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__aarch64__)
+#include <time.h>
+#endif
+
+#define FSM_12B_LAT_BASE_RATE          0.2  /* s, base rate of fsm_12B */
+#define FSM_12B_LAT_SUB_BITS           4
+#define FSM_12B_LAT_SUB                (1 << FSM_12B_LAT_SUB_BITS)
+#define FSM_12B_LAT_BUCKETS            ((64 - FSM_12B_LAT_SUB_BITS + 1) * FSM_12B_LAT_SUB)
+
+/* Counters published on every step, all in counter ticks */
+typedef struct {
+  uint64_T steps;
+  uint64_T overruns;                   /* latency above the budget */
+  uint64_T skipped;                    /* entered while still running */
+  uint64_T total;                      /* sum of latencies */
+  uint64_T min;
+  uint64_T max;
+  uint64_T max_step;                   /* step index of max */
+  uint64_T hist[FSM_12B_LAT_BUCKETS];
+} fsm_12B_LatStats;
+
+typedef struct {
+  uint32_T seq;                        /* odd while an update is in flight */
+  boolean_T busy;                      /* between enter and exit */
+  uint64_T t_enter;
+  uint64_T budget;                     /* base rate in counter ticks */
+  real_T ticks_per_sec;                /* counter frequency */
+  fsm_12B_LatStats stats;
+} fsm_12B_Latency;
+
+/* Counter ticks per second, measured against CLOCK_MONOTONIC */
+extern real_T fsm_12B_lat_calibrate(void);
+
+/* Reset l; period is the step budget in seconds (FSM_12B_LAT_BASE_RATE) */
+extern void fsm_12B_lat_init(fsm_12B_Latency *l, real_T period);
+
+/*
+ * Consistent copy of the counters, safe against a concurrent recorder.
+ * Retries while an update is in flight.
+ */
+extern void fsm_12B_lat_snapshot(const fsm_12B_Latency *l, fsm_12B_LatStats
+  *out);
+
+/* Upper bound of the bucket holding quantile q (0..1) of a snapshot */
+extern uint64_T fsm_12B_lat_quantile(const fsm_12B_LatStats *s, real_T q);
+
+/* Bounds of histogram bucket b, in counter ticks */
+extern uint64_T fsm_12B_lat_bucket_low(int_T b);
+extern uint64_T fsm_12B_lat_bucket_high(int_T b);
+
+static inline uint64_T fsm_12B_lat_now(void)
+{
+
+#if defined(__x86_64__) || defined(__i386__)
+
+  return __rdtsc();
+
+#elif defined(__aarch64__)
+
+  uint64_T v;
+  __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (v));
+  return v;
+
+#else
+
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_T)ts.tv_sec * 1000000000U + (uint64_T)ts.tv_nsec;
+
+#endif
+
+}
+
+static inline int_T fsm_12B_lat_bucket(uint64_T v)
+{
+  int_T e;
+  if (v < (uint64_T)FSM_12B_LAT_SUB) {
+    return (int_T)v;
+  }
+
+  e = 63 - __builtin_clzll(v);
+  return ((e - FSM_12B_LAT_SUB_BITS + 1) << FSM_12B_LAT_SUB_BITS) | (int_T)((v
+    >> (e - FSM_12B_LAT_SUB_BITS)) & (uint64_T)(FSM_12B_LAT_SUB - 1));
+}
+
+/* Single-writer stores, ordered for fsm_12B_lat_snapshot */
+#define FSM_12B_LAT_PUT(x, v)          __atomic_store_n(&(x), (v), __ATOMIC_RELAXED)
+
+/*
+ * Start of a step.  Returns false, and counts a skipped step, when the
+ * previous step has not exited; the caller returns without stepping.
+ */
+static inline boolean_T fsm_12B_lat_enter(fsm_12B_Latency *l)
+{
+  if (l->busy) {
+    __atomic_store_n(&l->seq, l->seq + 1U, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    FSM_12B_LAT_PUT(l->stats.skipped, l->stats.skipped + 1U);
+    __atomic_store_n(&l->seq, l->seq + 1U, __ATOMIC_RELEASE);
+    return false;
+  }
+
+  l->busy = true;
+  l->t_enter = fsm_12B_lat_now();
+  return true;
+}
+
+/* End of a step entered with fsm_12B_lat_enter */
+static inline void fsm_12B_lat_exit(fsm_12B_Latency *l)
+{
+  const uint64_T d = fsm_12B_lat_now() - l->t_enter;
+  fsm_12B_LatStats *s = &l->stats;
+  const int_T b = fsm_12B_lat_bucket(d);
+  __atomic_store_n(&l->seq, l->seq + 1U, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  FSM_12B_LAT_PUT(s->hist[b], s->hist[b] + 1U);
+  FSM_12B_LAT_PUT(s->total, s->total + d);
+  if (d > s->max) {
+    FSM_12B_LAT_PUT(s->max, d);
+    FSM_12B_LAT_PUT(s->max_step, s->steps);
+  }
+
+  if (d < s->min) {
+    FSM_12B_LAT_PUT(s->min, d);
+  }
+
+  if (d > l->budget) {
+    FSM_12B_LAT_PUT(s->overruns, s->overruns + 1U);
+  }
+
+  FSM_12B_LAT_PUT(s->steps, s->steps + 1U);
+  __atomic_store_n(&l->seq, l->seq + 1U, __ATOMIC_RELEASE);
+  l->busy = false;
+}
+
+/* fsm_12B_step, timed when FSM_12B_LATENCY is defined */
+static inline void fsm_12B_step_timed(fsm_12B_Latency *l, RT_MODEL *const rtM,
+  boolean_T rtU_standby, boolean_T rtU_apfail, boolean_T rtU_supported,
+  boolean_T rtU_limits, boolean_T *rtY_pullup)
+{
+
+#ifdef FSM_12B_LATENCY
+
+  if (!fsm_12B_lat_enter(l)) {
+    return;
+  }
+
+  fsm_12B_step(rtM, rtU_standby, rtU_apfail, rtU_supported, rtU_limits,
+               rtY_pullup);
+  fsm_12B_lat_exit(l);
+
+#else
+
+  (void)l;
+  fsm_12B_step(rtM, rtU_standby, rtU_apfail, rtU_supported, rtU_limits,
+               rtY_pullup);
+
+#endif
+
+}
+
+#endif                                 /* fsm_12B_lat_h_ */
+
+/*
+ * File trailer for fsm_12B_lat.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,629 @@
+/*
+ * File: fsm_12B_ltl.c
+ *
+ * Online LTL monitors for Simulink model 'fsm_12B'.
+ */
+
+#include <string.h>
+#include "fsm_12B_ltl.h"
+#include "rtwtypes.h"
+
+typedef struct {
+  fsm_12B_LtlMonitor *mon;
+  const char_T *s;
+  int_T pos;
+} Parser;
+
+const char_T *const fsm_12B_ltl_requirements[FSM_12B_LTL_REQUIREMENTS] = {
+  "G((limits && !standby && supported && !apfail) -> pullup)",
+  "G((premode=0 && standby) -> mode=3)",
+  "G((premode=0 && supported) -> mode=1)",
+  "G((premode=1 && standby) -> mode=3)",
+  "G((premode=2 && standby) -> mode=3)",
+  "G((premode=3 && supported) -> mode=0)",
+  "G((premode=3 && !standby) -> mode=0)",
+  "G((premode=3 && apfail) -> mode=2)",
+  "G((presen=1 && limits) -> sen=2)",
+  "G((presen=1 && !supported) -> sen=0)",
+  "G((presen=2 && !supported && !limits) -> sen=0)",
+  "G((presen=0 && supported) -> sen=1)"
+};
+
+static const char_T *const signal_name[5] = { "standby", "apfail",
+  "supported", "limits", "pullup" };
+
+static const char_T *const mode_name[4] = { "transition", "nominal",
+  "maneuver", "standby" };
+
+static const char_T *const sen_name[3] = { "nominal", "transition", "fault" };
+
+static int_T imp(Parser *p);
+
+static int_T fail(Parser *p, const char_T *msg)
+{
+  if (p->mon->error == NULL) {
+    p->mon->error = msg;
+    p->mon->error_pos = p->pos;
+  }
+
+  return -1;
+}
+
+static void skip(Parser *p)
+{
+  while ((p->s[p->pos] == ' ') || (p->s[p->pos] == '\t') || (p->s[p->pos] ==
+          '\n')) {
+    p->pos++;
+  }
+}
+
+static boolean_T is_ident(char_T c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0')
+    && (c <= '9')) || (c == '_');
+}
+
+/* Length of the identifier at the current position */
+static int_T ident(Parser *p)
+{
+  int_T n = 0;
+  skip(p);
+  while (is_ident(p->s[p->pos + n])) {
+    n++;
+  }
+
+  return n;
+}
+
+static boolean_T ident_is(Parser *p, const char_T *word)
+{
+  const int_T n = ident(p);
+  return (n == (int_T)strlen(word)) && (strncmp(&p->s[p->pos], word, (size_t)n)
+    == 0);
+}
+
+static boolean_T accept(Parser *p, const char_T *tok)
+{
+  const size_t n = strlen(tok);
+  skip(p);
+  if (strncmp(&p->s[p->pos], tok, n) == 0) {
+    p->pos += (int_T)n;
+    return true;
+  }
+
+  return false;
+}
+
+static int_T node(Parser *p, uint8_T op, int_T l, int_T r, int_T delay)
+{
+  fsm_12B_LtlMonitor *mon = p->mon;
+  fsm_12B_LtlNode *d;
+  if (mon->nnodes >= FSM_12B_LTL_MAX_NODES) {
+    return fail(p, "formula too large");
+  }
+
+  if (delay > FSM_12B_LTL_MAX_DELAY) {
+    return fail(p, "future horizon exceeds 63 ticks");
+  }
+
+  d = &mon->node[mon->nnodes];
+  memset(d, 0, sizeof(fsm_12B_LtlNode));
+  d->op = op;
+  d->l = (int8_T)l;
+  d->r = (int8_T)r;
+  d->delay = (uint8_T)delay;
+  return mon->nnodes++;
+}
+
+static int_T delay_of(Parser *p, int_T i)
+{
+  return p->mon->node[i].delay;
+}
+
+static int_T max_delay(Parser *p, int_T l, int_T r)
+{
+  return (delay_of(p, l) > delay_of(p, r)) ? delay_of(p, l) : delay_of(p, r);
+}
+
+static int_T number(Parser *p, int_T *v)
+{
+  int_T n = 0;
+  skip(p);
+  if ((p->s[p->pos] < '0') || (p->s[p->pos] > '9')) {
+    return fail(p, "expected a number");
+  }
+
+  while ((p->s[p->pos] >= '0') && (p->s[p->pos] <= '9')) {
+    n = 10 * n + (p->s[p->pos++] - '0');
+    if (n > FSM_12B_LTL_MAX_DELAY) {
+      return fail(p, "bound exceeds 63 ticks");
+    }
+  }
+
+  *v = n;
+  return 0;
+}
+
+/* "[a,b]" after F, G or U */
+static int_T bounds(Parser *p, int_T *a, int_T *b)
+{
+  if (!accept(p, "[")) {
+    return fail(p, "unbounded future operator, give a window [a,b]");
+  }
+
+  if ((number(p, a) < 0) || !accept(p, ",") || (number(p, b) < 0) || !accept(p,
+       "]")) {
+    return fail(p, "malformed window, expected [a,b]");
+  }
+
+  if (*a > *b) {
+    return fail(p, "empty window");
+  }
+
+  return 0;
+}
+
+/* Value after "mode=" and the like, by number or by name */
+static int_T mode_value(Parser *p, const char_T *const *names, int_T count)
+{
+  int_T v;
+  skip(p);
+  if ((p->s[p->pos] >= '0') && (p->s[p->pos] <= '9')) {
+    if (number(p, &v) < 0) {
+      return -1;
+    }
+
+    if (v >= count) {
+      return fail(p, "mode value out of range");
+    }
+
+    return v;
+  }
+
+  for (v = 0; v < count; v++) {
+    if (ident_is(p, names[v])) {
+      p->pos += (int_T)strlen(names[v]);
+      return v;
+    }
+  }
+
+  return fail(p, "unknown mode name");
+}
+
+static int_T primary(Parser *p)
+{
+  static const char_T *const state_name[4] = { "premode", "presen", "mode",
+    "sen" };
+
+  int_T i;
+  if (accept(p, "(")) {
+    const int_T f = imp(p);
+    if ((f >= 0) && !accept(p, ")")) {
+      return fail(p, "expected )");
+    }
+
+    return f;
+  }
+
+  if (ident_is(p, "true") || ident_is(p, "false")) {
+    const uint8_T op = (uint8_T)((p->s[p->pos] == 't') ? FSM_12B_LTL_TRUE :
+      FSM_12B_LTL_FALSE);
+    p->pos += ident(p);
+    return node(p, op, -1, -1, 0);
+  }
+
+  for (i = 0; i < 5; i++) {
+    if (ident_is(p, signal_name[i])) {
+      int_T f;
+      p->pos += ident(p);
+      f = node(p, FSM_12B_LTL_SIGNAL, -1, -1, 0);
+      if (f >= 0) {
+        p->mon->node[f].arg = (uint8_T)i;
+      }
+
+      return f;
+    }
+  }
+
+  for (i = 0; i < 4; i++) {
+    if (ident_is(p, state_name[i])) {
+      const boolean_T sen = (boolean_T)((i & 1) != 0);
+      int_T v;
+      int_T f;
+      p->pos += ident(p);
+      if (!accept(p, "=")) {
+        return fail(p, "expected = after a mode");
+      }
+
+      v = sen ? mode_value(p, sen_name, 3) : mode_value(p, mode_name, 4);
+      if (v < 0) {
+        return -1;
+      }
+
+      f = node(p, (uint8_T)(FSM_12B_LTL_PREMODE + i), -1, -1, 0);
+      if (f >= 0) {
+        p->mon->node[f].arg = (uint8_T)v;
+      }
+
+      return f;
+    }
+  }
+
+  return fail(p, "expected a signal, a mode or (");
+}
+
+static int_T unary(Parser *p)
+{
+  int_T f;
+  int_T a;
+  int_T b;
+  if (accept(p, "!")) {
+    f = unary(p);
+    return (f < 0) ? -1 : node(p, FSM_12B_LTL_NOT, f, -1, delay_of(p, f));
+  }
+
+  if (ident_is(p, "X")) {
+    p->pos++;
+    f = unary(p);
+    if (f < 0) {
+      return -1;
+    }
+
+    f = node(p, FSM_12B_LTL_F, f, -1, delay_of(p, f) + 1);
+    if (f >= 0) {
+      p->mon->node[f].a = 1U;
+      p->mon->node[f].b = 1U;
+    }
+
+    return f;
+  }
+
+  if (ident_is(p, "Y") || ident_is(p, "H") || ident_is(p, "O")) {
+    const uint8_T op = (uint8_T)((p->s[p->pos] == 'Y') ? FSM_12B_LTL_Y :
+      (p->s[p->pos] == 'H') ? FSM_12B_LTL_H : FSM_12B_LTL_O);
+    p->pos++;
+    f = unary(p);
+    return (f < 0) ? -1 : node(p, op, f, -1, delay_of(p, f));
+  }
+
+  if (ident_is(p, "F") || ident_is(p, "G")) {
+    const uint8_T op = (uint8_T)((p->s[p->pos] == 'F') ? FSM_12B_LTL_F :
+      FSM_12B_LTL_G);
+    p->pos++;
+    if (bounds(p, &a, &b) < 0) {
+      return -1;
+    }
+
+    f = unary(p);
+    if (f < 0) {
+      return -1;
+    }
+
+    f = node(p, op, f, -1, delay_of(p, f) + b);
+    if (f >= 0) {
+      p->mon->node[f].a = (uint8_T)a;
+      p->mon->node[f].b = (uint8_T)b;
+    }
+
+    return f;
+  }
+
+  return primary(p);
+}
+
+static int_T binary_temporal(Parser *p)
+{
+  int_T l = unary(p);
+  int_T r;
+  int_T a;
+  int_T b;
+  if (l < 0) {
+    return -1;
+  }
+
+  if (ident_is(p, "S")) {
+    p->pos++;
+    r = unary(p);
+    return (r < 0) ? -1 : node(p, FSM_12B_LTL_S, l, r, max_delay(p, l, r));
+  }
+
+  if (ident_is(p, "U")) {
+    int_T f;
+    p->pos++;
+    if (bounds(p, &a, &b) < 0) {
+      return -1;
+    }
+
+    r = unary(p);
+    if (r < 0) {
+      return -1;
+    }
+
+    f = node(p, FSM_12B_LTL_U, l, r, max_delay(p, l, r) + b);
+    if (f >= 0) {
+      p->mon->node[f].a = (uint8_T)a;
+      p->mon->node[f].b = (uint8_T)b;
+    }
+
+    return f;
+  }
+
+  return l;
+}
+
+static int_T conjunction(Parser *p)
+{
+  int_T l = binary_temporal(p);
+  while ((l >= 0) && accept(p, "&&")) {
+    const int_T r = binary_temporal(p);
+    l = (r < 0) ? -1 : node(p, FSM_12B_LTL_AND, l, r, max_delay(p, l, r));
+  }
+
+  return l;
+}
+
+static int_T disjunction(Parser *p)
+{
+  int_T l = conjunction(p);
+  while ((l >= 0) && accept(p, "||")) {
+    const int_T r = conjunction(p);
+    l = (r < 0) ? -1 : node(p, FSM_12B_LTL_OR, l, r, max_delay(p, l, r));
+  }
+
+  return l;
+}
+
+static int_T imp(Parser *p)
+{
+  const int_T l = disjunction(p);
+  int_T r;
+  if ((l < 0) || !accept(p, "->")) {
+    return l;
+  }
+
+  r = imp(p);
+  return (r < 0) ? -1 : node(p, FSM_12B_LTL_IMPLIES, l, r, max_delay(p, l, r));
+}
+
+int_T fsm_12B_ltl_compile(fsm_12B_LtlMonitor *mon, const char_T *text)
+{
+  Parser p;
+  int_T root;
+  memset(mon, 0, sizeof(fsm_12B_LtlMonitor));
+  mon->text = text;
+  p.mon = mon;
+  p.s = text;
+  p.pos = 0;
+
+  /* Outer G without a window: invariant */
+  if (ident_is(&p, "G")) {
+    const int_T save = p.pos;
+    p.pos++;
+    skip(&p);
+    if (p.s[p.pos] == '[') {
+      p.pos = save;
+    } else {
+      mon->always = true;
+    }
+  }
+
+  root = imp(&p);
+  skip(&p);
+  if ((root >= 0) && (p.s[p.pos] != '\0')) {
+    root = fail(&p, "unexpected text after the formula");
+  }
+
+  if (root < 0) {
+    if (mon->error == NULL) {
+      (void)fail(&p, "syntax error");
+    }
+
+    return -1;
+  }
+
+  mon->delay = mon->node[root].delay;
+  fsm_12B_ltl_reset(mon);
+  return 0;
+}
+
+void fsm_12B_ltl_reset(fsm_12B_LtlMonitor *mon)
+{
+  int_T i;
+  for (i = 0; i < mon->nnodes; i++) {
+    mon->node[i].hist = 0U;
+    mon->node[i].state = (boolean_T)(mon->node[i].op == FSM_12B_LTL_H);
+  }
+
+  mon->ticks = 0U;
+  mon->checked = 0U;
+  mon->violations = 0U;
+  mon->first_violation = FSM_12B_LTL_NONE;
+}
+
+static uint64_T low_bits(int_T n)
+{
+  return (n >= 64) ? ~(uint64_T)0U : (((uint64_T)1U << n) - 1U);
+}
+
+boolean_T fsm_12B_ltl_step(fsm_12B_LtlMonitor *mon, const fsm_12B_LtlSample *s)
+{
+  const boolean_T signal[5] = { s->standby, s->apfail, s->supported, s->limits,
+    s->pullup };
+
+  fsm_12B_LtlNode *node = mon->node;
+  const int64_T n = (int64_T)mon->ticks;
+  int64_T t;
+  int_T i;
+  for (i = 0; i < mon->nnodes; i++) {
+    fsm_12B_LtlNode *d = &node[i];
+    const fsm_12B_LtlNode *L = (d->l >= 0) ? &node[d->l] : d;
+    const fsm_12B_LtlNode *R = (d->r >= 0) ? &node[d->r] : d;
+    const boolean_T live = (boolean_T)(n >= (int64_T)d->delay);
+    const boolean_T lv = (boolean_T)((L->hist >> (d->delay - L->delay)) & 1U);
+    const boolean_T rv = (boolean_T)((R->hist >> (d->delay - R->delay)) & 1U);
+    boolean_T v;
+    switch (d->op) {
+     case FSM_12B_LTL_TRUE:
+      v = true;
+      break;
+
+     case FSM_12B_LTL_FALSE:
+      v = false;
+      break;
+
+     case FSM_12B_LTL_SIGNAL:
+      v = signal[d->arg];
+      break;
+
+     case FSM_12B_LTL_PREMODE:
+      v = (boolean_T)(s->premode == d->arg);
+      break;
+
+     case FSM_12B_LTL_PRESEN:
+      v = (boolean_T)(s->presen == d->arg);
+      break;
+
+     case FSM_12B_LTL_MODE:
+      v = (boolean_T)(s->mode == d->arg);
+      break;
+
+     case FSM_12B_LTL_SEN:
+      v = (boolean_T)(s->sen == d->arg);
+      break;
+
+     case FSM_12B_LTL_NOT:
+      v = !lv;
+      break;
+
+     case FSM_12B_LTL_AND:
+      v = lv && rv;
+      break;
+
+     case FSM_12B_LTL_OR:
+      v = lv || rv;
+      break;
+
+     case FSM_12B_LTL_IMPLIES:
+      v = !lv || rv;
+      break;
+
+     case FSM_12B_LTL_Y:
+      /* Value one tick earlier; zero before tick 0 */
+      v = (boolean_T)((L->hist >> (d->delay - L->delay + 1)) & 1U);
+      break;
+
+     case FSM_12B_LTL_H:
+      if (live) {
+        d->state = d->state && lv;
+      }
+
+      v = live && d->state;
+      break;
+
+     case FSM_12B_LTL_O:
+      if (live) {
+        d->state = d->state || lv;
+      }
+
+      v = d->state;
+      break;
+
+     case FSM_12B_LTL_S:
+      if (live) {
+        d->state = rv || (lv && d->state);
+      }
+
+      v = d->state;
+      break;
+
+     case FSM_12B_LTL_F:
+     case FSM_12B_LTL_G:
+      {
+        /* Child bits 0..b-a are ticks t+b down to t+a */
+        const uint64_T m = low_bits(d->b - d->a + 1);
+        const uint64_T w = L->hist & m;
+        v = (d->op == FSM_12B_LTL_F) ? (boolean_T)(w != 0U) : (boolean_T)(w ==
+          m);
+      }
+      break;
+
+     default:
+      {
+        /* Bit j of P and Q is tick t+b-j */
+        const uint64_T P = L->hist >> (d->delay - d->b - L->delay);
+        const uint64_T Q = R->hist >> (d->delay - d->b - R->delay);
+        const uint64_T gaps = ~P & low_bits(d->b + 1);
+        int_T last = d->b;             /* latest i with phi on [t, t+i) */
+        if (gaps != 0U) {
+          last = d->b - (63 - __builtin_clzll(gaps));
+        }
+
+        v = (boolean_T)((last >= d->a) && ((Q & low_bits(d->b - d->a + 1) &
+          ~low_bits(d->b - last)) != 0U));
+      }
+      break;
+    }
+
+    d->hist = (d->hist << 1) | (uint64_T)(v && live);
+  }
+
+  mon->ticks++;
+  t = n - mon->delay;
+  if ((t < 0) || (!mon->always && (t > 0))) {
+    return true;
+  }
+
+  mon->checked++;
+  if ((node[mon->nnodes - 1].hist & 1U) != 0U) {
+    return true;
+  }
+
+  mon->violations++;
+  if (mon->first_violation == FSM_12B_LTL_NONE) {
+    mon->first_violation = (uint64_T)t;
+  }
+
+  return false;
+}
+
+uint8_T fsm_12B_ltl_mode(real_T v)
+{
+  if ((v == 0.0) || (v == 1.0) || (v == 2.0) || (v == 3.0)) {
+    return (uint8_T)v;
+  }
+
+  return FSM_12B_LTL_BAD_MODE;
+}
+
+int_T fsm_12B_ltl_step_model(fsm_12B_LtlSet *set, RT_MODEL *const rtM,
+  boolean_T rtU_standby, boolean_T rtU_apfail, boolean_T rtU_supported,
+  boolean_T rtU_limits, boolean_T *rtY_pullup)
+{
+  fsm_12B_LtlSample s;
+  int_T bad = 0;
+  int_T i;
+  s.premode = fsm_12B_ltl_mode(rtM->dwork->Merge);
+  s.presen = fsm_12B_ltl_mode(rtM->dwork->Merge_g);
+  fsm_12B_step(rtM, rtU_standby, rtU_apfail, rtU_supported, rtU_limits,
+               rtY_pullup);
+  s.standby = rtU_standby;
+  s.apfail = rtU_apfail;
+  s.supported = rtU_supported;
+  s.limits = rtU_limits;
+  s.pullup = *rtY_pullup;
+  s.mode = fsm_12B_ltl_mode(rtM->dwork->Merge);
+  s.sen = fsm_12B_ltl_mode(rtM->dwork->Merge_g);
+  for (i = 0; i < set->n; i++) {
+    if (!fsm_12B_ltl_step(set->mon[i], &s)) {
+      bad++;
+    }
+  }
+
+  return bad;
+}
+
+/*
+ * File trailer for fsm_12B_ltl.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,150 @@
+/*
+ * File: fsm_12B_ltl.h
+ *
+ * Online LTL monitors for Simulink model 'fsm_12B'.
+ *
+ * A formula is compiled once into a fixed array of nodes and then
+ * advanced by one sample per base-rate tick, in lockstep with
+ * fsm_12B_step.  Past-time operators keep one bit of state.  Future
+ * operators must be bounded; they are evaluated with a delay equal to
+ * their horizon, over a 64-tick history word per node, so the verdict for
+ * tick t is known at tick t + delay.  Every tick costs O(1) per node and
+ * nothing is allocated.
+ *
+ * Syntax, loosest binding first:
+ *
+ *   G f                    f at every tick (only as the outermost operator)
+ *   f -> f                 right associative
+ *   f || f
+ *   f && f
+ *   f S f,  f U[a,b] f     since, bounded until
+ *   !f  X f  Y f  H f  O f  F[a,b] f  G[a,b] f
+ *   (f)  true  false
+ *   standby apfail supported limits pullup
+ *   mode=m  sen=s          '<S4>/Merge', '<S14>/Merge' after the step
+ *   premode=m  presen=s    the same before the step
+ *
+ * m is 0..3 or transition, nominal, maneuver, standby; s is 0..2 or
+ * nominal, transition, fault, as numbered in fsm_12B.c.  Without the
+ * outer G a formula is only checked at tick 0.
+ */
+
+#ifndef fsm_12B_ltl_h_
+#define fsm_12B_ltl_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+
+#define FSM_12B_LTL_MAX_NODES          48
+#define FSM_12B_LTL_MAX_DELAY          63   /* ticks, fits the history word */
+#define FSM_12B_LTL_MAX_MONITORS       32
+#define FSM_12B_LTL_NONE               (~(uint64_T)0U)
+#define FSM_12B_LTL_BAD_MODE           ((uint8_T)0xFFU)
+#define FSM_12B_LTL_REQUIREMENTS       12
+
+/* Node operators */
+enum {
+  FSM_12B_LTL_TRUE = 0,
+  FSM_12B_LTL_FALSE,
+  FSM_12B_LTL_SIGNAL,                  /* arg: index into the sample */
+  FSM_12B_LTL_PREMODE,                 /* arg: compared value */
+  FSM_12B_LTL_PRESEN,
+  FSM_12B_LTL_MODE,
+  FSM_12B_LTL_SEN,
+  FSM_12B_LTL_NOT,
+  FSM_12B_LTL_AND,
+  FSM_12B_LTL_OR,
+  FSM_12B_LTL_IMPLIES,
+  FSM_12B_LTL_Y,
+  FSM_12B_LTL_H,
+  FSM_12B_LTL_O,
+  FSM_12B_LTL_S,
+  FSM_12B_LTL_F,                       /* also X, as F[1,1] */
+  FSM_12B_LTL_G,
+  FSM_12B_LTL_U
+};
+
+/* Signals of one tick */
+typedef struct {
+  boolean_T standby;                   /* '<Root>/standby' */
+  boolean_T apfail;                    /* '<Root>/apfail' */
+  boolean_T supported;                 /* '<Root>/supported' */
+  boolean_T limits;                    /* '<Root>/limits' */
+  boolean_T pullup;                    /* '<Root>/pullup' */
+  uint8_T premode;                     /* '<S4>/Merge' before the step */
+  uint8_T presen;                      /* '<S14>/Merge' before the step */
+  uint8_T mode;                        /* '<S4>/Merge' after the step */
+  uint8_T sen;                         /* '<S14>/Merge' after the step */
+} fsm_12B_LtlSample;
+
+/* Children always precede their parent, the root is the last node */
+typedef struct {
+  uint8_T op;
+  uint8_T arg;                         /* atom, or compared mode value */
+  int8_T l;                            /* child nodes, -1 if none */
+  int8_T r;
+  uint8_T a;                           /* window [a, b] */
+  uint8_T b;
+  uint8_T delay;                       /* ticks behind the newest sample */
+  boolean_T state;                     /* H, O, S */
+  uint64_T hist;                       /* bit j: value j ticks ago */
+} fsm_12B_LtlNode;
+
+typedef struct {
+  const char_T *text;
+  fsm_12B_LtlNode node[FSM_12B_LTL_MAX_NODES];
+  int_T nnodes;
+  boolean_T always;                    /* outer G */
+  int_T delay;                         /* of the root */
+  uint64_T ticks;                      /* samples consumed */
+  uint64_T checked;                    /* ticks with a verdict */
+  uint64_T violations;
+  uint64_T first_violation;            /* tick, or FSM_12B_LTL_NONE */
+  const char_T *error;                 /* set by fsm_12B_ltl_compile */
+  int_T error_pos;
+} fsm_12B_LtlMonitor;
+
+typedef struct {
+  fsm_12B_LtlMonitor *mon[FSM_12B_LTL_MAX_MONITORS];
+  int_T n;
+} fsm_12B_LtlSet;
+
+/*
+ * Requirements 1 to 3 and 5 to 13 of 1_fsm/fsm_12B_ert_rtw/ert_main.c with
+ * OverrunFlag false.  Requirement 4 only applies when OverrunFlag is set.
+ */
+extern const char_T *const fsm_12B_ltl_requirements[FSM_12B_LTL_REQUIREMENTS];
+
+/*
+ * Compile text into mon.  text must outlive mon.  Returns 0, or -1 with
+ * mon->error and mon->error_pos describing the problem.
+ */
+extern int_T fsm_12B_ltl_compile(fsm_12B_LtlMonitor *mon, const char_T *text);
+
+/* Restart mon at tick 0 */
+extern void fsm_12B_ltl_reset(fsm_12B_LtlMonitor *mon);
+
+/*
+ * Consume the sample of the next tick.  Returns false when this resolves
+ * a violation, of tick mon->ticks - 1 - mon->delay.
+ */
+extern boolean_T fsm_12B_ltl_step(fsm_12B_LtlMonitor *mon, const
+  fsm_12B_LtlSample *s);
+
+/* Mode of a '<S4>/Merge' or '<S14>/Merge' value */
+extern uint8_T fsm_12B_ltl_mode(real_T v);
+
+/*
+ * fsm_12B_step followed by one step of every monitor of set.  Returns the
+ * number of violations resolved on this tick.
+ */
+extern int_T fsm_12B_ltl_step_model(fsm_12B_LtlSet *set, RT_MODEL *const rtM,
+  boolean_T rtU_standby, boolean_T rtU_apfail, boolean_T rtU_supported,
+  boolean_T rtU_limits, boolean_T *rtY_pullup);
+
+#endif                                 /* fsm_12B_ltl_h_ */
+
+/*
+ * File trailer for fsm_12B_ltl.h
+ *
+ * [EOF]
+ */
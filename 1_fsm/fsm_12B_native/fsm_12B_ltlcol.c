@@ -0,0 +1,531 @@
+/*
+ * File: fsm_12B_ltlcol.c
+ *
+ * Offline LTL evaluation over packed fsm_12B traces.
+ *
+ * The word loops take restrict-qualified columns and have no
+ * data-dependent control flow, so they vectorize when built with -O3 and
+ * an -march that has AVX2 or wider.  Only the carry chains of Y, H, O and
+ * S run word by word.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "fsm_12B_ltlcol.h"
+#include "fsm_12B_trace.h"
+#include "rtwtypes.h"
+
+#define FSM_12B_LTLCOL_MAX_THREADS     64
+#define W                              FSM_12B_LTLCOL_WORDS
+#define NW                             (FSM_12B_LTLCOL_WORDS + 1)
+#define ONES                           (~(uint64_T)0U)
+
+/* Signal columns of one block, word W is the lookahead */
+typedef struct {
+  uint64_T sig[5][NW];                 /* standby apfail supported limits
+                                          pullup */
+  uint64_T premode[4][NW];             /* '<S4>/Merge' == m before the step */
+  uint64_T presen[3][NW];              /* '<S14>/Merge' == s before the step */
+  uint64_T mode[4][NW];                /* the same after the step */
+  uint64_T sen[3][NW];
+} Columns;
+
+/* Node columns of one formula */
+typedef struct {
+  const fsm_12B_LtlMonitor *mon;
+  uint64_T val[FSM_12B_LTL_MAX_NODES][NW];
+  uint64_T carry[FSM_12B_LTL_MAX_NODES]; /* Y, H, O, S across blocks */
+} Formula;
+
+/* Sequential tick source over the blocks of a trace */
+typedef struct {
+  fsm_12B_TraceReader r;
+  const fsm_12B_TraceTick *ticks;
+  int_T n;                             /* ticks of the current block */
+  int_T i;                             /* next tick in it */
+  uint64_T b;                          /* next block */
+  boolean_T failed;
+} Source;
+
+typedef struct {
+  const fsm_12B_LtlMonitor *const *mon;
+  int_T n;
+  const char_T *const *paths;
+  int_T npaths;
+  fsm_12B_LtlColResult *res;
+  int_T *status;
+  int_T next;                          /* next unchecked path */
+  pthread_mutex_t lock;
+} Job;
+
+/* Fill words from..W of every column with the next ticks, zero past the end */
+static void fill(Columns *c, Source *src, int_T from)
+{
+  int_T w;
+  int_T k;
+  for (w = from; w < NW; w++) {
+    uint64_T sig[5] = { 0U, 0U, 0U, 0U, 0U };
+
+    uint64_T mode[4] = { 0U, 0U, 0U, 0U };
+
+    uint64_T sen[4] = { 0U, 0U, 0U, 0U };
+
+    int_T j;
+    for (j = 0; j < 64; j++) {
+      const fsm_12B_TraceTick *t;
+      const uint64_T bit = (uint64_T)1U << j;
+      if (src->i == src->n) {
+        if (src->failed || (src->b >= src->r.nblocks)) {
+          break;
+        }
+
+        src->n = fsm_12B_trace_read_block(&src->r, src->b++, &src->ticks);
+        src->i = 0;
+        if (src->n <= 0) {
+          src->n = 0;
+          src->failed = true;
+          break;
+        }
+      }
+
+      t = &src->ticks[src->i++];
+      sig[0] |= (t->inputs & 1U) ? bit : 0U;
+      sig[1] |= (t->inputs & 2U) ? bit : 0U;
+      sig[2] |= (t->inputs & 4U) ? bit : 0U;
+      sig[3] |= (t->inputs & 8U) ? bit : 0U;
+      sig[4] |= t->rtY_pullup ? bit : 0U;
+      mode[t->Merge & 3U] |= bit;
+      sen[t->Merge_g & 3U] |= bit;
+    }
+
+    for (k = 0; k < 5; k++) {
+      c->sig[k][w] = sig[k];
+    }
+
+    for (k = 0; k < 4; k++) {
+      c->mode[k][w] = mode[k];
+    }
+
+    for (k = 0; k < 3; k++) {
+      c->sen[k][w] = sen[k];
+    }
+  }
+}
+
+/* out = x shifted one tick later, with bit 0 taken from in */
+static void shl1(uint64_T *restrict out, const uint64_T *restrict x, uint64_T
+                 in)
+{
+  int_T w;
+  out[0] = (x[0] << 1) | in;
+  for (w = 1; w < NW; w++) {
+    out[w] = (x[w] << 1) | (x[w - 1] >> 63);
+  }
+}
+
+/* Bit t of the result is bit t + k of y, 0 < k < 64 */
+static uint64_T shr_word(const uint64_T *y, int_T w, int_T k)
+{
+  return (w + 1 < NW) ? ((y[w] >> k) | (y[w + 1] << (64 - k))) : (y[w] >> k);
+}
+
+/* out = x | (y k ticks later) */
+static void or_shr(uint64_T *restrict out, const uint64_T *restrict x, const
+                   uint64_T *restrict y, int_T k)
+{
+  int_T w;
+  if (k == 0) {
+    for (w = 0; w < NW; w++) {
+      out[w] = x[w] | y[w];
+    }
+  } else {
+    for (w = 0; w < W; w++) {
+      out[w] = x[w] | (y[w] >> k) | (y[w + 1] << (64 - k));
+    }
+
+    out[W] = x[W] | (y[W] >> k);
+  }
+}
+
+/* out = x & (y k ticks later) */
+static void and_shr(uint64_T *restrict out, const uint64_T *restrict x, const
+                    uint64_T *restrict y, int_T k)
+{
+  int_T w;
+  if (k == 0) {
+    for (w = 0; w < NW; w++) {
+      out[w] = x[w] & y[w];
+    }
+  } else {
+    for (w = 0; w < W; w++) {
+      out[w] = x[w] & ((y[w] >> k) | (y[w + 1] << (64 - k)));
+    }
+
+    out[W] = x[W] & (y[W] >> k);
+  }
+}
+
+/*
+ * One word of s_t = r_t || (l_t && s_t-1).  With g = r and p = l | r the
+ * carry out of bit t of g + p + carry is exactly s_t, so a single add
+ * resolves the whole chain; *c carries s into the next word.
+ */
+static uint64_T since_word(uint64_T l, uint64_T r, uint64_T *c)
+{
+  const uint64_T p = l | r;
+  const uint64_T s1 = r + p;
+  const uint64_T s = s1 + *c;
+  const uint64_T out = (uint64_T)((s1 < r) || (s < s1));
+  const uint64_T cin = s ^ r ^ p;      /* bit t: carry into bit t */
+  *c = out;
+  return (cin >> 1) | (out << 63);
+}
+
+/*
+ * F[a,b] or G[a,b] of x into out.  The window is widened by doubling over
+ * the scratch columns t0 and t1, then moved a ticks later.
+ */
+static void window(uint64_T *restrict out, const uint64_T *x, int_T a, int_T
+                   b, boolean_T all, uint64_T *t0, uint64_T *t1)
+{
+  const uint64_T *cur = x;
+  const int_T n = b - a + 1;
+  int_T s = 1;
+  int_T w;
+  while (s < n) {
+    uint64_T *dst = (cur == t0) ? t1 : t0;
+    const int_T k = (2 * s <= n) ? s : n - s;
+    if (all) {
+      and_shr(dst, cur, cur, k);
+    } else {
+      or_shr(dst, cur, cur, k);
+    }
+
+    cur = dst;
+    s += k;
+  }
+
+  for (w = 0; w < NW; w++) {
+    out[w] = (a == 0) ? cur[w] : shr_word(cur, w, a);
+  }
+}
+
+/* Evaluate every node of f over the current block */
+static void eval(Formula *f, const Columns *c, uint64_T *t0, uint64_T *t1)
+{
+  const fsm_12B_LtlMonitor *mon = f->mon;
+  int_T i;
+  int_T w;
+  for (i = 0; i < mon->nnodes; i++) {
+    const fsm_12B_LtlNode *d = &mon->node[i];
+    uint64_T *restrict out = f->val[i];
+    const uint64_T *L = f->val[(d->l >= 0) ? d->l : i];
+    const uint64_T *R = f->val[(d->r >= 0) ? d->r : i];
+    uint64_T carry = f->carry[i];
+    uint64_T saved = 0U;
+    switch (d->op) {
+     case FSM_12B_LTL_TRUE:
+     case FSM_12B_LTL_FALSE:
+      for (w = 0; w < NW; w++) {
+        out[w] = (d->op == FSM_12B_LTL_TRUE) ? ONES : 0U;
+      }
+      break;
+
+     case FSM_12B_LTL_SIGNAL:
+      memcpy(out, c->sig[d->arg], sizeof(c->sig[0]));
+      break;
+
+     case FSM_12B_LTL_PREMODE:
+      memcpy(out, c->premode[d->arg], sizeof(c->premode[0]));
+      break;
+
+     case FSM_12B_LTL_PRESEN:
+      memcpy(out, c->presen[d->arg], sizeof(c->presen[0]));
+      break;
+
+     case FSM_12B_LTL_MODE:
+      memcpy(out, c->mode[d->arg], sizeof(c->mode[0]));
+      break;
+
+     case FSM_12B_LTL_SEN:
+      memcpy(out, c->sen[d->arg], sizeof(c->sen[0]));
+      break;
+
+     case FSM_12B_LTL_NOT:
+      for (w = 0; w < NW; w++) {
+        out[w] = ~L[w];
+      }
+      break;
+
+     case FSM_12B_LTL_AND:
+      for (w = 0; w < NW; w++) {
+        out[w] = L[w] & R[w];
+      }
+      break;
+
+     case FSM_12B_LTL_OR:
+      for (w = 0; w < NW; w++) {
+        out[w] = L[w] | R[w];
+      }
+      break;
+
+     case FSM_12B_LTL_IMPLIES:
+      for (w = 0; w < NW; w++) {
+        out[w] = ~L[w] | R[w];
+      }
+      break;
+
+     case FSM_12B_LTL_Y:
+      shl1(out, L, carry);
+      f->carry[i] = L[W - 1] >> 63;
+      break;
+
+     case FSM_12B_LTL_H:
+     case FSM_12B_LTL_O:
+     case FSM_12B_LTL_S:
+      /* H f is !O !f, so every carry starts at 0 */
+      for (w = 0; w < NW; w++) {
+        if (d->op == FSM_12B_LTL_S) {
+          out[w] = since_word(L[w], R[w], &carry);
+        } else if (d->op == FSM_12B_LTL_O) {
+          out[w] = since_word(ONES, L[w], &carry);
+        } else {
+          out[w] = ~since_word(ONES, ~L[w], &carry);
+        }
+
+        if (w == W - 1) {
+          saved = carry;
+        }
+      }
+
+      f->carry[i] = saved;
+      break;
+
+     case FSM_12B_LTL_F:
+     case FSM_12B_LTL_G:
+      window(out, L, d->a, d->b, (boolean_T)(d->op == FSM_12B_LTL_G), t0, t1);
+      break;
+
+     default:
+      {
+        /* Backward over the window: t0 holds "l on [t, t+j)" */
+        int_T j;
+        for (w = 0; w < NW; w++) {
+          out[w] = 0U;
+          t0[w] = ONES;
+        }
+
+        for (j = 0; j <= d->b; j++) {
+          if (j >= d->a) {
+            for (w = 0; w < NW; w++) {
+              out[w] |= t0[w] & ((j == 0) ? R[w] : shr_word(R, w, j));
+            }
+          }
+
+          and_shr(t1, t0, L, j);
+          memcpy(t0, t1, sizeof(uint64_T) * NW);
+        }
+      }
+      break;
+    }
+  }
+}
+
+/* Count the verdicts of the root of f for ticks base..base + 64 W - 1 */
+static void verdicts(const Formula *f, uint64_T base, uint64_T ticks,
+                     fsm_12B_LtlColResult *res)
+{
+  const fsm_12B_LtlMonitor *mon = f->mon;
+  const uint64_T *root = f->val[mon->nnodes - 1];
+  uint64_T limit = (ticks > (uint64_T)mon->delay) ? ticks - (uint64_T)
+    mon->delay : 0U;
+  int_T w;
+  if (!mon->always && (limit > 1U)) {
+    limit = 1U;
+  }
+
+  for (w = 0; w < W; w++) {
+    const uint64_T lo = base + 64U * (uint64_T)w;
+    uint64_T mask;
+    uint64_T bad;
+    if (lo >= limit) {
+      break;
+    }
+
+    mask = (limit - lo >= 64U) ? ONES : (((uint64_T)1U << (limit - lo)) - 1U);
+    bad = ~root[w] & mask;
+    res->checked += (uint64_T)__builtin_popcountll(mask);
+    if (bad != 0U) {
+      res->violations += (uint64_T)__builtin_popcountll(bad);
+      if (res->first_violation == FSM_12B_LTL_NONE) {
+        res->first_violation = lo + (uint64_T)__builtin_ctzll(bad);
+      }
+    }
+  }
+}
+
+int_T fsm_12B_ltlcol_check(const fsm_12B_LtlMonitor *const *mon, int_T n,
+  const char_T *path, fsm_12B_LtlColResult *res)
+{
+  Columns *c;
+  Formula *f;
+  uint64_T *scratch;
+  Source src;
+  uint64_T premode = 1U;               /* '<S4>/Merge' == m at tick -1 */
+  uint64_T presen = 1U;
+  uint64_T base;
+  int_T status = 0;
+  int_T i;
+  int_T k;
+  for (i = 0; i < n; i++) {
+    res[i].ticks = 0U;
+    res[i].checked = 0U;
+    res[i].violations = 0U;
+    res[i].first_violation = FSM_12B_LTL_NONE;
+  }
+
+  memset(&src, 0, sizeof(Source));
+  if (fsm_12B_trace_open(&src.r, path) != 0) {
+    return -1;
+  }
+
+  c = (Columns *)malloc(sizeof(Columns));
+  f = (Formula *)calloc((size_t)n + 1U, sizeof(Formula));
+  scratch = (uint64_T *)malloc(2U * NW * sizeof(uint64_T));
+  if ((c == NULL) || (f == NULL) || (scratch == NULL)) {
+    status = -1;
+  } else {
+    for (i = 0; i < n; i++) {
+      f[i].mon = mon[i];
+    }
+
+    fill(c, &src, 0);
+    for (base = 0U; base < src.r.ticks; base += 64U * W) {
+      /* Pre-step modes are the post-step modes one tick earlier */
+      for (k = 0; k < 4; k++) {
+        shl1(c->premode[k], c->mode[k], (premode >> k) & 1U);
+      }
+
+      for (k = 0; k < 3; k++) {
+        shl1(c->presen[k], c->sen[k], (presen >> k) & 1U);
+      }
+
+      for (i = 0; i < n; i++) {
+        eval(&f[i], c, scratch, &scratch[NW]);
+        verdicts(&f[i], base, src.r.ticks, &res[i]);
+      }
+
+      /* Carry into the next block and slide the lookahead word down */
+      premode = 0U;
+      presen = 0U;
+      for (k = 0; k < 4; k++) {
+        premode |= (c->mode[k][W - 1] >> 63) << k;
+      }
+
+      for (k = 0; k < 3; k++) {
+        presen |= (c->sen[k][W - 1] >> 63) << k;
+      }
+
+      for (k = 0; k < 5; k++) {
+        c->sig[k][0] = c->sig[k][W];
+      }
+
+      for (k = 0; k < 4; k++) {
+        c->mode[k][0] = c->mode[k][W];
+      }
+
+      for (k = 0; k < 3; k++) {
+        c->sen[k][0] = c->sen[k][W];
+      }
+
+      fill(c, &src, 1);
+    }
+
+    for (i = 0; i < n; i++) {
+      res[i].ticks = src.r.ticks;
+    }
+
+    if (src.failed) {
+      status = -1;
+    }
+  }
+
+  free(scratch);
+  free(f);
+  free(c);
+  fsm_12B_trace_close(&src.r);
+  return status;
+}
+
+static void *fsm_12B_ltlcol_worker(void *arg)
+{
+  Job *job = (Job *)arg;
+  for (;;) {
+    int_T p;
+    pthread_mutex_lock(&job->lock);
+    p = job->next++;
+    pthread_mutex_unlock(&job->lock);
+    if (p >= job->npaths) {
+      break;
+    }
+
+    job->status[p] = fsm_12B_ltlcol_check(job->mon, job->n, job->paths[p],
+      &job->res[(size_t)p * (size_t)job->n]);
+  }
+
+  return NULL;
+}
+
+void fsm_12B_ltlcol_run(const fsm_12B_LtlMonitor *const *mon, int_T n, const
+  char_T *const *paths, int_T npaths, int_T threads, fsm_12B_LtlColResult *res,
+  int_T *status)
+{
+  pthread_t tid[FSM_12B_LTLCOL_MAX_THREADS];
+  boolean_T started[FSM_12B_LTLCOL_MAX_THREADS];
+  Job job;
+  int_T i;
+  if (threads <= 0) {
+    threads = (int_T)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  if (threads > FSM_12B_LTLCOL_MAX_THREADS) {
+    threads = FSM_12B_LTLCOL_MAX_THREADS;
+  }
+
+  if (threads > npaths) {
+    threads = npaths;
+  }
+
+  job.mon = mon;
+  job.n = n;
+  job.paths = paths;
+  job.npaths = npaths;
+  job.res = res;
+  job.status = status;
+  job.next = 0;
+  pthread_mutex_init(&job.lock, NULL);
+
+  /* The calling thread is worker 0 */
+  for (i = 1; i < threads; i++) {
+    started[i] = (boolean_T)(pthread_create(&tid[i], NULL,
+      fsm_12B_ltlcol_worker, &job) == 0);
+  }
+
+  (void)fsm_12B_ltlcol_worker(&job);
+  for (i = 1; i < threads; i++) {
+    if (started[i]) {
+      (void)pthread_join(tid[i], NULL);
+    }
+  }
+
+  pthread_mutex_destroy(&job.lock);
+}
+
+/*
+ * File trailer for fsm_12B_ltlcol.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,52 @@
+/*
+ * File: fsm_12B_ltlcol.h
+ *
+ * Offline LTL evaluation over packed fsm_12B traces.
+ *
+ * Formulas are compiled with fsm_12B_ltl_compile and evaluated a column
+ * block at a time: every node of a formula gets one bit per tick, 64 ticks
+ * to a word, over FSM_12B_LTLCOL_WORDS words plus one word of lookahead
+ * for the bounded future operators.  Boolean operators are word-wise,
+ * past-time operators are shifts and carry chains with one carry word
+ * between blocks, and F, G and U are backward scans over shifted
+ * children.  The verdicts match fsm_12B_ltl_step fed the same trace.
+ */
+
+#ifndef fsm_12B_ltlcol_h_
+#define fsm_12B_ltlcol_h_
+#include "rtwtypes.h"
+#include "fsm_12B_ltl.h"
+
+#define FSM_12B_LTLCOL_WORDS           64   /* 4096 ticks per column block */
+
+/* Verdict of one formula over one trace */
+typedef struct {
+  uint64_T ticks;                      /* of the trace */
+  uint64_T checked;                    /* ticks with a verdict */
+  uint64_T violations;
+  uint64_T first_violation;            /* tick, or FSM_12B_LTL_NONE */
+} fsm_12B_LtlColResult;
+
+/*
+ * Evaluate the n compiled formulas mon[] over the trace at path.  Returns
+ * 0, or -1 if the trace cannot be read; res[0..n-1] is filled either way.
+ */
+extern int_T fsm_12B_ltlcol_check(const fsm_12B_LtlMonitor *const *mon, int_T
+  n, const char_T *path, fsm_12B_LtlColResult *res);
+
+/*
+ * fsm_12B_ltlcol_check on every path, with threads workers taking the
+ * next unchecked trace.  res[p * n + i] is formula i over path p and
+ * status[p] its return value.
+ */
+extern void fsm_12B_ltlcol_run(const fsm_12B_LtlMonitor *const *mon, int_T n,
+  const char_T *const *paths, int_T npaths, int_T threads,
+  fsm_12B_LtlColResult *res, int_T *status);
+
+#endif                                 /* fsm_12B_ltlcol_h_ */
+
+/*
+ * File trailer for fsm_12B_ltlcol.h
+ *
+ * [EOF]
+ */
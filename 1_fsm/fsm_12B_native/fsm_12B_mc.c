@@ -0,0 +1,323 @@
+/*
+ * File: fsm_12B_mc.c
+ *
+ * Monte Carlo campaigns over Simulink model 'fsm_12B'.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "fsm_12B_mc.h"
+#include "rtwtypes.h"
+
+/* Philox4x32-10 constants */
+#define PHILOX_M0                      0xD2511F53U
+#define PHILOX_M1                      0xCD9E8D57U
+#define PHILOX_W0                      0x9E3779B9U
+#define PHILOX_W1                      0xBB67AE85U
+
+/* Per-input thresholds: an input is true when its 32-bit draw is below */
+typedef struct {
+  uint64_T thr[4];
+  uint32_T key[2];
+} fsm_12B_McStream;
+
+typedef struct {
+  const fsm_12B_McConfig *cfg;
+  const uint8_T *tbl;
+  uint64_T first;
+  uint64_T count;
+  fsm_12B_McStats stats;
+} fsm_12B_McShard;
+
+static void philox4x32_10(uint32_T ctr[4], const uint32_T key[2])
+{
+  uint32_T k0 = key[0];
+  uint32_T k1 = key[1];
+  int_T r;
+  for (r = 0; r < 10; r++) {
+    const uint64_T p0 = (uint64_T)PHILOX_M0 * ctr[0];
+    const uint64_T p1 = (uint64_T)PHILOX_M1 * ctr[2];
+    const uint32_T c1 = ctr[1];
+    const uint32_T c3 = ctr[3];
+    ctr[0] = (uint32_T)(p1 >> 32) ^ c1 ^ k0;
+    ctr[1] = (uint32_T)p1;
+    ctr[2] = (uint32_T)(p0 >> 32) ^ c3 ^ k1;
+    ctr[3] = (uint32_T)p0;
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+}
+
+static uint64_T fsm_12B_mc_threshold(real_T p)
+{
+  if (!(p > 0.0)) {
+    return 0U;
+  }
+
+  if (p >= 1.0) {
+    return (uint64_T)1U << 32;
+  }
+
+  return (uint64_T)(p * 4294967296.0);
+}
+
+static void fsm_12B_mc_stream(const fsm_12B_McConfig *cfg, fsm_12B_McStream *st)
+{
+  st->thr[0] = fsm_12B_mc_threshold(cfg->p_standby);
+  st->thr[1] = fsm_12B_mc_threshold(cfg->p_apfail);
+  st->thr[2] = fsm_12B_mc_threshold(cfg->p_supported);
+  st->thr[3] = fsm_12B_mc_threshold(cfg->p_limits);
+  st->key[0] = (uint32_T)cfg->seed;
+  st->key[1] = (uint32_T)(cfg->seed >> 32);
+}
+
+/* One Philox block per tick: one 32-bit draw per input */
+static uint32_T fsm_12B_mc_draw(const fsm_12B_McStream *st, uint64_T i,
+  uint32_T t)
+{
+  uint32_T ctr[4];
+  ctr[0] = t;
+  ctr[1] = (uint32_T)i;
+  ctr[2] = (uint32_T)(i >> 32);
+  ctr[3] = 0U;
+  philox4x32_10(ctr, st->key);
+  return (uint32_T)((uint64_T)ctr[0] < st->thr[0]) | ((uint32_T)((uint64_T)
+    ctr[1] < st->thr[1]) << 1) | ((uint32_T)((uint64_T)ctr[2] < st->thr[2]) <<
+    2) | ((uint32_T)((uint64_T)ctr[3] < st->thr[3]) << 3);
+}
+
+static int_T fsm_12B_mc_log2(uint64_T n)
+{
+  int_T b = 0;
+  while (n > 1U) {
+    n >>= 1;
+    b++;
+  }
+
+  return b;
+}
+
+uint32_T fsm_12B_mc_inputs(const fsm_12B_McConfig *cfg, uint64_T i, uint32_T t)
+{
+  fsm_12B_McStream st;
+  fsm_12B_mc_stream(cfg, &st);
+  return fsm_12B_mc_draw(&st, i, t);
+}
+
+void fsm_12B_mc_clear(fsm_12B_McStats *stats)
+{
+  int_T r;
+  memset(stats, 0, sizeof(fsm_12B_McStats));
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    stats->first_violation[r] = FSM_12B_MC_NONE;
+  }
+}
+
+void fsm_12B_mc_shard(const fsm_12B_McConfig *cfg, const uint8_T *tbl,
+                      uint64_T first, uint64_T count, fsm_12B_McStats *stats)
+{
+  fsm_12B_McStream st;
+  RT_MODEL rtM;
+  DW rtDW;
+  DW dw[FSM_12B_TABLE_STATES];
+  uint64_T i;
+  uint8_T s0 = 0U;
+  fsm_12B_mc_stream(cfg, &st);
+
+  /* Requirement predicates read DW; every table state has a fixed one */
+  for (i = 0U; i < FSM_12B_TABLE_STATES; i++) {
+    fsm_12B_table_state_to_dw((uint8_T)i, &dw[i]);
+  }
+
+  /* Every sequence starts from the state fsm_12B_initialize leaves */
+  rtM.dwork = &rtDW;
+  memset(&rtDW, 0, sizeof(DW));
+  fsm_12B_initialize(&rtM);
+  (void)fsm_12B_table_state_from_dw(&rtDW, &s0);
+  for (i = first; i < first + count; i++) {
+    boolean_T fired = false;
+    int_T mode = -1;
+    uint64_T run = 0U;
+    uint32_T t;
+    uint8_T s = s0;
+    for (t = 0U; t < cfg->ticks; t++) {
+      fsm_12B_ReqInputs rtIn;
+      boolean_T rtY_pullup;
+      uint32_T assumed = 0U;
+      int_T r;
+      fsm_12B_req_inputs(fsm_12B_mc_draw(&st, i, t), false, &rtIn);
+
+      /* Assumptions hold on the state before the step */
+      for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+        if (fsm_12B_requirements[r].assume(&dw[s], &rtIn)) {
+          assumed |= 1U << r;
+        }
+      }
+
+      fsm_12B_table_step(tbl, &s, rtIn.rtU_standby, rtIn.rtU_apfail,
+                         rtIn.rtU_supported, rtIn.rtU_limits, &rtY_pullup);
+      for (r = 0; assumed != 0U; r++, assumed >>= 1) {
+        if ((assumed & 1U) != 0U) {
+          stats->reached[r]++;
+          if (!fsm_12B_requirements[r].check(&dw[s], rtY_pullup)) {
+            stats->violations[r]++;
+            if (i < stats->first_violation[r]) {
+              stats->first_violation[r] = i;
+            }
+          }
+        }
+      }
+
+      if (rtY_pullup) {
+        stats->pullup_ticks++;
+        if (!fired) {
+          stats->first_pullup[fsm_12B_mc_log2((uint64_T)t + 1U)]++;
+          fired = true;
+        }
+      }
+
+      stats->visits[s]++;
+
+      /* Manager mode dwell */
+      r = s / 6;
+      if (r == mode) {
+        run++;
+      } else {
+        if (mode >= 0) {
+          stats->dwell[mode][fsm_12B_mc_log2(run)]++;
+        }
+
+        mode = r;
+        run = 1U;
+      }
+    }
+
+    if (mode >= 0) {
+      stats->dwell[mode][fsm_12B_mc_log2(run)]++;
+    }
+
+    stats->pullup_sequences += fired ? 1U : 0U;
+    stats->ticks += cfg->ticks;
+    stats->sequences++;
+  }
+}
+
+void fsm_12B_mc_merge(fsm_12B_McStats *dst, const fsm_12B_McStats *src)
+{
+  int_T i;
+  int_T b;
+  dst->sequences += src->sequences;
+  dst->ticks += src->ticks;
+  for (i = 0; i < FSM_12B_TABLE_STATES; i++) {
+    dst->visits[i] += src->visits[i];
+  }
+
+  for (b = 0; b < FSM_12B_MC_LOG2_BINS; b++) {
+    for (i = 0; i < 4; i++) {
+      dst->dwell[i][b] += src->dwell[i][b];
+    }
+
+    dst->first_pullup[b] += src->first_pullup[b];
+  }
+
+  dst->pullup_ticks += src->pullup_ticks;
+  dst->pullup_sequences += src->pullup_sequences;
+  for (i = 0; i < FSM_12B_NUM_REQUIREMENTS; i++) {
+    dst->reached[i] += src->reached[i];
+    dst->violations[i] += src->violations[i];
+    if (src->first_violation[i] < dst->first_violation[i]) {
+      dst->first_violation[i] = src->first_violation[i];
+    }
+  }
+}
+
+static void *fsm_12B_mc_worker(void *arg)
+{
+  fsm_12B_McShard *sh = (fsm_12B_McShard *)arg;
+  fsm_12B_mc_shard(sh->cfg, sh->tbl, sh->first, sh->count, &sh->stats);
+  return NULL;
+}
+
+int_T fsm_12B_mc_run(const fsm_12B_McConfig *cfg, fsm_12B_McStats *stats)
+{
+  uint8_T tbl[FSM_12B_TABLE_SIZE];
+  fsm_12B_McShard *shard;
+  RT_MODEL rtM;
+  DW rtDW;
+  uint8_T s0;
+  pthread_t tid[FSM_12B_MC_MAX_THREADS];
+  boolean_T started[FSM_12B_MC_MAX_THREADS];
+  int_T n = cfg->threads;
+  int_T i;
+
+  /* Table from the linked fsm_12B_step, validated before any sequence */
+  rtM.dwork = &rtDW;
+  memset(&rtDW, 0, sizeof(DW));
+  fsm_12B_initialize(&rtM);
+  if (!fsm_12B_table_build(tbl) || (fsm_12B_table_check(tbl) != 0U) ||
+      !fsm_12B_table_state_from_dw(&rtDW, &s0)) {
+    return -2;
+  }
+
+  if (n <= 0) {
+    n = (int_T)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  if (n > FSM_12B_MC_MAX_THREADS) {
+    n = FSM_12B_MC_MAX_THREADS;
+  }
+
+  if ((uint64_T)n > cfg->sequences) {
+    n = (int_T)cfg->sequences;
+  }
+
+  if (n < 1) {
+    n = 1;
+  }
+
+  shard = (fsm_12B_McShard *)malloc((size_t)n * sizeof(fsm_12B_McShard));
+  if (shard == NULL) {
+    return -1;
+  }
+
+  /* Contiguous shards; shard 0 runs on the calling thread */
+  for (i = 0; i < n; i++) {
+    const uint64_T q = cfg->sequences / (uint64_T)n;
+    const uint64_T rem = cfg->sequences % (uint64_T)n;
+    shard[i].cfg = cfg;
+    shard[i].tbl = tbl;
+    shard[i].first = q * (uint64_T)i + (((uint64_T)i < rem) ? (uint64_T)i :
+      rem);
+    shard[i].count = q + (((uint64_T)i < rem) ? 1U : 0U);
+    fsm_12B_mc_clear(&shard[i].stats);
+    started[i] = (i > 0) && (pthread_create(&tid[i], NULL, fsm_12B_mc_worker,
+      &shard[i]) == 0);
+  }
+
+  for (i = 0; i < n; i++) {
+    if (!started[i]) {
+      (void)fsm_12B_mc_worker(&shard[i]);
+    }
+  }
+
+  fsm_12B_mc_clear(stats);
+  for (i = 0; i < n; i++) {
+    if (started[i]) {
+      (void)pthread_join(tid[i], NULL);
+    }
+
+    fsm_12B_mc_merge(stats, &shard[i].stats);
+  }
+
+  free(shard);
+  return n;
+}
+
+/*
+ * File trailer for fsm_12B_mc.c
+ *
+ * [EOF]
+ */
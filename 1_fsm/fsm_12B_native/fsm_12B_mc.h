@@ -0,0 +1,98 @@
+/*
+ * File: fsm_12B_mc.h
+ *
+ * Monte Carlo campaigns over Simulink model 'fsm_12B'.
+ *
+ * A campaign runs n independent input sequences, each from
+ * fsm_12B_initialize, through the transition table of fsm_12B_step
+ * (fsm_12B_table.h), so a tick is one table load.  The inputs of tick t of
+ * sequence i are drawn from Philox4x32-10 at counter (t, i) under the
+ * campaign seed, so every sequence has its own stream and the statistics
+ * depend only on the configuration, never on the number of threads or on
+ * how sequences are sharded between them.
+ */
+
+#ifndef fsm_12B_mc_h_
+#define fsm_12B_mc_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+#include "fsm_12B_req.h"
+#include "fsm_12B_table.h"
+
+#define FSM_12B_MC_LOG2_BINS           33   /* bins for 1 .. 2^32 ticks */
+#define FSM_12B_MC_MAX_THREADS         256
+#define FSM_12B_MC_NONE                (~(uint64_T)0U)
+
+typedef struct {
+  uint64_T seed;
+  uint64_T sequences;
+  uint32_T ticks;                      /* per sequence */
+  int_T threads;                       /* 0: one per online core */
+  real_T p_standby;                    /* probability of each input being */
+  real_T p_apfail;                     /*   true on a tick                */
+  real_T p_supported;
+  real_T p_limits;
+} fsm_12B_McConfig;
+
+/* Statistics of a campaign or of one shard of it */
+typedef struct {
+  uint64_T sequences;
+  uint64_T ticks;
+
+  /* Ticks spent in each table state, counted after the step */
+  uint64_T visits[FSM_12B_TABLE_STATES];
+
+  /* Dwell of the Manager mode '<S1>/Unit Delay', bin b counts runs of
+   * 2^b .. 2^(b+1)-1 consecutive ticks
+   */
+  uint64_T dwell[4][FSM_12B_MC_LOG2_BINS];
+
+  /* Pullup latch: ticks with rtY_pullup set, sequences in which it was
+   * ever set, and the first such tick in log2 bins
+   */
+  uint64_T pullup_ticks;
+  uint64_T pullup_sequences;
+  uint64_T first_pullup[FSM_12B_MC_LOG2_BINS];
+
+  /* Per requirement of ert_main.c (OverrunFlag false): ticks satisfying
+   * the assumption, ticks failing the assertion, and the lowest violating
+   * sequence index or FSM_12B_MC_NONE
+   */
+  uint64_T reached[FSM_12B_NUM_REQUIREMENTS];
+  uint64_T violations[FSM_12B_NUM_REQUIREMENTS];
+  uint64_T first_violation[FSM_12B_NUM_REQUIREMENTS];
+} fsm_12B_McStats;
+
+/* Inputs of tick t of sequence i, as an input vector index */
+extern uint32_T fsm_12B_mc_inputs(const fsm_12B_McConfig *cfg, uint64_T i,
+  uint32_T t);
+
+extern void fsm_12B_mc_clear(fsm_12B_McStats *stats);
+
+/*
+ * Run sequences [first, first + count) into stats, stepping with tbl, a
+ * table that passed fsm_12B_table_check
+ */
+extern void fsm_12B_mc_shard(const fsm_12B_McConfig *cfg, const uint8_T *tbl,
+  uint64_T first, uint64_T count, fsm_12B_McStats *stats);
+
+/* Add src into dst */
+extern void fsm_12B_mc_merge(fsm_12B_McStats *dst, const fsm_12B_McStats *src);
+
+/*
+ * Run the whole campaign on cfg->threads threads.  The table is rebuilt
+ * from the linked fsm_12B_step and cross-validated first.  Each thread
+ * fills its own shard statistics; they are merged after the threads are
+ * joined.  Returns the number of threads used, -1 if none could be
+ * started, or -2 if the model no longer fits the 24-state table.
+ */
+extern int_T fsm_12B_mc_run(const fsm_12B_McConfig *cfg, fsm_12B_McStats
+  *stats);
+
+#endif                                 /* fsm_12B_mc_h_ */
+
+/*
+ * File trailer for fsm_12B_mc.h
+ *
+ * [EOF]
+ */
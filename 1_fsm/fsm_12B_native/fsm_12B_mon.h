@@ -0,0 +1,61 @@
+/*
+ * File: fsm_12B_mon.h
+ *
+ * Runtime of the requirement monitors that spec generates from a
+ * requirement file (fsm_12B_spec.h).
+ *
+ * A monitor is called once for every tick that steps the model, with the
+ * state before the step, the inputs of the tick, and the state and output
+ * after it; a tick that rt_OneStep skips for OverrunFlag is not seen.  The
+ * scope and the condition of a requirement are evaluated on the state
+ * before the step and the inputs, the response on the state and output
+ * after it and the inputs.  A tick on which scope and condition hold
+ * triggers an obligation on the response:
+ *
+ *   immediately  on this tick
+ *   next         on the next tick
+ *   within N     on at least one of this tick and the N - 1 after it
+ *   for N        on every one of them
+ *
+ * A monitor returns false on the tick that breaks an obligation.  The
+ * same code is compiled into the native monitor table and #included by
+ * the generated ESBMC harnesses, which assert that return value.  All
+ * fields of a monitor start at zero, so a static one needs no reset.
+ */
+
+#ifndef fsm_12B_mon_h_
+#define fsm_12B_mon_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+#include "fsm_12B_req.h"
+
+typedef struct {
+  uint64_T pending;                    /* bit a: triggered a ticks ago */
+  uint32_T ticks;
+  uint32_T triggers;
+  uint32_T violations;
+  uint32_T first;                      /* tick + 1 of first violation, or 0 */
+} fsm_12B_Monitor;
+
+typedef boolean_T (*fsm_12B_MonitorFcn)(fsm_12B_Monitor *m, const DW *pre,
+  const fsm_12B_ReqInputs *rtIn, const DW *rtDW, boolean_T rtY_pullup);
+
+typedef struct {
+  const char_T *id;
+  const char_T *text;
+  const char_T *message;
+  const char_T *expect;                /* holds, violated, vacuous or "" */
+  fsm_12B_MonitorFcn step;
+} fsm_12B_MonitorInfo;
+
+/* Generated monitors.c, in the order of the requirement file */
+extern const fsm_12B_MonitorInfo fsm_12B_monitors[];
+extern const int_T fsm_12B_num_monitors;
+
+#endif                                 /* fsm_12B_mon_h_ */
+
+/*
+ * File trailer for fsm_12B_mon.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,660 @@
+/*
+ * File: fsm_12B_portfolio.c
+ *
+ * Portfolio files, cgroup limits, the race runner and the ranking of
+ * fsm_12B_portfolio.h.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "fsm_12B_portfolio.h"
+#include "fsm_12B_util.h"
+#include "fsm_12B_verify.h"
+#include "rtwtypes.h"
+
+#define MAX_PARALLEL                   256
+#define CGROUP_ROOT                    "/sys/fs/cgroup"
+#define CFS_PERIOD_US                  100000LL
+
+const fsm_12B_PortfolioConfig fsm_12B_portfolio_default[4] = {
+  { "boolector", "--boolector" },
+  { "z3", "--z3" },
+  { "kinduction", "--k-induction" },
+  { "incremental", "--incremental-bmc" } };
+
+/* One running job */
+typedef struct {
+  pid_t pid;                           /* 0: free */
+  int_T race;
+  int_T config;
+  real_T t0;
+  boolean_T killed;                    /* timeout or stop */
+  char_T cpu[FSM_12B_PORTFOLIO_PATH + 64]; /* its cgroups, or "" */
+  char_T memory[FSM_12B_PORTFOLIO_PATH + 64];
+} Slot;
+
+/*================*
+ * Portfolio file *
+ *================*/
+int_T fsm_12B_portfolio_parse(const char_T *text, fsm_12B_PortfolioConfig *c,
+  int_T max, char_T *error, size_t size)
+{
+  const char_T *p = text;
+  int_T n = 0;
+  int_T line = 0;
+  while (*p != '\0') {
+    const size_t len = strcspn(p, "\n");
+    const char_T *end = p + len;
+    const char_T *q = p;
+    size_t word;
+    line++;
+    while ((q < end) && ((*q == ' ') || (*q == '\t') || (*q == '\r'))) {
+      q++;
+    }
+
+    if ((q < end) && (*q != '#')) {
+      word = strcspn(q, " \t\r\n");
+      if ((n == max) || (word >= FSM_12B_PORTFOLIO_NAME)) {
+        (void)snprintf(error, size, "line %d: %s", line, (n == max) ?
+                       "too many configurations" : "name too long");
+        return -1;
+      }
+
+      memcpy(c[n].name, q, word);
+      c[n].name[word] = '\0';
+      q += word;
+      while ((q < end) && ((*q == ' ') || (*q == '\t'))) {
+        q++;
+      }
+
+      word = (size_t)(end - q);
+      while ((word > 0U) && ((q[word - 1U] == ' ') || (q[word - 1U] == '\t') ||
+                             (q[word - 1U] == '\r'))) {
+        word--;
+      }
+
+      if (word >= FSM_12B_PORTFOLIO_TEXT) {
+        (void)snprintf(error, size, "line %d: options too long", line);
+        return -1;
+      }
+
+      memcpy(c[n].options, q, word);
+      c[n].options[word] = '\0';
+      n++;
+    }
+
+    p = (*end == '\n') ? end + 1 : end;
+  }
+
+  return n;
+}
+
+/*=========*
+ * Cgroups *
+ *=========*/
+
+/* Write value to dir/file; 0 or -1.  Also safe in a forked child */
+static int_T put(const char_T *dir, const char_T *file, const char_T *value)
+{
+  char_T path[FSM_12B_PORTFOLIO_PATH + 128];
+  const size_t n = strlen(value);
+  int_T fd;
+  int_T rc = 0;
+  (void)snprintf(path, sizeof(path), "%s/%s", dir, file);
+  fd = open(path, O_WRONLY);
+  if (fd < 0) {
+    return -1;
+  }
+
+  if (write(fd, value, n) != (ssize_t)n) {
+    rc = -1;
+  }
+
+  (void)close(fd);
+  return rc;
+}
+
+/* The number after key in dir/file, or its first number for NULL; or -1 */
+static long long get(const char_T *dir, const char_T *file, const char_T *key)
+{
+  char_T path[FSM_12B_PORTFOLIO_PATH + 128];
+  char_T line[256];
+  long long value = -1LL;
+  FILE *fp;
+  (void)snprintf(path, sizeof(path), "%s/%s", dir, file);
+  fp = fopen(path, "r");
+  if (fp == NULL) {
+    return -1LL;
+  }
+
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    const size_t n = (key != NULL) ? strlen(key) : 0U;
+    if ((key == NULL) || ((strncmp(line, key, n) == 0) && (line[n] == ' '))) {
+      value = strtoll(&line[n], NULL, 10);
+      break;
+    }
+  }
+
+  (void)fclose(fp);
+  return value;
+}
+
+/* The path of this process in the hierarchy with controller, or -1 */
+static int_T own_cgroup(const char_T *controller, char_T *path, size_t size)
+{
+  char_T line[FSM_12B_PORTFOLIO_PATH + 64];
+  FILE *fp = fopen("/proc/self/cgroup", "r");
+  int_T rc = -1;
+  if (fp == NULL) {
+    return -1;
+  }
+
+  /* "id:controller,controller:/path"; v2 is "0::/path" */
+  while ((rc != 0) && (fgets(line, sizeof(line), fp) != NULL)) {
+    char_T *list = strchr(line, ':');
+    char_T *where = (list != NULL) ? strchr(list + 1, ':') : NULL;
+    char_T *tok;
+    char_T *save;
+    if (where == NULL) {
+      continue;
+    }
+
+    *where++ = '\0';
+    where[strcspn(where, "\n")] = '\0';
+    list++;
+    if (controller == NULL) {
+      if (*list == '\0') {
+        (void)snprintf(path, size, "%s", where);
+        rc = 0;
+      }
+
+      continue;
+    }
+
+    for (tok = strtok_r(list, ",", &save); tok != NULL; tok = strtok_r(NULL,
+          ",", &save)) {
+      if (strcmp(tok, controller) == 0) {
+        (void)snprintf(path, size, "%s", where);
+        rc = 0;
+        break;
+      }
+    }
+  }
+
+  (void)fclose(fp);
+  return rc;
+}
+
+/* The root of a hierarchy is "/", which would end the paths in "//" */
+static const char_T *below(const char_T *path)
+{
+  return (strcmp(path, "/") == 0) ? "" : path;
+}
+
+/* Can a child cgroup be made, with file, under dir? */
+static int_T probe(const char_T *dir, const char_T *file)
+{
+  char_T child[FSM_12B_PORTFOLIO_PATH + 64];
+  char_T path[FSM_12B_PORTFOLIO_PATH + 128];
+  int_T rc;
+  (void)snprintf(child, sizeof(child), "%s/fsm_12B-%ld-probe", dir, (long)
+                 getpid());
+  if (mkdir(child, 0755) != 0) {
+    return -1;
+  }
+
+  (void)snprintf(path, sizeof(path), "%s/%s", child, file);
+  rc = (access(path, W_OK) == 0) ? 0 : -1;
+  (void)rmdir(child);
+  return rc;
+}
+
+int_T fsm_12B_cgroups_init(fsm_12B_Cgroups *cg, const char_T *parent)
+{
+  char_T own[FSM_12B_PORTFOLIO_PATH - 64];
+  char_T controllers[256] = "";
+  FILE *fp = fopen(CGROUP_ROOT "/cgroup.controllers", "r");
+  memset(cg, 0, sizeof(fsm_12B_Cgroups));
+  if (fp != NULL) {
+    if (fgets(controllers, sizeof(controllers), fp) == NULL) {
+      controllers[0] = '\0';
+    }
+
+    (void)fclose(fp);
+  }
+
+  if ((strstr(controllers, "cpu") != NULL) && (strstr(controllers, "memory")
+       != NULL)) {
+    /* v2: one hierarchy; the parent must hand cpu and memory down */
+    if ((parent == NULL) && (own_cgroup(NULL, own, sizeof(own)) != 0)) {
+      (void)snprintf(cg->error, sizeof(cg->error), "cannot read "
+                     "/proc/self/cgroup");
+      return -1;
+    }
+
+    (void)snprintf(cg->cpu, sizeof(cg->cpu), CGROUP_ROOT "%s", below((parent
+      != NULL) ? parent : own));
+    (void)snprintf(cg->memory, sizeof(cg->memory), "%s", cg->cpu);
+    (void)put(cg->cpu, "cgroup.subtree_control", "+cpu +memory");
+    if ((probe(cg->cpu, "cpu.max") != 0) || (probe(cg->cpu, "memory.max") !=
+         0)) {
+      (void)snprintf(cg->error, sizeof(cg->error), "cannot make cgroups with "
+                     "cpu and memory under %.400s; give a delegated cgroup "
+                     "with no processes of its own", cg->cpu);
+      return -1;
+    }
+
+    cg->version = 2;
+    return 0;
+  }
+
+  /* v1: separate cpu and memory hierarchies */
+  if ((parent == NULL) && (own_cgroup("cpu", own, sizeof(own)) != 0)) {
+    (void)snprintf(cg->error, sizeof(cg->error), "no cpu cgroup hierarchy");
+    return -1;
+  }
+
+  (void)snprintf(cg->cpu, sizeof(cg->cpu), CGROUP_ROOT "/cpu%s", below((parent
+    != NULL) ? parent : own));
+  if ((parent == NULL) && (own_cgroup("memory", own, sizeof(own)) != 0)) {
+    (void)snprintf(cg->error, sizeof(cg->error), "no memory cgroup hierarchy");
+    return -1;
+  }
+
+  (void)snprintf(cg->memory, sizeof(cg->memory), CGROUP_ROOT "/memory%s",
+                 below((parent != NULL) ? parent : own));
+  if ((probe(cg->cpu, "cpu.cfs_quota_us") != 0) || (probe(cg->memory,
+        "memory.limit_in_bytes") != 0)) {
+    (void)snprintf(cg->error, sizeof(cg->error), "cannot make cgroups under "
+                   "%.200s and %.200s", cg->cpu, cg->memory);
+    return -1;
+  }
+
+  cg->version = 1;
+  return 0;
+}
+
+/* Make the cgroups of the job in slot with the limits; 0 or -1 */
+static int_T cgroup_make(const fsm_12B_Cgroups *cg, const
+  fsm_12B_PortfolioLimits *lim, Slot *slot, int_T seq)
+{
+  char_T value[64];
+  (void)snprintf(slot->cpu, sizeof(slot->cpu), "%s/fsm_12B-%ld-%d", cg->cpu,
+                 (long)getpid(), seq);
+  (void)snprintf(slot->memory, sizeof(slot->memory), "%s/fsm_12B-%ld-%d",
+                 cg->memory, (long)getpid(), seq);
+  if ((mkdir(slot->cpu, 0755) != 0) || ((cg->version == 1) && (mkdir
+        (slot->memory, 0755) != 0))) {
+    (void)rmdir(slot->cpu);
+    slot->cpu[0] = '\0';
+    slot->memory[0] = '\0';
+    return -1;
+  }
+
+  if (lim->cpus > 0.0) {
+    const long long quota = (long long)(lim->cpus * (real_T)CFS_PERIOD_US);
+    if (cg->version == 2) {
+      (void)snprintf(value, sizeof(value), "%lld %lld", quota, CFS_PERIOD_US);
+      (void)put(slot->cpu, "cpu.max", value);
+    } else {
+      (void)snprintf(value, sizeof(value), "%lld", CFS_PERIOD_US);
+      (void)put(slot->cpu, "cpu.cfs_period_us", value);
+      (void)snprintf(value, sizeof(value), "%lld", quota);
+      (void)put(slot->cpu, "cpu.cfs_quota_us", value);
+    }
+  }
+
+  /* Swap would turn a memory limit into a slowdown */
+  if (lim->mem_mib != 0U) {
+    (void)snprintf(value, sizeof(value), "%llu", (unsigned long long)
+                   (lim->mem_mib << 20));
+    if (cg->version == 2) {
+      (void)put(slot->memory, "memory.max", value);
+      (void)put(slot->memory, "memory.swap.max", "0");
+    } else {
+      (void)put(slot->memory, "memory.limit_in_bytes", value);
+      (void)put(slot->memory, "memory.memsw.limit_in_bytes", value);
+    }
+  }
+
+  return 0;
+}
+
+/* Kill every process in dir */
+static void cgroup_kill(const char_T *dir)
+{
+  char_T path[FSM_12B_PORTFOLIO_PATH + 128];
+  long pid;
+  FILE *fp;
+  if (dir[0] == '\0') {
+    return;
+  }
+
+  (void)put(dir, "cgroup.kill", "1");
+  (void)snprintf(path, sizeof(path), "%s/cgroup.procs", dir);
+  fp = fopen(path, "r");
+  if (fp == NULL) {
+    return;
+  }
+
+  while (fscanf(fp, "%ld", &pid) == 1) {
+    (void)kill((pid_t)pid, SIGKILL);
+  }
+
+  (void)fclose(fp);
+}
+
+/* Remove the cgroups of slot once the killed processes are gone */
+static void cgroup_remove(Slot *slot)
+{
+  int_T k;
+  for (k = 0; k < 2; k++) {
+    char_T *dir = (k == 0) ? slot->cpu : slot->memory;
+    int_T tries;
+    if ((dir[0] == '\0') || ((k == 1) && (strcmp(dir, slot->cpu) == 0))) {
+      continue;
+    }
+
+    for (tries = 0; (rmdir(dir) != 0) && (errno == EBUSY) && (tries < 100);
+         tries++) {
+      struct timespec nap = { 0, 10000000L };
+      cgroup_kill(dir);
+      (void)nanosleep(&nap, NULL);
+    }
+  }
+
+  slot->cpu[0] = '\0';
+  slot->memory[0] = '\0';
+}
+
+/*========*
+ * Runner *
+ *========*/
+/* fsm_12B_VerifyHook that moves the job into the cgroups of its slot */
+static int_T join(void *arg)
+{
+  const Slot *slot = (const Slot *)arg;
+  char_T self[32];
+  if (slot->cpu[0] == '\0') {
+    return 0;
+  }
+
+  (void)snprintf(self, sizeof(self), "%ld\n", (long)getpid());
+  if ((put(slot->cpu, "cgroup.procs", self) != 0) || ((strcmp(slot->memory,
+         slot->cpu) != 0) && (put(slot->memory, "cgroup.procs", self) != 0))) {
+    fprintf(stderr, "portfolio: cannot join %s\n", slot->cpu);
+    return -1;
+  }
+
+  return 0;
+}
+
+/* Which inconclusive verdict tells the most; lower is better */
+static int_T weight(fsm_12B_VerifyVerdict v)
+{
+  switch (v) {
+   case FSM_12B_VERIFY_UNKNOWN:
+    return 0;
+
+   case FSM_12B_VERIFY_TIMEOUT:
+    return 1;
+
+   case FSM_12B_VERIFY_MEMOUT:
+    return 2;
+
+   case FSM_12B_VERIFY_ERROR:
+    return 3;
+
+   default:
+    return 4;
+  }
+}
+
+/* Record the end of the job in slot s on its race */
+static void finish(fsm_12B_PortfolioRace *races, Slot *slot, int_T s, int_T
+                   parallel, int_T status, const struct rusage *ru, boolean_T
+                   memory_cap)
+{
+  fsm_12B_PortfolioRace *r = &races[slot[s].race];
+  fsm_12B_VerifyJob *job = &r->job[slot[s].config];
+  const real_T t = fsm_12B_now_sec();
+  long long peak = -1LL;
+  long long oom = -1LL;
+  int_T k;
+  job->seconds = t - slot[s].t0;
+  job->peak_kib = (uint64_T)ru->ru_maxrss;
+  job->status = status;
+  if (slot[s].memory[0] != '\0') {
+    peak = get(slot[s].memory, (strcmp(slot[s].memory, slot[s].cpu) == 0) ?
+               "memory.peak" : "memory.max_usage_in_bytes", NULL);
+    oom = get(slot[s].memory, (strcmp(slot[s].memory, slot[s].cpu) == 0) ?
+              "memory.events" : "memory.oom_control", "oom_kill");
+  }
+
+  if ((peak >> 10) > (long long)job->peak_kib) {
+    job->peak_kib = (uint64_T)(peak >> 10);
+  }
+
+  if (r->lost[slot[s].config]) {
+    job->verdict = FSM_12B_VERIFY_NONE;
+  } else {
+    job->verdict = fsm_12B_verify_verdict(job, slot[s].killed);
+    if ((job->verdict == FSM_12B_VERIFY_ERROR) && WIFSIGNALED(status) &&
+        !slot[s].killed && ((oom > 0LL) || ((oom < 0LL) && memory_cap))) {
+      job->verdict = FSM_12B_VERIFY_MEMOUT;
+    }
+  }
+
+  /* Whatever the job left behind */
+  (void)kill(-slot[s].pid, SIGKILL);
+  cgroup_kill(slot[s].cpu);
+  cgroup_kill(slot[s].memory);
+  cgroup_remove(&slot[s]);
+  slot[s].pid = 0;
+  r->running--;
+  if (r->done) {
+    return;
+  }
+
+  if ((job->verdict == FSM_12B_VERIFY_PASS) || (job->verdict ==
+       FSM_12B_VERIFY_FAIL)) {
+    /* The first conclusive verdict wins; the others are killed now */
+    r->done = true;
+    r->winner = slot[s].config;
+    r->verdict = job->verdict;
+    r->seconds = t - r->t0;
+    for (k = 0; k < parallel; k++) {
+      if ((slot[k].pid != 0) && (&races[slot[k].race] == r)) {
+        r->lost[slot[k].config] = true;
+        (void)kill(-slot[k].pid, SIGKILL);
+        cgroup_kill(slot[k].cpu);
+        cgroup_kill(slot[k].memory);
+      }
+    }
+
+    return;
+  }
+
+  if (weight(job->verdict) < weight(r->verdict)) {
+    r->verdict = job->verdict;
+  }
+
+  if ((r->running == 0) && (r->started == r->nconfigs)) {
+    r->done = true;
+    r->seconds = t - r->t0;
+  }
+}
+
+void fsm_12B_portfolio_run(fsm_12B_PortfolioRace *races, int_T n, const
+  fsm_12B_PortfolioLimits *lim, const fsm_12B_Cgroups *cg, volatile int_T
+  *stop)
+{
+  static Slot slot[MAX_PARALLEL];
+  const boolean_T grouped = (cg != NULL) && (cg->version != 0);
+  int_T parallel = lim->parallel;
+  int_T width = lim->width;
+  int_T running = 0;
+  int_T first = 0;
+  int_T seq = 0;
+  int_T i;
+  int_T s;
+  if (parallel < 1) {
+    parallel = 1;
+  } else if (parallel > MAX_PARALLEL) {
+    parallel = MAX_PARALLEL;
+  }
+
+  for (s = 0; s < parallel; s++) {
+    slot[s].pid = 0;
+    slot[s].cpu[0] = '\0';
+    slot[s].memory[0] = '\0';
+  }
+
+  for (i = 0; i < n; i++) {
+    fsm_12B_PortfolioRace *r = &races[i];
+    r->winner = -1;
+    r->verdict = FSM_12B_VERIFY_NONE;
+    r->seconds = 0.0;
+    r->started = 0;
+    r->running = 0;
+    r->done = (r->nconfigs <= 0);
+    for (s = 0; s < r->nconfigs; s++) {
+      r->lost[s] = false;
+      r->job[s].verdict = FSM_12B_VERIFY_NONE;
+      r->job[s].seconds = 0.0;
+      r->job[s].peak_kib = 0U;
+      r->job[s].status = 0;
+    }
+  }
+
+  while ((first < n) || (running > 0)) {
+    struct timespec nap = { 0, 10000000L };
+
+    /* Free slots go to the earliest races with configurations left */
+    for (i = first; (i < n) && (running < parallel) && !*stop; i++) {
+      fsm_12B_PortfolioRace *r = &races[i];
+      while (!r->done && (r->started < r->nconfigs) && ((width < 1) ||
+              (r->running < width)) && (running < parallel)) {
+        const int_T config = r->order[r->started++];
+        fsm_12B_VerifyJob *job = &r->job[config];
+        for (s = 0; slot[s].pid != 0; s++) {
+        }
+
+        slot[s].race = i;
+        slot[s].config = config;
+        slot[s].killed = false;
+        slot[s].t0 = fsm_12B_now_sec();
+        if (r->started == 1) {
+          r->t0 = slot[s].t0;
+        }
+
+        if (grouped && (cgroup_make(cg, lim, &slot[s], seq++) != 0)) {
+          job->verdict = FSM_12B_VERIFY_ERROR;
+        } else {
+          /* The address-space cap only stands in for a memory cgroup */
+          slot[s].pid = fsm_12B_verify_start(job, grouped ? 0U : lim->mem_mib,
+            join, &slot[s]);
+          if (slot[s].pid < 0) {
+            cgroup_remove(&slot[s]);
+            slot[s].pid = 0;
+            job->verdict = FSM_12B_VERIFY_ERROR;
+          }
+        }
+
+        if (slot[s].pid != 0) {
+          r->running++;
+          running++;
+        } else {
+          if (weight(job->verdict) < weight(r->verdict)) {
+            r->verdict = job->verdict;
+          }
+
+          if ((r->running == 0) && (r->started == r->nconfigs)) {
+            r->done = true;
+          }
+        }
+      }
+    }
+
+    if (*stop) {
+      for (i = first; i < n; i++) {
+        races[i].done = races[i].done || (races[i].running == 0);
+      }
+    }
+
+    /* Reap the finished jobs, kill the late ones */
+    for (s = 0; s < parallel; s++) {
+      const boolean_T killed = slot[s].killed;
+      struct rusage ru;
+      int status;
+      int_T w;
+      if (slot[s].pid == 0) {
+        continue;
+      }
+
+      w = fsm_12B_verify_poll(slot[s].pid, slot[s].t0, lim->timeout, *stop !=
+        0, &slot[s].killed, &status, &ru);
+      if (w != 0) {
+        finish(races, slot, s, parallel, status, &ru, (w > 0) && (lim->mem_mib
+                != 0U));
+        running--;
+      } else if (slot[s].killed && !killed) {
+        /* The process group is gone; so must be the rest of the cgroup */
+        cgroup_kill(slot[s].cpu);
+        cgroup_kill(slot[s].memory);
+      }
+    }
+
+    while ((first < n) && races[first].done) {
+      first++;
+    }
+
+    if (running > 0) {
+      (void)nanosleep(&nap, NULL);
+    }
+  }
+}
+
+/*=========*
+ * Ranking *
+ *=========*/
+void fsm_12B_portfolio_rank(const int_T *runs, const int_T *conclusive, const
+  real_T *seconds, int_T n, int_T *order)
+{
+  real_T cost[FSM_12B_PORTFOLIO_MAX_CONFIGS];
+  int_T i;
+  int_T j;
+  for (i = 0; i < n; i++) {
+    cost[i] = (runs[i] == 0) ? -1.0 : (conclusive[i] == 0) ? 1.0e300 :
+      seconds[i] / (real_T)conclusive[i];
+    order[i] = i;
+  }
+
+  /* Stable, so that ties keep the given order */
+  for (i = 1; i < n; i++) {
+    const int_T c = order[i];
+    for (j = i; (j > 0) && (cost[order[j - 1]] > cost[c]); j--) {
+      order[j] = order[j - 1];
+    }
+
+    order[j] = c;
+  }
+}
+
+/*
+ * File trailer for fsm_12B_portfolio.c
+ *
+ * [EOF]
+ */
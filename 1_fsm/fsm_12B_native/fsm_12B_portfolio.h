@@ -0,0 +1,124 @@
+/*
+ * File: fsm_12B_portfolio.h
+ *
+ * Portfolio verification: several configurations of the verifier race on
+ * each requirement, and the first conclusive verdict wins.
+ *
+ * The solve time of one harness can differ by two orders of magnitude
+ * between SMT back ends and between --k-induction, --incremental-bmc and
+ * plain bounded checking, and which one is fastest differs between
+ * requirements.  A race (fsm_12B_PortfolioRace) holds one job per
+ * configuration (fsm_12B_verify.h).  fsm_12B_portfolio_run starts the
+ * jobs of every race, at most width of a race and parallel in all at a
+ * time.  When a job of a race ends in PASS or FAIL, the other jobs of that
+ * race are killed at once and its remaining configurations are not
+ * started.  A race whose jobs are all inconclusive ends with the most
+ * informative of their verdicts.
+ *
+ * Each job runs in a cgroup of its own under a parent cgroup, with a CPU
+ * quota and a memory limit, so that the jobs of a race cannot starve each
+ * other or the rest of a shared machine; the kill takes every process in
+ * the cgroup.  Both cgroup v1 (cpu and memory hierarchies) and v2 are
+ * supported.  Without cgroups, the memory limit is an address-space limit
+ * as in fsm_12B_verify_run and there is no CPU quota.
+ *
+ * fsm_12B_portfolio_rank orders the configurations of a requirement by the
+ * time they took on it before, as recorded in fsm_12B_store.h.
+ */
+
+#ifndef fsm_12B_portfolio_h_
+#define fsm_12B_portfolio_h_
+#include <stddef.h>
+#include "rtwtypes.h"
+#include "fsm_12B_verify.h"
+
+#define FSM_12B_PORTFOLIO_MAX_CONFIGS  16
+#define FSM_12B_PORTFOLIO_NAME         32
+#define FSM_12B_PORTFOLIO_TEXT         512
+#define FSM_12B_PORTFOLIO_PATH         4096
+
+/* One configuration of the verifier */
+typedef struct {
+  char_T name[FSM_12B_PORTFOLIO_NAME];
+  char_T options[FSM_12B_PORTFOLIO_TEXT]; /* space separated */
+} fsm_12B_PortfolioConfig;
+
+/* The configurations used without a portfolio file */
+extern const fsm_12B_PortfolioConfig fsm_12B_portfolio_default[4];
+
+typedef struct {
+  /* Set by the caller */
+  fsm_12B_VerifyJob job[FSM_12B_PORTFOLIO_MAX_CONFIGS]; /* argv and log */
+  int_T nconfigs;
+  int_T order[FSM_12B_PORTFOLIO_MAX_CONFIGS]; /* configurations to start */
+
+  /* Results */
+  int_T winner;                        /* configuration, or -1 */
+  fsm_12B_VerifyVerdict verdict;
+  real_T seconds;                      /* from the first start to the end */
+  boolean_T lost[FSM_12B_PORTFOLIO_MAX_CONFIGS]; /* killed by the winner */
+  int_T started;                       /* jobs started */
+
+  /* Private */
+  int_T running;
+  real_T t0;
+  boolean_T done;
+} fsm_12B_PortfolioRace;
+
+typedef struct {
+  int_T parallel;                      /* jobs at a time in all */
+  int_T width;                         /* jobs at a time per race */
+  real_T timeout;                      /* seconds per job; 0 none */
+  real_T cpus;                         /* CPU quota per job; 0 none */
+  uint64_T mem_mib;                    /* memory per job; 0 none */
+} fsm_12B_PortfolioLimits;
+
+/* Where the job cgroups go */
+typedef struct {
+  int_T version;                       /* 1 or 2; 0 no cgroups */
+  char_T cpu[FSM_12B_PORTFOLIO_PATH];  /* parent directories; one for v2 */
+  char_T memory[FSM_12B_PORTFOLIO_PATH];
+  char_T error[FSM_12B_PORTFOLIO_TEXT];
+} fsm_12B_Cgroups;
+
+/*
+ * Configurations of a portfolio file, one "name options ..." per line
+ * with # comments.  Returns their number, or -1 with the line in error.
+ */
+extern int_T fsm_12B_portfolio_parse(const char_T *text,
+  fsm_12B_PortfolioConfig *c, int_T max, char_T *error, size_t size);
+
+/*
+ * Find the cgroup hierarchies and check that job cgroups can be made
+ * under parent, a path within them such as "/farm" (NULL: the cgroup of
+ * this process).  Under v2, the cpu and memory controllers are enabled
+ * for the children of parent.  0, or -1 with cg->error and version 0.
+ */
+extern int_T fsm_12B_cgroups_init(fsm_12B_Cgroups *cg, const char_T *parent);
+
+/*
+ * Run the races.  cg may be NULL or of version 0 for no cgroups.  Setting
+ * *stop kills the running jobs and starts no more.
+ */
+extern void fsm_12B_portfolio_run(fsm_12B_PortfolioRace *races, int_T n,
+  const fsm_12B_PortfolioLimits *lim, const fsm_12B_Cgroups *cg, volatile
+  int_T *stop);
+
+/*
+ * Order n configurations for one requirement from their past runs on it:
+ * runs, conclusive ones and total seconds, as from fsm_12B_store_times.
+ * Never run configurations come first, in their given order, so that each
+ * one is tried.  Then those with a conclusive run, by expected time to a
+ * verdict, the total time over the number of verdicts (runs cut short
+ * count with the time they had).  Then those that never reached one.
+ */
+extern void fsm_12B_portfolio_rank(const int_T *runs, const int_T
+  *conclusive, const real_T *seconds, int_T n, int_T *order);
+
+#endif                                 /* fsm_12B_portfolio_h_ */
+
+/*
+ * File trailer for fsm_12B_portfolio.h
+ *
+ * [EOF]
+ */
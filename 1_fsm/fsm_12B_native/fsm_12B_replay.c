@@ -0,0 +1,52 @@
+/*
+ * File: fsm_12B_replay.c
+ *
+ * Trace replay for Simulink model 'fsm_12B'.
+ */
+
+#include "fsm_12B_replay.h"
+#include "rtwtypes.h"
+
+static uint8_T fsm_12B_replay_mode(real_T x)
+{
+  uint8_T mode;
+  if (x == 0.0) {
+    mode = 0U;
+  } else if (x == 1.0) {
+    mode = 1U;
+  } else if (x == 2.0) {
+    mode = 2U;
+  } else if (x == 3.0) {
+    mode = 3U;
+  } else {
+    mode = FSM_12B_REPLAY_BAD_MODE;
+  }
+
+  return mode;
+}
+
+void fsm_12B_replay(RT_MODEL *const rtM, const fsm_12B_InRecord *in,
+                    fsm_12B_OutRecord *out, uint64_T nticks)
+{
+  const DW *rtDW = rtM->dwork;
+  uint64_T t;
+  for (t = 0U; t < nticks; t++) {
+    boolean_T rtY_pullup = false;
+
+    /* Step the model */
+    fsm_12B_step(rtM, in[t].rtU_standby, in[t].rtU_apfail, in[t].rtU_supported,
+                 in[t].rtU_limits, &rtY_pullup);
+
+    /* Get model outputs here */
+    out[t].rtY_pullup = rtY_pullup;
+    out[t].Merge = fsm_12B_replay_mode(rtDW->Merge);
+    out[t].Merge_g = fsm_12B_replay_mode(rtDW->Merge_g);
+    out[t].UnitDelay2_DSTATE = rtDW->UnitDelay2_DSTATE;
+  }
+}
+
+/*
+ * File trailer for fsm_12B_replay.c
+ *
+ * [EOF]
+ */
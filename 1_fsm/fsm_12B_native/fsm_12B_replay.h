@@ -0,0 +1,49 @@
+/*
+ * File: fsm_12B_replay.h
+ *
+ * Trace replay for Simulink model 'fsm_12B'.
+ *
+ * An input trace is a flat array of fsm_12B_InRecord, one per 0.2 s
+ * base-rate tick; the replay writes one fsm_12B_OutRecord per tick.  Both
+ * records are four bytes with no padding so that trace files can be
+ * memory-mapped and used in place.
+ */
+
+#ifndef fsm_12B_replay_h_
+#define fsm_12B_replay_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+
+/* Inputs of one tick */
+typedef struct {
+  boolean_T rtU_standby;               /* '<Root>/standby' */
+  boolean_T rtU_apfail;                /* '<Root>/apfail' */
+  boolean_T rtU_supported;             /* '<Root>/supported' */
+  boolean_T rtU_limits;                /* '<Root>/limits' */
+} fsm_12B_InRecord;
+
+/* Output and modes after one tick */
+typedef struct {
+  boolean_T rtY_pullup;                /* '<Root>/pullup' */
+  uint8_T Merge;                       /* '<S4>/Merge' */
+  uint8_T Merge_g;                     /* '<S14>/Merge' */
+  boolean_T UnitDelay2_DSTATE;         /* '<S1>/Unit Delay2' */
+} fsm_12B_OutRecord;
+
+/* Mode value written for a Merge outside 0.0..3.0 */
+#define FSM_12B_REPLAY_BAD_MODE        ((uint8_T)0xFFU)
+
+/*
+ * Step rtM once per input record, from whatever state rtM->dwork holds,
+ * and write one output record per tick.  Performs no allocation or I/O.
+ */
+extern void fsm_12B_replay(RT_MODEL *const rtM, const fsm_12B_InRecord *in,
+  fsm_12B_OutRecord *out, uint64_T nticks);
+
+#endif                                 /* fsm_12B_replay_h_ */
+
+/*
+ * File trailer for fsm_12B_replay.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,281 @@
+/*
+ * File: fsm_12B_req.c
+ *
+ * Native form of the requirements checked by
+ * 1_fsm/fsm_12B_ert_rtw/ert_main.c.  Keep the predicates below in step
+ * with the __ESBMC_assume/__ESBMC_assert lines of that harness.
+ */
+
+#include "fsm_12B_req.h"
+#include "rtwtypes.h"
+
+/* Requirement 1: Exceeding sensor limits shall latch an autopilot pullup */
+static boolean_T req1_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  (void)rtDW;
+  return rtIn->rtU_limits && !rtIn->rtU_standby && rtIn->rtU_supported &&
+    !rtIn->rtU_apfail;
+}
+
+static boolean_T req1_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtDW;
+  return rtY_pullup;
+}
+
+/* Requirement 2: Change states from TRANSITION to STANDBY when in control */
+static boolean_T req2_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge == 0.0) && rtIn->rtU_standby;
+}
+
+static boolean_T req2_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge == 3.0;
+}
+
+/* Requirement 3: Change states from TRANSITION to NOMINAL when supported and
+ * OverrunFlag is false (data is good)
+ */
+static boolean_T req3_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge == 0.0) && rtIn->rtU_supported && !rtIn->OverrunFlag;
+}
+
+static boolean_T req3_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge == 1.0;
+}
+
+/* Requirement 4: Change states from NOMINAL to MANEUVER when OverrunFlag is
+ * true (data is not good)
+ */
+static boolean_T req4_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge == 1.0) && rtIn->OverrunFlag;
+}
+
+static boolean_T req4_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge == 2.0;
+}
+
+/* Requirement 5: Change states from NOMINAL to STANDBY when in control */
+static boolean_T req5_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge == 1.0) && rtIn->rtU_standby;
+}
+
+static boolean_T req5_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge == 3.0;
+}
+
+/* Requirement 6: Change states from MANEUVER to STANDBY when in control and
+ * OverrunFlag is false (data is good)
+ */
+static boolean_T req6_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge == 2.0) && rtIn->rtU_standby && !rtIn->OverrunFlag;
+}
+
+static boolean_T req6_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge == 3.0;
+}
+
+/* Requirement 7: Change states from PULLUP to TRANSITION when supported and
+ * OverrunFlag is false (data is good)
+ */
+static boolean_T req7_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge == 3.0) && rtIn->rtU_supported && !rtIn->OverrunFlag;
+}
+
+static boolean_T req7_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge == 0.0;
+}
+
+/* Requirement 8: Change states from STANDBY to TRANSITION when not in
+ * control
+ */
+static boolean_T req8_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge == 3.0) && !rtIn->rtU_standby;
+}
+
+static boolean_T req8_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge == 0.0;
+}
+
+/* Requirement 9: Change states from STANDBY to MANEUVER when apfail occurs */
+static boolean_T req9_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge == 3.0) && rtIn->rtU_apfail;
+}
+
+static boolean_T req9_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge == 2.0;
+}
+
+/* Requirement 10: Change sensor states from NOMINAL to FAULT when limits are
+ * exceeded
+ */
+static boolean_T req10_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge_g == 1.0) && rtIn->rtU_limits;
+}
+
+static boolean_T req10_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge_g == 2.0;
+}
+
+/* Requirement 11: Change sensor states from NOMINAL to TRANSITION when not
+ * requested
+ */
+static boolean_T req11_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge_g == 1.0) && !rtIn->rtU_supported;
+}
+
+static boolean_T req11_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge_g == 0.0;
+}
+
+/* Requirement 12: Change sensor states from FAULT to TRANSITION when not
+ * requested and limits not exceeded
+ */
+static boolean_T req12_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge_g == 2.0) && !rtIn->rtU_supported && !rtIn->rtU_limits;
+}
+
+static boolean_T req12_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge_g == 0.0;
+}
+
+/* Requirement 13: Change sensor states from TRANSITION to NOMINAL when
+ * requested and mode is correct
+ */
+static boolean_T req13_assume(const DW *rtDW, const fsm_12B_ReqInputs *rtIn)
+{
+  return (rtDW->Merge_g == 0.0) && rtIn->rtU_supported;
+}
+
+static boolean_T req13_check(const DW *rtDW, boolean_T rtY_pullup)
+{
+  (void)rtY_pullup;
+  return rtDW->Merge_g == 1.0;
+}
+
+const fsm_12B_Requirement fsm_12B_requirements[FSM_12B_NUM_REQUIREMENTS] = {
+  { 1, "Exceeding sensor limits shall latch an autopilot pullup",
+    "Requirement 1 violated: Pullup should be latched", req1_assume,
+    req1_check },
+
+  { 2, "Change states from TRANSITION to STANDBY when in control",
+    "Requirement 2 violated: Should change to STANDBY", req2_assume, req2_check
+  },
+
+  { 3, "Change states from TRANSITION to NOMINAL when supported and "
+    "OverrunFlag is false (data is good)",
+    "Requirement 3 violated: Should change to NOMINAL", req3_assume, req3_check
+  },
+
+  { 4, "Change states from NOMINAL to MANEUVER when OverrunFlag is true "
+    "(data is not good)", "Requirement 4 violated: Should change to MANEUVER",
+    req4_assume, req4_check },
+
+  { 5, "Change states from NOMINAL to STANDBY when in control",
+    "Requirement 5 violated: Should change to STANDBY", req5_assume, req5_check
+  },
+
+  { 6, "Change states from MANEUVER to STANDBY when in control and "
+    "OverrunFlag is false (data is good)",
+    "Requirement 6 violated: Should change to STANDBY", req6_assume, req6_check
+  },
+
+  { 7, "Change states from PULLUP to TRANSITION when supported and "
+    "OverrunFlag is false (data is good)",
+    "Requirement 7 violated: Should change to TRANSITION", req7_assume,
+    req7_check },
+
+  { 8, "Change states from STANDBY to TRANSITION when not in control",
+    "Requirement 8 violated: Should change to TRANSITION", req8_assume,
+    req8_check },
+
+  { 9, "Change states from STANDBY to MANEUVER when apfail occurs",
+    "Requirement 9 violated: Should change to MANEUVER", req9_assume,
+    req9_check },
+
+  { 10, "Change sensor states from NOMINAL to FAULT when limits are exceeded",
+    "Requirement 10 violated: Should change to FAULT", req10_assume,
+    req10_check },
+
+  { 11, "Change sensor states from NOMINAL to TRANSITION when not requested",
+    "Requirement 11 violated: Should change to TRANSITION", req11_assume,
+    req11_check },
+
+  { 12, "Change sensor states from FAULT to TRANSITION when not requested and "
+    "limits not exceeded",
+    "Requirement 12 violated: Should change to TRANSITION", req12_assume,
+    req12_check },
+
+  { 13, "Change sensor states from TRANSITION to NOMINAL when requested and "
+    "mode is correct", "Requirement 13 violated: Should change to NOMINAL",
+    req13_assume, req13_check }
+};
+
+void fsm_12B_req_inputs(uint32_T k, boolean_T OverrunFlag, fsm_12B_ReqInputs
+  *rtIn)
+{
+  rtIn->rtU_standby = FSM_12B_IN_STANDBY(k);
+  rtIn->rtU_apfail = FSM_12B_IN_APFAIL(k);
+  rtIn->rtU_supported = FSM_12B_IN_SUPPORTED(k);
+  rtIn->rtU_limits = FSM_12B_IN_LIMITS(k);
+  rtIn->OverrunFlag = OverrunFlag;
+}
+
+fsm_12B_ReqOutcome fsm_12B_req_eval(const fsm_12B_Requirement *req, const DW
+  *rtDW, const fsm_12B_ReqInputs *rtIn, DW *rtDWnext, boolean_T *rtY_pullup)
+{
+  RT_MODEL rtM;
+
+  /* Check for overrun */
+  if (rtIn->OverrunFlag) {
+    return FSM_12B_REQ_SKIPPED;
+  }
+
+  if (!req->assume(rtDW, rtIn)) {
+    return FSM_12B_REQ_ASSUME_FALSE;
+  }
+
+  *rtDWnext = *rtDW;
+  rtM.dwork = rtDWnext;
+  fsm_12B_step(&rtM, rtIn->rtU_standby, rtIn->rtU_apfail, rtIn->rtU_supported,
+               rtIn->rtU_limits, rtY_pullup);
+  return req->check(rtDWnext, *rtY_pullup) ? FSM_12B_REQ_PASS : FSM_12B_REQ_FAIL;
+}
+
+/*
+ * File trailer for fsm_12B_req.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,74 @@
+/*
+ * File: fsm_12B_req.h
+ *
+ * Native form of the requirements checked by
+ * 1_fsm/fsm_12B_ert_rtw/ert_main.c.
+ *
+ * Each requirement is the __ESBMC_assume/__ESBMC_assert pair of one
+ * "sit == k" branch of rt_OneStep: assume is evaluated on the state and
+ * inputs before fsm_12B_step, check on the state and output after it.
+ * fsm_12B_req_eval reproduces the whole branch, including the early
+ * return of rt_OneStep when OverrunFlag is set.
+ */
+
+#ifndef fsm_12B_req_h_
+#define fsm_12B_req_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+
+#define FSM_12B_NUM_REQUIREMENTS       13
+
+/* Input vector index: standby | apfail << 1 | supported << 2 | limits << 3 */
+#define FSM_12B_NUM_INPUTS             16
+#define FSM_12B_IN_STANDBY(k)          ((boolean_T)((k) & 1U))
+#define FSM_12B_IN_APFAIL(k)           ((boolean_T)(((k) >> 1) & 1U))
+#define FSM_12B_IN_SUPPORTED(k)        ((boolean_T)(((k) >> 2) & 1U))
+#define FSM_12B_IN_LIMITS(k)           ((boolean_T)(((k) >> 3) & 1U))
+
+/* Nondeterministic values of one rt_OneStep call */
+typedef struct {
+  boolean_T rtU_standby;
+  boolean_T rtU_apfail;
+  boolean_T rtU_supported;
+  boolean_T rtU_limits;
+  boolean_T OverrunFlag;
+} fsm_12B_ReqInputs;
+
+typedef struct {
+  int_T id;                            /* sit value in ert_main.c */
+  const char_T *text;                  /* requirement comment */
+  const char_T *message;               /* __ESBMC_assert message */
+  boolean_T (*assume)(const DW *rtDW, const fsm_12B_ReqInputs *rtIn);
+  boolean_T (*check)(const DW *rtDW, boolean_T rtY_pullup);
+} fsm_12B_Requirement;
+
+typedef enum {
+  FSM_12B_REQ_SKIPPED = 0,             /* OverrunFlag: rt_OneStep returned */
+  FSM_12B_REQ_ASSUME_FALSE,            /* path cut by __ESBMC_assume */
+  FSM_12B_REQ_PASS,                    /* assertion held */
+  FSM_12B_REQ_FAIL                     /* assertion violated */
+} fsm_12B_ReqOutcome;
+
+extern const fsm_12B_Requirement
+  fsm_12B_requirements[FSM_12B_NUM_REQUIREMENTS];
+
+/* Expand input vector k into rtIn */
+extern void fsm_12B_req_inputs(uint32_T k, boolean_T OverrunFlag,
+  fsm_12B_ReqInputs *rtIn);
+
+/*
+ * Run one requirement branch from state rtDW.  The post-step state and
+ * output are written to rtDWnext and rtY_pullup when the step executes;
+ * rtDW itself is not modified.
+ */
+extern fsm_12B_ReqOutcome fsm_12B_req_eval(const fsm_12B_Requirement *req,
+  const DW *rtDW, const fsm_12B_ReqInputs *rtIn, DW *rtDWnext, boolean_T
+  *rtY_pullup);
+
+#endif                                 /* fsm_12B_req_h_ */
+
+/*
+ * File trailer for fsm_12B_req.h
+ *
+ * [EOF]
+ */
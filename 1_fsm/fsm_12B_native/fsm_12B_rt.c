@@ -0,0 +1,200 @@
+/*
+ * File: fsm_12B_rt.c
+ *
+ * Periodic real-time executor for rt_OneStep of Simulink model 'fsm_12B'.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+#include "fsm_12B_rt.h"
+#include "rtwtypes.h"
+
+#define NSEC_PER_SEC                   1000000000LL
+
+static int64_T mono_ns(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_T)ts.tv_sec * NSEC_PER_SEC + (int64_T)ts.tv_nsec;
+}
+
+static struct timespec to_timespec(int64_T ns)
+{
+  struct timespec ts;
+  ts.tv_sec = (time_t)(ns / NSEC_PER_SEC);
+  ts.tv_nsec = (long)(ns % NSEC_PER_SEC);
+  return ts;
+}
+
+static void record(uint64_T *hist, uint64_T *max, int64_T ns)
+{
+  const uint64_T v = (ns > 0) ? (uint64_T)ns : 0U;
+  hist[fsm_12B_lat_bucket(v)]++;
+  if (v > *max) {
+    *max = v;
+  }
+}
+
+static int_T fsm_12B_rt_setup(const fsm_12B_RtConfig *cfg)
+{
+  if (cfg->lock_memory && (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)) {
+    return -1;
+  }
+
+  if (cfg->cpu >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cfg->cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+      return -1;
+    }
+  }
+
+  if (cfg->priority > 0) {
+    struct sched_param sp;
+    memset(&sp, 0, sizeof(sp));
+    sp.sched_priority = cfg->priority;
+    if (sched_setscheduler(0, SCHED_FIFO, &sp) != 0) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/*
+ * Sleep until the absolute time release.  A timerfd expiring at every
+ * release may still hold expirations already handled by catching up, so
+ * it is read until the release has actually passed.
+ */
+static boolean_T fsm_12B_rt_wait(const fsm_12B_RtConfig *cfg, int_T tfd,
+  int64_T release)
+{
+  if (cfg->timer == FSM_12B_RT_TIMERFD) {
+    do {
+      uint64_T n;
+      if ((read(tfd, &n, sizeof(n)) != (ssize_t)sizeof(n)) && (errno != EINTR))
+      {
+        return false;
+      }
+    } while (mono_ns() < release);
+
+    return true;
+  } else {
+    const struct timespec ts = to_timespec(release);
+    int_T r;
+    do {
+      r = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    } while (r == EINTR);
+
+    return (boolean_T)(r == 0);
+  }
+}
+
+fsm_12B_RtStatus fsm_12B_rt_run(const fsm_12B_RtConfig *cfg, void (*step)(void
+  *arg), void *arg, volatile int_T *stop, fsm_12B_RtStats *stats)
+{
+  const int64_T period = (int64_T)(cfg->period * (real_T)NSEC_PER_SEC + 0.5);
+  fsm_12B_RtStatus status = FSM_12B_RT_OK;
+  int64_T start;
+  uint64_T k = 0U;                     /* index of the next release */
+  int_T tfd = -1;
+  memset(stats, 0, sizeof(fsm_12B_RtStats));
+  if ((period <= 0) || (fsm_12B_rt_setup(cfg) != 0)) {
+    if (period <= 0) {
+      errno = EINVAL;
+    }
+
+    return FSM_12B_RT_ERROR;
+  }
+
+  start = mono_ns() + period;
+  if (cfg->timer == FSM_12B_RT_TIMERFD) {
+    struct itimerspec its;
+    tfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    its.it_value = to_timespec(start);
+    its.it_interval = to_timespec(period);
+    if ((tfd < 0) || (timerfd_settime(tfd, TFD_TIMER_ABSTIME, &its, NULL) !=
+                      0)) {
+      if (tfd >= 0) {
+        (void)close(tfd);
+      }
+
+      return FSM_12B_RT_ERROR;
+    }
+  }
+
+  while (((cfg->releases == 0U) || (k < cfg->releases)) && !*stop) {
+    int64_T release = start + (int64_T)k * period;
+    int64_T now = mono_ns();
+    uint64_T due;
+    uint64_T i;
+
+    /* Sleep unless the release has already passed (catching up) */
+    if (now < release) {
+      if (!fsm_12B_rt_wait(cfg, tfd, release)) {
+        status = FSM_12B_RT_ERROR;
+        break;
+      }
+
+      now = mono_ns();
+    }
+
+    /* Releases that are due now, this one included */
+    due = (uint64_T)((now - release) / period) + 1U;
+    if ((cfg->releases != 0U) && (k + due > cfg->releases)) {
+      due = cfg->releases - k;
+    }
+
+    if (cfg->policy == FSM_12B_RT_SKIP) {
+      stats->skipped += due - 1U;
+      k += due - 1U;
+      release += (int64_T)(due - 1U) * period;
+      due = 1U;
+    }
+
+    for (i = 0U; (i < due) && !*stop; i++) {
+      int64_T end;
+      record(stats->jitter, &stats->max_jitter, now - release);
+      step(arg);
+      end = mono_ns();
+      record(stats->response, &stats->max_response, end - release);
+      stats->steps++;
+      stats->releases = ++k;
+      release += period;
+
+      /* Still running at the next release */
+      if (end > release) {
+        stats->overruns++;
+        if (cfg->policy == FSM_12B_RT_ABORT) {
+          status = FSM_12B_RT_ABORTED;
+          break;
+        }
+      }
+
+      now = end;
+    }
+
+    if (status != FSM_12B_RT_OK) {
+      break;
+    }
+  }
+
+  if (tfd >= 0) {
+    (void)close(tfd);
+  }
+
+  return status;
+}
+
+/*
+ * File trailer for fsm_12B_rt.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,72 @@
+/*
+ * File: fsm_12B_rt.h
+ *
+ * Periodic real-time executor for rt_OneStep of Simulink model 'fsm_12B'.
+ *
+ * Releases a step function at absolute times start + k * period, either
+ * with clock_nanosleep(TIMER_ABSTIME) or with a periodic timerfd, both on
+ * CLOCK_MONOTONIC.  The thread can optionally be pinned to a CPU, run
+ * under SCHED_FIFO and have its memory locked.  Every release records its
+ * wake-up latency (jitter) and the step's response time in log-linear
+ * histograms in nanoseconds.  A step that is still running at the next
+ * release is an overrun, handled according to fsm_12B_RtPolicy.
+ */
+
+#ifndef fsm_12B_rt_h_
+#define fsm_12B_rt_h_
+#include "rtwtypes.h"
+#include "fsm_12B_lat.h"
+
+typedef enum {
+  FSM_12B_RT_SKIP = 0,                 /* drop the missed releases */
+  FSM_12B_RT_CATCH_UP,                 /* run them back to back */
+  FSM_12B_RT_ABORT                     /* stop the executor */
+} fsm_12B_RtPolicy;
+
+typedef enum {
+  FSM_12B_RT_NANOSLEEP = 0,
+  FSM_12B_RT_TIMERFD
+} fsm_12B_RtTimer;
+
+typedef struct {
+  real_T period;                       /* s, FSM_12B_LAT_BASE_RATE / speedup */
+  uint64_T releases;                   /* 0: until stopped */
+  fsm_12B_RtPolicy policy;
+  fsm_12B_RtTimer timer;
+  int_T priority;                      /* SCHED_FIFO priority, 0: unchanged */
+  int_T cpu;                           /* CPU to pin to, -1: any */
+  boolean_T lock_memory;               /* mlockall */
+} fsm_12B_RtConfig;
+
+typedef struct {
+  uint64_T releases;                   /* periods elapsed */
+  uint64_T steps;                      /* step calls */
+  uint64_T overruns;                   /* steps that ran into a release */
+  uint64_T skipped;                    /* releases dropped by FSM_12B_RT_SKIP */
+  uint64_T max_jitter;                 /* ns */
+  uint64_T max_response;               /* ns */
+  uint64_T jitter[FSM_12B_LAT_BUCKETS];/* wake-up minus release, ns */
+  uint64_T response[FSM_12B_LAT_BUCKETS];/* step end minus release, ns */
+} fsm_12B_RtStats;
+
+typedef enum {
+  FSM_12B_RT_OK = 0,                   /* all releases done, or stopped */
+  FSM_12B_RT_ABORTED,                  /* overrun under FSM_12B_RT_ABORT */
+  FSM_12B_RT_ERROR                     /* setup or timer failure, see errno */
+} fsm_12B_RtStatus;
+
+/*
+ * Run step(arg) periodically under cfg until cfg->releases periods have
+ * elapsed or *stop becomes nonzero (it may be set from a signal handler).
+ * stats is cleared first.
+ */
+extern fsm_12B_RtStatus fsm_12B_rt_run(const fsm_12B_RtConfig *cfg, void
+  (*step)(void *arg), void *arg, volatile int_T *stop, fsm_12B_RtStats *stats);
+
+#endif                                 /* fsm_12B_rt_h_ */
+
+/*
+ * File trailer for fsm_12B_rt.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,312 @@
+/*
+ * File: fsm_12B_sched.c
+ *
+ * Rate-monotonic scheduler hosting many fsm_12B instances in one process.
+ */
+
+#define _GNU_SOURCE
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fsm_12B_sched.h"
+#include "rtwtypes.h"
+
+#define NSEC_PER_SEC                   1000000000LL
+
+static int64_T mono_ns(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_T)ts.tv_sec * NSEC_PER_SEC + (int64_T)ts.tv_nsec;
+}
+
+/* Heap order: next release for the timer heap, priority for the ready one */
+static boolean_T before(const fsm_12B_SchedTask *tasks, boolean_T timer, int_T
+  a, int_T b)
+{
+  return timer ? (tasks[a].next_release < tasks[b].next_release) :
+    (tasks[a].priority < tasks[b].priority);
+}
+
+static void heap_push(const fsm_12B_SchedTask *tasks, boolean_T timer, int_T
+                      *heap, int_T *n, int_T t)
+{
+  int_T i = (*n)++;
+  while (i > 0) {
+    const int_T p = (i - 1) / 2;
+    if (!before(tasks, timer, t, heap[p])) {
+      break;
+    }
+
+    heap[i] = heap[p];
+    i = p;
+  }
+
+  heap[i] = t;
+}
+
+static int_T heap_pop(const fsm_12B_SchedTask *tasks, boolean_T timer, int_T
+                      *heap, int_T *n)
+{
+  const int_T top = heap[0];
+  const int_T last = heap[--*n];
+  int_T i = 0;
+  for (;;) {
+    int_T c = 2 * i + 1;
+    if (c >= *n) {
+      break;
+    }
+
+    if ((c + 1 < *n) && before(tasks, timer, heap[c + 1], heap[c])) {
+      c++;
+    }
+
+    if (!before(tasks, timer, heap[c], last)) {
+      break;
+    }
+
+    heap[i] = heap[c];
+    i = c;
+  }
+
+  if (*n > 0) {
+    heap[i] = last;
+  }
+
+  return top;
+}
+
+static int cmp_period(const void *a, const void *b, void *arg)
+{
+  const fsm_12B_SchedTask *tasks = (const fsm_12B_SchedTask *)arg;
+  const fsm_12B_SchedTask *x = &tasks[*(const int_T *)a];
+  const fsm_12B_SchedTask *y = &tasks[*(const int_T *)b];
+  if (x->period != y->period) {
+    return (x->period < y->period) ? -1 : 1;
+  }
+
+  return *(const int_T *)a - *(const int_T *)b;
+}
+
+int_T fsm_12B_sched_init(fsm_12B_Sched *s, fsm_12B_SchedTask *tasks, int_T
+  ntasks, int_T nworkers, boolean_T pin)
+{
+  const int_T nalloc = (ntasks > 0) ? ntasks : 1;  /* malloc(0) may be NULL */
+  int_T *order;
+  int_T i;
+  int_T w;
+  memset(s, 0, sizeof(fsm_12B_Sched));
+  s->tasks = tasks;
+  s->ntasks = ntasks;
+  s->nworkers = nworkers;
+  if (nworkers < 1) {
+    return -1;
+  }
+
+  for (i = 0; i < ntasks; i++) {
+    if ((tasks[i].period <= 0) || (tasks[i].worker < -1) || (tasks[i].worker >=
+         nworkers)) {
+      return -1;
+    }
+  }
+
+  s->workers = (fsm_12B_SchedWorker *)calloc((size_t)nworkers, sizeof
+    (fsm_12B_SchedWorker));
+  order = (int_T *)malloc((size_t)nalloc * sizeof(int_T));
+  if ((s->workers == NULL) || (order == NULL)) {
+    free(order);
+    fsm_12B_sched_free(s);
+    return -1;
+  }
+
+  for (w = 0; w < nworkers; w++) {
+    fsm_12B_SchedWorker *wk = &s->workers[w];
+    wk->sched = s;
+    wk->id = w;
+    wk->cpu = pin ? w : -1;
+    wk->timer = (int_T *)malloc((size_t)nalloc * sizeof(int_T));
+    wk->ready = (int_T *)malloc((size_t)nalloc * sizeof(int_T));
+    if ((wk->timer == NULL) || (wk->ready == NULL)) {
+      free(order);
+      fsm_12B_sched_free(s);
+      return -1;
+    }
+  }
+
+  /* Rate-monotonic ranks */
+  for (i = 0; i < ntasks; i++) {
+    order[i] = i;
+  }
+
+  qsort_r(order, (size_t)ntasks, sizeof(int_T), cmp_period, tasks);
+  for (i = 0; i < ntasks; i++) {
+    fsm_12B_SchedTask *t = &tasks[order[i]];
+    t->priority = i;
+    if (t->worker >= 0) {
+      s->workers[t->worker].load += (real_T)NSEC_PER_SEC / (real_T)t->period;
+    }
+  }
+
+  /* Worst-fit placement, highest rate first */
+  for (i = 0; i < ntasks; i++) {
+    fsm_12B_SchedTask *t = &tasks[order[i]];
+    if (t->worker < 0) {
+      int_T best = 0;
+      for (w = 1; w < nworkers; w++) {
+        if (s->workers[w].load < s->workers[best].load) {
+          best = w;
+        }
+      }
+
+      t->worker = best;
+      s->workers[best].load += (real_T)NSEC_PER_SEC / (real_T)t->period;
+    }
+  }
+
+  free(order);
+  return 0;
+}
+
+static void *fsm_12B_sched_worker(void *arg)
+{
+  fsm_12B_SchedWorker *wk = (fsm_12B_SchedWorker *)arg;
+  fsm_12B_Sched *s = wk->sched;
+  fsm_12B_SchedTask *tasks = s->tasks;
+  if (wk->cpu >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(wk->cpu, &set);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  }
+
+  while (!*s->stop) {
+    int64_T now = mono_ns();
+    if (now >= s->end) {
+      break;
+    }
+
+    /* Move every due release to the ready queue */
+    while ((wk->ntimer > 0) && (tasks[wk->timer[0]].next_release <= now)) {
+      const int_T i = heap_pop(tasks, true, wk->timer, &wk->ntimer);
+      fsm_12B_SchedTask *t = &tasks[i];
+      if (t->pending) {
+        /* The previous job never started before its deadline */
+        t->missed++;
+        t->dropped++;
+      } else {
+        t->pending = true;
+        heap_push(tasks, false, wk->ready, &wk->nready, i);
+      }
+
+      t->job_release = t->next_release;
+      t->releases++;
+      t->next_release += t->period;
+      heap_push(tasks, true, wk->timer, &wk->ntimer, i);
+    }
+
+    if (wk->nready > 0) {
+      const int_T i = heap_pop(tasks, false, wk->ready, &wk->nready);
+      fsm_12B_SchedTask *t = &tasks[i];
+      const int64_T start = mono_ns();
+      int64_T end;
+      int64_T lateness;
+      t->step(t->arg);
+      end = mono_ns();
+      wk->busy += end - start;
+      lateness = end - (t->job_release + t->period);
+      if (end - t->job_release > t->max_response) {
+        t->max_response = end - t->job_release;
+      }
+
+      if ((t->completions == 0U) || (lateness > t->max_lateness)) {
+        t->max_lateness = lateness;
+      }
+
+      if (lateness > 0) {
+        t->missed++;
+      }
+
+      t->completions++;
+      t->pending = false;
+    } else {
+      int64_T wake = (wk->ntimer > 0) ? tasks[wk->timer[0]].next_release :
+        s->end;
+      struct timespec ts;
+      if (wake > s->end) {
+        wake = s->end;
+      }
+
+      ts.tv_sec = (time_t)(wake / NSEC_PER_SEC);
+      ts.tv_nsec = (long)(wake % NSEC_PER_SEC);
+      (void)clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    }
+  }
+
+  return NULL;
+}
+
+int_T fsm_12B_sched_run(fsm_12B_Sched *s, int64_T duration, volatile int_T
+  *stop)
+{
+  int_T status = 0;
+  int_T started;
+  int_T i;
+  s->stop = stop;
+  s->start = mono_ns() + NSEC_PER_SEC / 100;
+  s->end = s->start + duration;
+  for (i = 0; i < s->nworkers; i++) {
+    s->workers[i].ntimer = 0;
+    s->workers[i].nready = 0;
+    s->workers[i].busy = 0;
+  }
+
+  for (i = 0; i < s->ntasks; i++) {
+    fsm_12B_SchedTask *t = &s->tasks[i];
+    fsm_12B_SchedWorker *wk = &s->workers[t->worker];
+    t->releases = 0U;
+    t->completions = 0U;
+    t->missed = 0U;
+    t->dropped = 0U;
+    t->max_response = 0;
+    t->max_lateness = 0;
+    t->next_release = s->start + t->offset;
+    t->pending = false;
+    heap_push(s->tasks, true, wk->timer, &wk->ntimer, i);
+  }
+
+  for (started = 0; started < s->nworkers; started++) {
+    fsm_12B_SchedWorker *wk = &s->workers[started];
+    if (pthread_create(&wk->tid, NULL, fsm_12B_sched_worker, wk) != 0) {
+      status = -1;
+      *stop = 1;
+      break;
+    }
+  }
+
+  for (i = 0; i < started; i++) {
+    (void)pthread_join(s->workers[i].tid, NULL);
+  }
+
+  return status;
+}
+
+void fsm_12B_sched_free(fsm_12B_Sched *s)
+{
+  int_T w;
+  if (s->workers != NULL) {
+    for (w = 0; w < s->nworkers; w++) {
+      free(s->workers[w].timer);
+      free(s->workers[w].ready);
+    }
+
+    free(s->workers);
+    s->workers = NULL;
+  }
+}
+
+/*
+ * File trailer for fsm_12B_sched.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,99 @@
+/*
+ * File: fsm_12B_sched.h
+ *
+ * Rate-monotonic scheduler hosting many fsm_12B instances in one process.
+ *
+ * Each task is an rt_OneStep-style step function with its own period and
+ * offset.  Tasks are partitioned over a fixed pool of worker threads, one
+ * per core, and stay on their worker for the whole run so that their
+ * RT_MODEL/DW remain in that core's cache.  Each worker keeps a timer heap
+ * of next releases and a ready queue ordered by rate-monotonic priority
+ * (shorter period first) and runs one job at a time to completion.
+ *
+ * The deadline of a job is its next release.  A job completing after it
+ * counts as missed; a job still waiting in the ready queue when the next
+ * release arrives is dropped, which also counts as missed, and only the
+ * newest release runs.
+ */
+
+#ifndef fsm_12B_sched_h_
+#define fsm_12B_sched_h_
+#include <pthread.h>
+#include "rtwtypes.h"
+
+typedef struct {
+  /* Set by the caller */
+  void (*step)(void *arg);
+  void *arg;
+  int64_T period;                      /* ns */
+  int64_T offset;                      /* ns, first release after start */
+  int_T worker;                        /* -1: assigned by fsm_12B_sched_init */
+
+  /* Set by fsm_12B_sched_init */
+  int_T priority;                      /* rate-monotonic rank, 0 highest */
+
+  /* Statistics, written by the owning worker */
+  uint64_T releases;
+  uint64_T completions;
+  uint64_T missed;                     /* late or dropped jobs */
+  uint64_T dropped;                    /* of which never started */
+  int64_T max_response;                /* ns from release to completion */
+  int64_T max_lateness;                /* ns past the deadline, <= 0 if none */
+
+  /* Worker state */
+  int64_T next_release;
+  int64_T job_release;
+  boolean_T pending;
+} fsm_12B_SchedTask;
+
+typedef struct fsm_12B_Sched_tag fsm_12B_Sched;
+
+typedef struct {
+  fsm_12B_Sched *sched;
+  int_T id;
+  int_T cpu;                           /* -1: not pinned */
+  int_T *timer;                        /* heap on next_release */
+  int_T ntimer;
+  int_T *ready;                        /* heap on priority */
+  int_T nready;
+  real_T load;                         /* sum of 1 / period, in 1/s */
+  int64_T busy;                        /* ns spent in steps */
+  pthread_t tid;
+} fsm_12B_SchedWorker;
+
+struct fsm_12B_Sched_tag {
+  fsm_12B_SchedTask *tasks;
+  int_T ntasks;
+  fsm_12B_SchedWorker *workers;
+  int_T nworkers;
+  int64_T start;                       /* CLOCK_MONOTONIC, ns */
+  int64_T end;
+  volatile int_T *stop;
+};
+
+/*
+ * Rank tasks[0..ntasks) by period and place every task with worker < 0
+ * on the least loaded worker, highest rate first.  Workers are pinned to
+ * CPUs 0..nworkers-1 when pin is set.  Returns 0, or -1 when out of
+ * memory, nworkers is below 1, a period is not positive or a worker is
+ * neither -1 nor below nworkers.
+ */
+extern int_T fsm_12B_sched_init(fsm_12B_Sched *s, fsm_12B_SchedTask *tasks,
+  int_T ntasks, int_T nworkers, boolean_T pin);
+
+/*
+ * Run all workers for duration ns, or until *stop becomes nonzero, and
+ * join them.  Returns 0, or -1 when a worker could not be started.
+ */
+extern int_T fsm_12B_sched_run(fsm_12B_Sched *s, int64_T duration, volatile
+  int_T *stop);
+
+extern void fsm_12B_sched_free(fsm_12B_Sched *s);
+
+#endif                                 /* fsm_12B_sched_h_ */
+
+/*
+ * File trailer for fsm_12B_sched.h
+ *
+ * [EOF]
+ */
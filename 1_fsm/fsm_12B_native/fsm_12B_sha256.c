@@ -0,0 +1,160 @@
+/*
+ * File: fsm_12B_sha256.c
+ *
+ * SHA-256 (FIPS 180-4) content hashes for the verification tools of model
+ * 'fsm_12B'.
+ */
+
+#include <string.h>
+#include "fsm_12B_sha256.h"
+#include "rtwtypes.h"
+
+static const uint32_T fsm_12B_sha256_k[64] = { 0x428A2F98U, 0x71374491U,
+  0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+  0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU,
+  0x9BDC06A7U, 0xC19BF174U, 0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU,
+  0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU, 0x983E5152U, 0xA831C66DU,
+  0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+  0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU,
+  0x81C2C92EU, 0x92722C85U, 0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U,
+  0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U, 0x19A4C116U, 0x1E376C08U,
+  0x2748774CU, 0x34B0BCB5U, 0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+  0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U, 0x90BEFFFAU, 0xA4506CEBU,
+  0xBEF9A3F7U, 0xC67178F2U };
+
+static uint32_T rotr(uint32_T x, int_T n)
+{
+  return (x >> n) | (x << (32 - n));
+}
+
+static void compress(fsm_12B_Sha256 *c, const uint8_T *p)
+{
+  uint32_T w[64];
+  uint32_T s[8];
+  int_T i;
+  for (i = 0; i < 16; i++) {
+    w[i] = ((uint32_T)p[4 * i] << 24) | ((uint32_T)p[4 * i + 1] << 16) |
+      ((uint32_T)p[4 * i + 2] << 8) | (uint32_T)p[4 * i + 3];
+  }
+
+  for (i = 16; i < 64; i++) {
+    const uint32_T s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >>
+      3);
+    const uint32_T s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >>
+      10);
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+
+  memcpy(s, c->h, sizeof(s));
+  for (i = 0; i < 64; i++) {
+    const uint32_T e = s[4];
+    const uint32_T a = s[0];
+    const uint32_T t1 = s[7] + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e &
+      s[5]) ^ (~e & s[6])) + fsm_12B_sha256_k[i] + w[i];
+    const uint32_T t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & s[1]) ^
+      (a & s[2]) ^ (s[1] & s[2]));
+    s[7] = s[6];
+    s[6] = s[5];
+    s[5] = e;
+    s[4] = s[3] + t1;
+    s[3] = s[2];
+    s[2] = s[1];
+    s[1] = a;
+    s[0] = t1 + t2;
+  }
+
+  for (i = 0; i < 8; i++) {
+    c->h[i] += s[i];
+  }
+}
+
+void fsm_12B_sha256_init(fsm_12B_Sha256 *c)
+{
+  static const uint32_T h0[8] = { 0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U,
+    0xA54FF53AU, 0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U };
+
+  memcpy(c->h, h0, sizeof(h0));
+  c->bytes = 0U;
+}
+
+void fsm_12B_sha256_update(fsm_12B_Sha256 *c, const void *p, size_t n)
+{
+  const uint8_T *b = (const uint8_T *)p;
+  size_t fill = (size_t)(c->bytes & 63U);
+  c->bytes += n;
+  if (fill != 0U) {
+    const size_t take = (n < 64U - fill) ? n : 64U - fill;
+    memcpy(&c->block[fill], b, take);
+    b += take;
+    n -= take;
+    if (fill + take < 64U) {
+      return;
+    }
+
+    compress(c, c->block);
+  }
+
+  while (n >= 64U) {
+    compress(c, b);
+    b += 64;
+    n -= 64U;
+  }
+
+  memcpy(c->block, b, n);
+}
+
+void fsm_12B_sha256_field(fsm_12B_Sha256 *c, const void *p, size_t n)
+{
+  uint8_T len[8];
+  int_T i;
+  for (i = 0; i < 8; i++) {
+    len[i] = (uint8_T)((uint64_T)n >> (8 * i));
+  }
+
+  fsm_12B_sha256_update(c, len, sizeof(len));
+  fsm_12B_sha256_update(c, p, n);
+}
+
+void fsm_12B_sha256_final(fsm_12B_Sha256 *c, uint8_T
+  digest[FSM_12B_SHA256_BYTES])
+{
+  static const uint8_T pad[64] = { 0x80U };
+
+  const uint64_T bits = c->bytes * 8U;
+  uint8_T len[8];
+  int_T i;
+  for (i = 0; i < 8; i++) {
+    len[i] = (uint8_T)(bits >> (56 - 8 * i));
+  }
+
+  fsm_12B_sha256_update(c, pad, (size_t)(((119U - (c->bytes & 63U)) & 63U) +
+    1U));
+  fsm_12B_sha256_update(c, len, sizeof(len));
+  for (i = 0; i < 8; i++) {
+    digest[4 * i] = (uint8_T)(c->h[i] >> 24);
+    digest[4 * i + 1] = (uint8_T)(c->h[i] >> 16);
+    digest[4 * i + 2] = (uint8_T)(c->h[i] >> 8);
+    digest[4 * i + 3] = (uint8_T)c->h[i];
+  }
+}
+
+void fsm_12B_sha256_hex(const uint8_T digest[FSM_12B_SHA256_BYTES], char_T
+  hex[FSM_12B_SHA256_HEX])
+{
+  static const char_T digit[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8',
+    '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+  int_T i;
+  for (i = 0; i < FSM_12B_SHA256_BYTES; i++) {
+    hex[2 * i] = digit[digest[i] >> 4];
+    hex[2 * i + 1] = digit[digest[i] & 15U];
+  }
+
+  hex[2 * FSM_12B_SHA256_BYTES] = '\0';
+}
+
+/*
+ * File trailer for fsm_12B_sha256.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,45 @@
+/*
+ * File: fsm_12B_sha256.h
+ *
+ * SHA-256 content hashes for the verification tools of model 'fsm_12B'.
+ * A verdict is reused only when the hash of everything it depends on is
+ * unchanged, so the hash must not collide in practice even over years of
+ * stored results.
+ */
+
+#ifndef fsm_12B_sha256_h_
+#define fsm_12B_sha256_h_
+#include <stddef.h>
+#include "rtwtypes.h"
+
+#define FSM_12B_SHA256_BYTES           32
+#define FSM_12B_SHA256_HEX             65   /* 64 digits and the NUL */
+
+typedef struct {
+  uint32_T h[8];
+  uint64_T bytes;
+  uint8_T block[64];
+} fsm_12B_Sha256;
+
+extern void fsm_12B_sha256_init(fsm_12B_Sha256 *c);
+extern void fsm_12B_sha256_update(fsm_12B_Sha256 *c, const void *p, size_t n);
+
+/*
+ * Hash a length-prefixed string, so that consecutive fields cannot run
+ * into each other.
+ */
+extern void fsm_12B_sha256_field(fsm_12B_Sha256 *c, const void *p, size_t n);
+extern void fsm_12B_sha256_final(fsm_12B_Sha256 *c, uint8_T
+  digest[FSM_12B_SHA256_BYTES]);
+
+/* Lower-case hex of digest */
+extern void fsm_12B_sha256_hex(const uint8_T digest[FSM_12B_SHA256_BYTES],
+  char_T hex[FSM_12B_SHA256_HEX]);
+
+#endif                                 /* fsm_12B_sha256_h_ */
+
+/*
+ * File trailer for fsm_12B_sha256.h
+ *
+ * [EOF]
+ */
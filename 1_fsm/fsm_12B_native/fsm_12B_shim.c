@@ -0,0 +1,286 @@
+/*
+ * File: fsm_12B_shim.c
+ *
+ * Native runtime for the ESBMC intrinsics used by the verification
+ * harnesses.
+ *
+ * ESBMC starts every path with the statics of the program image, so a
+ * trial must not see what the previous one left in rtDW or in the static
+ * OverrunFlag of rt_OneStep.  fsm_12B_shim_init copies the writable data
+ * of the executable, __data_start to _end on GNU/Linux, and every trial
+ * copies it back first.  This is also why the shim state must live on the
+ * stack or the heap.
+ *
+ * Under libFuzzer the rest of the executable must keep its statics, so
+ * the harness object can have its .data and .bss renamed into the section
+ * fsm_12B_harness_data, .bss with contents so that the linker keeps the
+ * two in one output section:
+ *
+ *   objcopy --rename-section .data=fsm_12B_harness_data
+ *     --rename-section .bss=fsm_12B_harness_data,alloc,load,contents,data
+ *     harness.o
+ *
+ * When that section is linked in, only it is copied and restored.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_shim.h"
+#include "rtwtypes.h"
+
+/* Bounds of .data and .bss, from the linker */
+extern char __data_start[];
+extern char _end[];
+
+/* Bounds of the renamed harness data, null when there is none */
+extern char __start_fsm_12B_harness_data[] __attribute__((weak));
+extern char __stop_fsm_12B_harness_data[] __attribute__((weak));
+
+/* Trial in progress, part of the snapshot */
+static fsm_12B_Shim *fsm_12B_shim_active;
+
+static uint8_T next_byte(void)
+{
+  fsm_12B_Shim *s = fsm_12B_shim_active;
+  uint64_T z;
+  if (s->data != NULL) {
+    /* An exhausted stream reads as zeros */
+    return (s->pos < s->size) ? s->data[s->pos++] : 0U;
+  }
+
+  /* splitmix64 */
+  s->rng += 0x9E3779B97F4A7C15ULL;
+  z = s->rng;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z ^= z >> 31;
+  if (s->len == s->cap) {
+    const size_t cap = (s->cap == 0U) ? 64U : 2U * s->cap;
+    uint8_T *input = (uint8_T *)realloc(s->input, cap);
+    if (input == NULL) {
+      return (uint8_T)z;
+    }
+
+    s->input = input;
+    s->cap = cap;
+  }
+
+  s->input[s->len++] = (uint8_T)z;
+  return (uint8_T)z;
+}
+
+/* Little-endian value of n bytes */
+static uint64_T raw_bits(int_T n)
+{
+  uint64_T v = 0U;
+  int_T i;
+  for (i = 0; i < n; i++) {
+    v |= (uint64_T)next_byte() << (8 * i);
+  }
+
+  return v;
+}
+
+/*
+ * Integers: a tag byte chooses the full range (1 in 4) or a small signed
+ * value, so that branches such as sit == 7 are hit by the generator too.
+ */
+static uint64_T nondet_bits(int_T n)
+{
+  if ((next_byte() & 3U) == 0U) {
+    return raw_bits(n);
+  }
+
+  return (uint64_T)(int64_T)(int8_T)next_byte();
+}
+
+static real_T nondet_real(boolean_T single)
+{
+  static const real_T special[8] = { 0.0, -0.0, HUGE_VAL, -HUGE_VAL, DBL_MIN,
+    DBL_MAX, DBL_EPSILON, NAN };
+
+  switch (next_byte() & 3U) {
+   case 0:
+    if (single) {
+      const uint32_T bits = (uint32_T)raw_bits(4);
+      real32_T f;
+      memcpy(&f, &bits, sizeof(f));
+      return (real_T)f;
+    } else {
+      const uint64_T bits = raw_bits(8);
+      real_T d;
+      memcpy(&d, &bits, sizeof(d));
+      return d;
+    }
+
+   case 1:
+    return (real_T)(int8_T)next_byte();
+
+   case 2:
+    return (real_T)(int8_T)next_byte() / 16.0;
+
+   default:
+    return special[next_byte() & 7U];
+  }
+}
+
+static void end_trial(int_T status)
+{
+  fsm_12B_Shim *s = fsm_12B_shim_active;
+  s->status = status;
+  longjmp(s->env, 1);
+}
+
+void __ESBMC_assume(_Bool cond)
+{
+  if (!cond) {
+    if (fsm_12B_shim_active == NULL) {
+      exit(0);
+    }
+
+    end_trial(FSM_12B_SHIM_REJECT);
+  }
+}
+
+void __ESBMC_assert(_Bool cond, const char *msg)
+{
+  if (!cond) {
+    if ((fsm_12B_shim_active == NULL) || ((fsm_12B_shim_active->flags &
+          FSM_12B_SHIM_ABORT) != 0)) {
+      fprintf(stderr, "assertion failed: %s\n", msg);
+      abort();
+    }
+
+    fsm_12B_shim_active->message = msg;
+    end_trial(FSM_12B_SHIM_FAIL);
+  }
+}
+
+_Bool nondet_bool(void)
+{
+  return (_Bool)(next_byte() & 1U);
+}
+
+char nondet_char(void)
+{
+  return (char)nondet_bits(1);
+}
+
+unsigned char nondet_uchar(void)
+{
+  return (unsigned char)nondet_bits(1);
+}
+
+short nondet_short(void)
+{
+  return (short)nondet_bits(2);
+}
+
+unsigned short nondet_ushort(void)
+{
+  return (unsigned short)nondet_bits(2);
+}
+
+int nondet_int(void)
+{
+  return (int)nondet_bits(4);
+}
+
+unsigned int nondet_uint(void)
+{
+  return (unsigned int)nondet_bits(4);
+}
+
+long nondet_long(void)
+{
+  return (long)nondet_bits((int_T)sizeof(long));
+}
+
+unsigned long nondet_ulong(void)
+{
+  return (unsigned long)nondet_bits((int_T)sizeof(long));
+}
+
+float nondet_float(void)
+{
+  return (float)nondet_real(true);
+}
+
+double nondet_double(void)
+{
+  return nondet_real(false);
+}
+
+int fsm_12B_shim_init(fsm_12B_Shim *s, unsigned long long seed, int flags)
+{
+  const char *p = (const char *)s;
+  char *first = __data_start;
+  char *last = _end;
+  memset(s, 0, sizeof(fsm_12B_Shim));
+  s->rng = seed;
+  s->flags = flags;
+  fsm_12B_shim_active = s;
+  if ((flags & FSM_12B_SHIM_NO_RESET) != 0) {
+    return 0;
+  }
+
+  if (__start_fsm_12B_harness_data != NULL) {
+    first = __start_fsm_12B_harness_data;
+    last = __stop_fsm_12B_harness_data;
+  }
+
+  if ((p + sizeof(fsm_12B_Shim) > first) && (p < last)) {
+    return -1;
+  }
+
+  s->image_start = first;
+  s->image_size = (size_t)(last - first);
+  s->image = (uint8_T *)malloc(s->image_size + 1U);
+  if (s->image == NULL) {
+    return -1;
+  }
+
+  memcpy(s->image, first, s->image_size);
+  return 0;
+}
+
+int fsm_12B_shim_run(fsm_12B_Shim *s, void (*harness)(void), const unsigned
+                     char *data, size_t size)
+{
+  if (s->image != NULL) {
+    memcpy(s->image_start, s->image, s->image_size);
+  }
+
+  fsm_12B_shim_active = s;
+  s->data = data;
+  s->size = size;
+  s->pos = 0U;
+  s->len = 0U;
+  s->message = NULL;
+  s->status = FSM_12B_SHIM_PASS;
+  if (setjmp(s->env) == 0) {
+    harness();
+  }
+
+  return s->status;
+}
+
+void fsm_12B_shim_free(fsm_12B_Shim *s)
+{
+  free(s->input);
+  free(s->image);
+  s->input = NULL;
+  s->image = NULL;
+  if (fsm_12B_shim_active == s) {
+    fsm_12B_shim_active = NULL;
+  }
+}
+
+/*
+ * File trailer for fsm_12B_shim.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,91 @@
+/*
+ * File: fsm_12B_shim.h
+ *
+ * Native runtime for the ESBMC intrinsics used by the verification
+ * harnesses, so that an unchanged harness builds with gcc and runs as a
+ * fuzzer or a randomized smoke test.
+ *
+ * The nondet_* functions draw from a byte stream (a libFuzzer or AFL
+ * input) or from a seeded generator whose bytes are recorded, so every
+ * trial can be replayed from a file.  A failed __ESBMC_assume rejects the
+ * trial at once; a failed __ESBMC_assert ends it with the message and
+ * the input consumed so far.
+ *
+ * The header declares only plain C types so that it can be force-included
+ * into any harness, with the harness main renamed:
+ *
+ *   gcc -O2 -c -include fsm_12B_shim.h -Dmain=fsm_12B_harness ert_main.c
+ */
+
+#ifndef fsm_12B_shim_h_
+#define fsm_12B_shim_h_
+#include <setjmp.h>
+#include <stddef.h>
+
+/* Trial outcomes */
+#define FSM_12B_SHIM_PASS              0
+#define FSM_12B_SHIM_REJECT            1    /* an assumption did not hold */
+#define FSM_12B_SHIM_FAIL              2    /* an assertion did not hold */
+
+/* fsm_12B_shim_init flags */
+#define FSM_12B_SHIM_ABORT             1    /* abort() on a failed assertion */
+#define FSM_12B_SHIM_NO_RESET          2    /* keep statics across trials */
+
+typedef struct {
+  const unsigned char *data;           /* byte stream, NULL for the generator */
+  size_t size;
+  size_t pos;
+  unsigned long long rng;              /* generator state */
+  unsigned char *input;                /* bytes drawn from the generator */
+  size_t len;
+  size_t cap;
+  const char *message;                 /* of the failed assertion */
+  int flags;
+  volatile int status;
+  unsigned char *image;                /* writable data at fsm_12B_shim_init */
+  char *image_start;                   /* where it is restored */
+  size_t image_size;
+  jmp_buf env;
+} fsm_12B_Shim;
+
+/* ESBMC intrinsics */
+extern void __ESBMC_assume(_Bool cond);
+extern void __ESBMC_assert(_Bool cond, const char *msg);
+extern _Bool nondet_bool(void);
+extern char nondet_char(void);
+extern unsigned char nondet_uchar(void);
+extern short nondet_short(void);
+extern unsigned short nondet_ushort(void);
+extern int nondet_int(void);
+extern unsigned int nondet_uint(void);
+extern long nondet_long(void);
+extern unsigned long nondet_ulong(void);
+extern float nondet_float(void);
+extern double nondet_double(void);
+
+/*
+ * Snapshot the writable data of the executable, or only the section
+ * fsm_12B_harness_data when the harness object was built with one (see
+ * fsm_12B_shim.c), so that every trial starts from the statics the
+ * harness had at program start.  s must not itself lie in the snapshot.
+ * Returns 0, or -1 when it does or memory runs out.
+ */
+extern int fsm_12B_shim_init(fsm_12B_Shim *s, unsigned long long seed, int
+  flags);
+
+/*
+ * Run one trial of harness, fed from data[0..size-1], or from the
+ * generator when data is NULL.  Returns a FSM_12B_SHIM_* outcome.  The
+ * bytes of a generated trial are left in s->input[0..s->len-1].
+ */
+extern int fsm_12B_shim_run(fsm_12B_Shim *s, void (*harness)(void), const
+  unsigned char *data, size_t size);
+extern void fsm_12B_shim_free(fsm_12B_Shim *s);
+
+#endif                                 /* fsm_12B_shim_h_ */
+
+/*
+ * File trailer for fsm_12B_shim.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,831 @@
+/*
+ * File: fsm_12B_slice.c
+ *
+ * Cone-of-influence slicer of fsm_12B_slice.h.
+ *
+ * The body of fsm_12B_step is read into a tree of comments, statements and
+ * if / else if / else chains, which is all the generated code contains.
+ * Slicing walks a block backwards with the set of variables still needed:
+ * an assignment to one of them is kept and adds what it reads; an if is
+ * kept when one of its branches keeps something, and then adds the
+ * variables of all its conditions.  A comment goes with the statement that
+ * follows it, an "End of ..." comment with the one before.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_slice.h"
+#include "rtwtypes.h"
+
+#define MAX_NODES                      1024
+#define MAX_LIST                       4096
+#define MAX_BLOCK                      256
+#define MAX_BRANCHES                   16
+#define MAX_DEPTH                      32
+
+typedef enum {
+  COMMENT = 0,
+  STATEMENT,
+  IF
+} NodeKind;
+
+/* Nodes of a block, in s->list[first .. first + n - 1] */
+typedef struct {
+  int_T first;
+  int_T n;
+} Block;
+
+typedef struct {
+  NodeKind kind;
+  size_t line;                         /* start of the line of the node */
+  size_t start;                        /* COMMENT, STATEMENT: text */
+  size_t end;
+  boolean_T blank;                     /* an empty line before it */
+  int_T def;                           /* STATEMENT: variable set, or -1 */
+  uint64_T uses;                       /* read; IF: by the conditions */
+  int_T nbranches;                     /* IF */
+  boolean_T has_else;                  /* the last branch is the else */
+  size_t cond[MAX_BRANCHES][2];
+  Block body[MAX_BRANCHES];
+  boolean_T keep;
+} Node;
+
+typedef struct {
+  const char_T *t;
+  size_t n;
+  size_t pos;
+  boolean_T failed;
+  Node *node;
+  int_T nnodes;
+  int_T list[MAX_LIST];
+  int_T nlist;
+  fsm_12B_SliceVars vars;
+  uint64_T related[FSM_12B_SLICE_MAX_VARS];/* the same or one element of */
+} Slicer;
+
+static boolean_T is_ident(char_T c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >=
+    '0') && (c <= '9')) || (c == '_');
+}
+
+static boolean_T is_space(char_T c)
+{
+  return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') || (c == '\f');
+}
+
+static boolean_T keyword(const char_T *t, size_t n, size_t i, const char_T *k)
+{
+  const size_t kl = strlen(k);
+  return (i + kl <= n) && (strncmp(&t[i], k, kl) == 0) && ((i + kl == n) ||
+    !is_ident(t[i + kl]));
+}
+
+/* Index of name in v, added if new; -1 when v is full */
+static int_T intern(fsm_12B_SliceVars *v, const char_T *name)
+{
+  int_T i;
+  for (i = 0; i < v->n; i++) {
+    if (strcmp(v->name[i], name) == 0) {
+      return i;
+    }
+  }
+
+  if (v->n == FSM_12B_SLICE_MAX_VARS) {
+    return -1;
+  }
+
+  (void)snprintf(v->name[v->n], FSM_12B_SLICE_NAME, "%s", name);
+  return v->n++;
+}
+
+/*
+ * The variable at t[i], written as in fsm_12B.c into name; returns the end
+ * of its text, or i when there is none.
+ */
+static size_t variable_at(const char_T *t, size_t n, size_t i, char_T *name)
+{
+  size_t j = i;
+  size_t f;
+  if ((i > 0U) && (is_ident(t[i - 1U]) || (t[i - 1U] == '.') || (t[i - 1U] ==
+        '>'))) {
+    return i;
+  }
+
+  if ((i + 4U < n) && ((strncmp(&t[i], "rtU_", 4U) == 0) || (strncmp(&t[i],
+         "rtY_", 4U) == 0))) {
+    while ((j < n) && is_ident(t[j])) {
+      j++;
+    }
+
+    if (j - i >= (size_t)FSM_12B_SLICE_NAME) {
+      return i;
+    }
+
+    memcpy(name, &t[i], j - i);
+    name[j - i] = '\0';
+    return j;
+  }
+
+  if (!keyword(t, n, i, "rtDW")) {
+    return i;
+  }
+
+  j += 4U;
+  if ((j + 2U <= n) && (strncmp(&t[j], "->", 2U) == 0)) {
+    j += 2U;
+  } else if ((j < n) && (t[j] == '.')) {
+    j++;
+  } else {
+    return i;
+  }
+
+  f = j;
+  while ((j < n) && is_ident(t[j])) {
+    j++;
+  }
+
+  if ((j == f) || (j - f + 10U >= (size_t)FSM_12B_SLICE_NAME)) {
+    return i;
+  }
+
+  (void)snprintf(name, FSM_12B_SLICE_NAME, "rtDW->%.*s", (int)(j - f), &t[f]);
+  if ((j < n) && (t[j] == '[')) {
+    size_t k = j + 1U;
+    while ((k < n) && (t[k] >= '0') && (t[k] <= '9')) {
+      k++;
+    }
+
+    /* A constant index names one element, anything else the whole array */
+    if ((k > j + 1U) && (k < n) && (t[k] == ']') && (k - j < 8U)) {
+      const size_t base = strlen(name);
+      (void)snprintf(&name[base], FSM_12B_SLICE_NAME - base, "%.*s", (int)(k -
+        j + 1U), &t[j]);
+      j = k + 1U;
+    }
+  }
+
+  return j;
+}
+
+/* Variables of t[from .. to - 1], interned in v; *full set when v is full */
+static uint64_T vars_in(fsm_12B_SliceVars *v, const char_T *t, size_t from,
+  size_t to, boolean_T *full)
+{
+  char_T name[FSM_12B_SLICE_NAME];
+  uint64_T mask = 0U;
+  size_t i = from;
+  while (i < to) {
+    const size_t end = variable_at(t, to, i, name);
+    int_T k;
+    if (end == i) {
+      i++;
+      continue;
+    }
+
+    k = intern(v, name);
+    if (k < 0) {
+      *full = true;
+    } else {
+      mask |= (uint64_T)1U << k;
+    }
+
+    i = end;
+  }
+
+  return mask;
+}
+
+int_T fsm_12B_slice_vars(fsm_12B_SliceVars *v, const char_T *expr)
+{
+  const int_T before = v->n;
+  boolean_T full = false;
+  (void)vars_in(v, expr, 0U, strlen(expr), &full);
+  return full ? -1 : v->n - before;
+}
+
+static int_T new_node(Slicer *s, NodeKind kind)
+{
+  Node *nd;
+  if (s->nnodes == MAX_NODES) {
+    s->failed = true;
+    return -1;
+  }
+
+  nd = &s->node[s->nnodes];
+  memset(nd, 0, sizeof(Node));
+  nd->kind = kind;
+  nd->def = -1;
+  return s->nnodes++;
+}
+
+/* Position after the parenthesis matching the one at i, or 0 */
+static size_t match_paren(const char_T *t, size_t n, size_t i)
+{
+  int_T depth = 0;
+  for (; i < n; i++) {
+    if (t[i] == '(') {
+      depth++;
+    } else if ((t[i] == ')') && (--depth == 0)) {
+      return i + 1U;
+    }
+  }
+
+  return 0U;
+}
+
+static void skip_space(Slicer *s)
+{
+  while ((s->pos < s->n) && is_space(s->t[s->pos])) {
+    s->pos++;
+  }
+}
+
+/* Definition and uses of the statement t[start .. end - 1] */
+static void statement(Slicer *s, Node *nd)
+{
+  const char_T *t = s->t;
+  boolean_T full = false;
+  size_t j;
+  for (j = nd->start; j < nd->end; j++) {
+    if ((t[j] == '=') && (t[j + 1U] != '=') && ((j == nd->start) || (strchr(
+           "=!<>", t[j - 1U]) == NULL) || ((j >= nd->start + 2U) && (t[j - 2U]
+           == t[j - 1U])))) {
+      break;
+    }
+  }
+
+  if (j == nd->end) {
+    /* A call or another expression: kept, whatever it reads */
+    nd->uses = vars_in(&s->vars, t, nd->start, nd->end, &full);
+  } else {
+    char_T name[FSM_12B_SLICE_NAME];
+    size_t i;
+    boolean_T compound = (j > nd->start) && (strchr("+-*/%&|^<>", t[j - 1U])
+      != NULL);
+    nd->uses = vars_in(&s->vars, t, j + 1U, nd->end, &full);
+    for (i = nd->start; i < j; i++) {
+      const size_t end = variable_at(t, j, i, name);
+      if (end != i) {
+        nd->def = intern(&s->vars, name);
+        full = full || (nd->def < 0);
+        nd->uses |= vars_in(&s->vars, t, end, j, &full);
+        break;
+      }
+    }
+
+    if (compound && (nd->def >= 0)) {
+      nd->uses |= (uint64_T)1U << nd->def;
+    }
+  }
+
+  s->failed = s->failed || full;
+}
+
+static Block parse_block(Slicer *s, int_T depth);
+
+/* The chain starting with the "if" at s->pos */
+static void parse_if(Slicer *s, int_T idx, int_T depth)
+{
+  const char_T *t = s->t;
+  boolean_T full = false;
+  boolean_T is_else = false;
+  while (!s->failed) {
+    Node *nd = &s->node[idx];
+    const int_T b = nd->nbranches;
+    Block body;
+    if (b == MAX_BRANCHES) {
+      s->failed = true;
+      return;
+    }
+
+    if (!is_else) {
+      size_t close;
+      s->pos += 2U;
+      skip_space(s);
+      close = (s->pos < s->n) && (t[s->pos] == '(') ? match_paren(t, s->n,
+        s->pos) : 0U;
+      if (close == 0U) {
+        s->failed = true;
+        return;
+      }
+
+      nd->cond[b][0] = s->pos + 1U;
+      nd->cond[b][1] = close - 1U;
+      nd->uses |= vars_in(&s->vars, t, s->pos, close, &full);
+      s->failed = s->failed || full;
+      s->pos = close;
+      skip_space(s);
+    }
+
+    if ((s->pos >= s->n) || (t[s->pos] != '{')) {
+      s->failed = true;
+      return;
+    }
+
+    s->pos++;
+    body = parse_block(s, depth + 1);
+    if (s->failed || (s->pos >= s->n) || (t[s->pos] != '}')) {
+      s->failed = true;
+      return;
+    }
+
+    s->pos++;
+    nd = &s->node[idx];
+    nd->body[b] = body;
+    nd->nbranches++;
+    nd->has_else = is_else;
+    if (is_else) {
+      break;
+    } else {
+      const size_t after = s->pos;
+      skip_space(s);
+      if (!keyword(t, s->n, s->pos, "else")) {
+        s->pos = after;
+        break;
+      }
+
+      s->pos += 4U;
+      skip_space(s);
+      is_else = !keyword(t, s->n, s->pos, "if");
+    }
+  }
+
+  s->node[idx].end = s->pos;
+}
+
+/* Nodes up to the closing brace of the block, which is not consumed */
+static Block parse_block(Slicer *s, int_T depth)
+{
+  const char_T *t = s->t;
+  int_T local[MAX_BLOCK];
+  int_T m = 0;
+  Block b = { 0, 0 };
+  if (depth > MAX_DEPTH) {
+    s->failed = true;
+    return b;
+  }
+
+  while (!s->failed) {
+    int_T newlines = 0;
+    size_t line;
+    int_T idx;
+    Node *nd;
+    while ((s->pos < s->n) && is_space(t[s->pos])) {
+      newlines += (t[s->pos] == '\n') ? 1 : 0;
+      s->pos++;
+    }
+
+    if ((s->pos >= s->n) || (t[s->pos] == '}')) {
+      break;
+    }
+
+    line = s->pos;
+    while ((line > 0U) && (t[line - 1U] != '\n')) {
+      line--;
+    }
+
+    if ((strncmp(&t[s->pos], "/*", 2U) == 0) || (strncmp(&t[s->pos], "//", 2U)
+         == 0)) {
+      const char_T *close = (t[s->pos + 1U] == '*') ? strstr(&t[s->pos + 2U],
+        "*/") : strchr(&t[s->pos], '\n');
+      idx = new_node(s, COMMENT);
+      if ((idx < 0) || (close == NULL)) {
+        s->failed = true;
+        break;
+      }
+
+      nd = &s->node[idx];
+      nd->start = s->pos;
+      nd->end = (size_t)(close - t) + ((t[s->pos + 1U] == '*') ? 2U : 0U);
+      s->pos = nd->end;
+    } else if (keyword(t, s->n, s->pos, "if")) {
+      idx = new_node(s, IF);
+      if (idx < 0) {
+        break;
+      }
+
+      s->node[idx].start = s->pos;
+      parse_if(s, idx, depth);
+      nd = &s->node[idx];
+    } else {
+      size_t j = s->pos;
+      int_T paren = 0;
+      while ((j < s->n) && ((t[j] != ';') || (paren != 0))) {
+        if ((t[j] == '{') || (t[j] == '}')) {
+          break;
+        }
+
+        paren += (t[j] == '(') ? 1 : ((t[j] == ')') ? -1 : 0);
+        j++;
+      }
+
+      idx = new_node(s, STATEMENT);
+      if ((idx < 0) || (j >= s->n) || (t[j] != ';')) {
+        s->failed = true;
+        break;
+      }
+
+      nd = &s->node[idx];
+      nd->start = s->pos;
+      nd->end = j + 1U;
+      statement(s, nd);
+      s->pos = nd->end;
+    }
+
+    nd->line = line;
+    nd->blank = (newlines >= 2);
+    if (m == MAX_BLOCK) {
+      s->failed = true;
+      break;
+    }
+
+    local[m++] = idx;
+  }
+
+  if (s->failed || (s->nlist + m > MAX_LIST)) {
+    s->failed = true;
+    return b;
+  }
+
+  b.first = s->nlist;
+  b.n = m;
+  memcpy(&s->list[s->nlist], local, (size_t)m * sizeof(int_T));
+  s->nlist += m;
+  return b;
+}
+
+/* Backwards over b; true when something other than comments is kept */
+static boolean_T slice_block(Slicer *s, Block b, uint64_T *needed)
+{
+  boolean_T any = false;
+  int_T k;
+  for (k = b.n - 1; k >= 0; k--) {
+    Node *nd = &s->node[s->list[b.first + k]];
+    nd->keep = false;
+    if (nd->kind == STATEMENT) {
+      nd->keep = (nd->def < 0) || ((s->related[nd->def] & *needed) != 0U);
+      if (nd->keep) {
+        *needed |= nd->uses;
+      }
+    } else if (nd->kind == IF) {
+      uint64_T all = *needed;
+      int_T j;
+      for (j = 0; j < nd->nbranches; j++) {
+        uint64_T in = *needed;
+        if (slice_block(s, nd->body[j], &in)) {
+          nd->keep = true;
+        }
+
+        all |= in;
+      }
+
+      if (nd->keep) {
+        *needed = all | nd->uses;
+      }
+    }
+
+    any = any || nd->keep;
+  }
+
+  return any;
+}
+
+/* Variables read by the kept code of b */
+static uint64_T kept_reads(const Slicer *s, Block b)
+{
+  uint64_T mask = 0U;
+  int_T k;
+  for (k = 0; k < b.n; k++) {
+    const Node *nd = &s->node[s->list[b.first + k]];
+    int_T j;
+    if (!nd->keep) {
+      continue;
+    }
+
+    mask |= nd->uses;
+    for (j = 0; (nd->kind == IF) && (j < nd->nbranches); j++) {
+      mask |= kept_reads(s, nd->body[j]);
+    }
+  }
+
+  return mask;
+}
+
+/*
+ * Does comment k of b go with a kept statement?  Those before the first
+ * statement of a block and after its last, such as "Outputs for IfAction
+ * SubSystem" and its "End of", go with the block as a whole.
+ */
+static boolean_T comment_kept(const Slicer *s, Block b, int_T k)
+{
+  const Node *nd = &s->node[s->list[b.first + k]];
+  const int_T dir = (strncmp(&s->t[nd->start], "/* End of", 9U) == 0) ? -1 : 1;
+  boolean_T edge = true;
+  int_T i;
+  for (i = k + dir; (i >= 0) && (i < b.n); i += dir) {
+    const Node *other = &s->node[s->list[b.first + i]];
+    if (other->kind != COMMENT) {
+      if (other->keep) {
+        return true;
+      }
+
+      break;
+    }
+  }
+
+  for (i = k - dir; (i >= 0) && (i < b.n); i -= dir) {
+    edge = edge && (s->node[s->list[b.first + i]].kind == COMMENT);
+  }
+
+  for (i = 0; edge && (i < b.n); i++) {
+    if (s->node[s->list[b.first + i]].keep) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/* Append n bytes to *out; false when out of memory */
+static boolean_T append(char_T **out, size_t *len, size_t *cap, const char_T
+  *p, size_t n)
+{
+  if (*len + n + 1U > *cap) {
+    const size_t want = 2U * (*len + n + 1U);
+    char_T *grown = (char_T *)realloc(*out, want);
+    if (grown == NULL) {
+      return false;
+    }
+
+    *out = grown;
+    *cap = want;
+  }
+
+  memcpy(&(*out)[*len], p, n);
+  *len += n;
+  (*out)[*len] = '\0';
+  return true;
+}
+
+static boolean_T emit_block(const Slicer *s, Block b, char_T **out, size_t
+  *len, size_t *cap)
+{
+  const char_T *t = s->t;
+  boolean_T started = false;
+  boolean_T ok = true;
+  int_T k;
+  for (k = 0; ok && (k < b.n); k++) {
+    const Node *nd = &s->node[s->list[b.first + k]];
+    size_t indent = nd->start - nd->line;
+    size_t i;
+    if ((nd->kind == COMMENT) ? !comment_kept(s, b, k) : !nd->keep) {
+      continue;
+    }
+
+    for (i = nd->line; i < nd->start; i++) {
+      if (!is_space(t[i])) {
+        indent = 0U;
+      }
+    }
+
+    if (nd->blank && started) {
+      ok = append(out, len, cap, "\n", 1U);
+    }
+
+    started = true;
+    if (nd->kind != IF) {
+      ok = ok && append(out, len, cap, &t[nd->start - indent], nd->end -
+                        nd->start + indent) && append(out, len, cap, "\n", 1U);
+      continue;
+    }
+
+    for (i = 0U; ok && (i < (size_t)nd->nbranches); i++) {
+      const char_T *head = (i == 0U) ? "if (" : "} else if (";
+      ok = append(out, len, cap, &t[nd->start - indent], indent);
+      if (nd->has_else && (i + 1U == (size_t)nd->nbranches)) {
+        ok = ok && append(out, len, cap, "} else {\n", 9U);
+      } else {
+        ok = ok && append(out, len, cap, head, strlen(head)) && append(out, len,
+          cap, &t[nd->cond[i][0]], nd->cond[i][1] - nd->cond[i][0]) && append
+          (out, len, cap, ") {\n", 4U);
+      }
+
+      ok = ok && emit_block(s, nd->body[i], out, len, cap);
+    }
+
+    ok = ok && append(out, len, cap, &t[nd->start - indent], indent) && append
+      (out, len, cap, "}\n", 2U);
+  }
+
+  return ok;
+}
+
+/* The first 'quoted' block name of a comment, into list */
+static void add_name(const Slicer *s, const Node *comment, char_T *list)
+{
+  const char_T *open = (const char_T *)memchr(&s->t[comment->start], '\'',
+    comment->end - comment->start);
+  const char_T *close = (open != NULL) ? (const char_T *)memchr(open + 1, '\'',
+    (size_t)(&s->t[comment->end] - open - 1)) : NULL;
+  const size_t used = strlen(list);
+  if (close != NULL) {
+    (void)snprintf(&list[used], FSM_12B_SLICE_LIST - used, "%s%.*s", (used ==
+      0U) ? "" : " ", (int)(close - open - 1), open + 1);
+  }
+}
+
+/*
+ * Sort the blocks of b into kept and removed: the statements at the top
+ * of fsm_12B_step by their leading comment, the action subsystems of an if
+ * by their "Outputs for IfAction SubSystem" comment.  Also counts the
+ * assignments.
+ */
+static void report(const Slicer *s, Block b, boolean_T top,
+                   fsm_12B_SliceStats *stats)
+{
+  const Node *comment = NULL;
+  int_T k;
+  for (k = 0; k < b.n; k++) {
+    const Node *nd = &s->node[s->list[b.first + k]];
+    int_T j;
+    if (nd->kind == COMMENT) {
+      if ((comment == NULL) && (strncmp(&s->t[nd->start], "/* End of", 9U) !=
+           0)) {
+        comment = nd;
+      }
+
+      continue;
+    }
+
+    if (top && (comment != NULL)) {
+      add_name(s, comment, nd->keep ? stats->blocks_kept :
+               stats->blocks_removed);
+    }
+
+    comment = NULL;
+    if ((nd->kind == STATEMENT) && (nd->def >= 0)) {
+      stats->assignments++;
+      stats->kept += nd->keep ? 1 : 0;
+    }
+
+    for (j = 0; (nd->kind == IF) && (j < nd->nbranches); j++) {
+      const Block body = nd->body[j];
+      const Node *first = (body.n > 0) ? &s->node[s->list[body.first]] : NULL;
+      if ((first != NULL) && (first->kind == COMMENT) && (strncmp(&s->t
+            [first->start], "/* Outputs for IfAction SubSystem", 33U) == 0)) {
+        boolean_T live = false;
+        int_T i;
+        for (i = 0; i < body.n; i++) {
+          live = live || s->node[s->list[body.first + i]].keep;
+        }
+
+        add_name(s, first, live ? stats->blocks_kept : stats->blocks_removed);
+      }
+
+      report(s, body, false, stats);
+    }
+  }
+}
+
+/* Position of the "{" of the definition of fsm_12B_step, or 0 */
+static size_t find_step(const char_T *t, size_t n)
+{
+  const char_T *p = t;
+  while ((p = strstr(p, "fsm_12B_step(")) != NULL) {
+    size_t i = match_paren(t, n, (size_t)(p - t) + 12U);
+    if (i == 0U) {
+      return 0U;
+    }
+
+    while ((i < n) && is_space(t[i])) {
+      i++;
+    }
+
+    if ((i < n) && (t[i] == '{')) {
+      return i;
+    }
+
+    p += 13;
+  }
+
+  return 0U;
+}
+
+char_T *fsm_12B_slice(const char_T *text, size_t len, const
+                      fsm_12B_SliceVars *observed, boolean_T persistent, const
+                      char_T *banner, fsm_12B_SliceStats *stats, size_t *outlen)
+{
+  Slicer *s = (Slicer *)calloc(1U, sizeof(Slicer));
+  char_T *out = NULL;
+  size_t cap = 0U;
+  size_t n = 0U;
+  uint64_T criterion = 0U;
+  uint64_T state = 0U;
+  size_t open;
+  Block top = { 0, 0 };
+  boolean_T ok;
+  int_T i;
+  int_T j;
+  memset(stats, 0, sizeof(fsm_12B_SliceStats));
+  open = find_step(text, len);
+  if ((s == NULL) || (open == 0U)) {
+    free(s);
+    return NULL;
+  }
+
+  s->node = (Node *)malloc(MAX_NODES * sizeof(Node));
+  s->t = text;
+  s->n = len;
+  s->pos = open + 1U;
+  s->failed = (s->node == NULL);
+  if (!s->failed) {
+    top = parse_block(s, 0);
+  }
+
+  for (i = 0; !s->failed && (i < observed->n); i++) {
+    const int_T k = intern(&s->vars, observed->name[i]);
+    s->failed = (k < 0);
+    criterion |= s->failed ? 0U : ((uint64_T)1U << k);
+  }
+
+  if (s->failed || (s->pos >= len) || (text[s->pos] != '}')) {
+    free(s->node);
+    free(s);
+    return NULL;
+  }
+
+  for (i = 0; i < s->vars.n; i++) {
+    const size_t li = strlen(s->vars.name[i]);
+    if (strncmp(s->vars.name[i], "rtDW->", 6U) == 0) {
+      state |= (uint64_T)1U << i;
+    }
+
+    for (j = 0; j < s->vars.n; j++) {
+      const size_t lj = strlen(s->vars.name[j]);
+      const size_t l = (li < lj) ? li : lj;
+      if ((strncmp(s->vars.name[i], s->vars.name[j], l) == 0) && ((li == lj) ||
+           (s->vars.name[(li < lj) ? j : i][l] == '['))) {
+        s->related[i] |= (uint64_T)1U << j;
+      }
+    }
+  }
+
+  /* Persistent: what the kept code reads of DW is observed on the next tick */
+  for (;;) {
+    uint64_T needed = criterion;
+    uint64_T next;
+    (void)slice_block(s, top, &needed);
+    next = criterion | (kept_reads(s, top) & state);
+    if (!persistent || (next == criterion)) {
+      break;
+    }
+
+    criterion = next;
+  }
+
+  for (i = 0; i < s->vars.n; i++) {
+    if ((criterion & ((uint64_T)1U << i)) != 0U) {
+      const size_t used = strlen(stats->criterion);
+      (void)snprintf(&stats->criterion[used], FSM_12B_SLICE_LIST - used, "%s%s",
+                     (used == 0U) ? "" : " ", s->vars.name[i]);
+    }
+  }
+
+  report(s, top, true, stats);
+  ok = append(&out, &n, &cap, "", 0U);
+  if (banner != NULL) {
+    const char_T *p = banner;
+    ok = ok && append(&out, &n, &cap, "/*\n", 3U);
+    while (ok && (*p != '\0')) {
+      const char_T *nl = strchr(p, '\n');
+      const size_t l = (nl != NULL) ? (size_t)(nl - p) : strlen(p);
+      ok = append(&out, &n, &cap, (l == 0U) ? " *" : " * ", (l == 0U) ? 2U : 3U)
+        && append(&out, &n, &cap, p, l) && append(&out, &n, &cap, "\n", 1U);
+      p += l + ((nl != NULL) ? 1U : 0U);
+    }
+
+    ok = ok && append(&out, &n, &cap, " */\n\n", 5U);
+  }
+
+  ok = ok && append(&out, &n, &cap, text, open + 1U) && append(&out, &n, &cap,
+    "\n", 1U) && emit_block(s, top, &out, &n, &cap) && append(&out, &n, &cap,
+    &text[s->pos], len - s->pos);
+  free(s->node);
+  free(s);
+  if (!ok) {
+    free(out);
+    return NULL;
+  }
+
+  *outlen = n;
+  return out;
+}
+
+/*
+ * File trailer for fsm_12B_slice.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,75 @@
+/*
+ * File: fsm_12B_slice.h
+ *
+ * Cone-of-influence slicing of the generated fsm_12B_step.
+ *
+ * A requirement observes a few variables after the step: a field of DW or
+ * rtY_pullup.  The slicer reads the body of fsm_12B_step from the source
+ * text of fsm_12B.c, walks it backwards from those variables and keeps
+ * only the assignments that can reach them, together with the if
+ * conditions that guard the kept assignments and whatever those read.
+ * Everything else goes: the Sen chart when a requirement is about the
+ * Manager mode, the outport, the unit delay updates.  The generated
+ * comments of the kept statements stay, so the '<Sx>' names still trace
+ * the code back to the model.
+ *
+ * Variables are rtDW-><field>, rtDW-><field>[<n>], rtU_<name> and
+ * rtY_<name>; rtDW.<field> as written in a harness is the same variable.
+ * An element of Merge_p is a variable of its own, and Merge_p alone stands
+ * for all of its elements.  Assignments never kill a variable, so the
+ * slice is conservative: it keeps a superset of what a precise dependence
+ * analysis would.
+ *
+ * A single step only observes its own outputs.  A harness that runs the
+ * step several times (fsm_12B_unroll.h) also observes every state field
+ * the kept code reads on the next tick; persistent slicing adds those to
+ * the criterion until it no longer grows.
+ */
+
+#ifndef fsm_12B_slice_h_
+#define fsm_12B_slice_h_
+#include <stddef.h>
+#include "rtwtypes.h"
+
+#define FSM_12B_SLICE_MAX_VARS         64
+#define FSM_12B_SLICE_NAME             40
+#define FSM_12B_SLICE_LIST             2048
+
+/* A set of variables, in the form written in fsm_12B.c */
+typedef struct {
+  int_T n;
+  char_T name[FSM_12B_SLICE_MAX_VARS][FSM_12B_SLICE_NAME];
+} fsm_12B_SliceVars;
+
+typedef struct {
+  int_T assignments;                   /* in fsm_12B_step */
+  int_T kept;                          /* of them, in the slice */
+  char_T blocks_kept[FSM_12B_SLICE_LIST];/* '<Sx>/Name' ... */
+  char_T blocks_removed[FSM_12B_SLICE_LIST];
+  char_T criterion[FSM_12B_SLICE_LIST];/* the variables finally observed */
+} fsm_12B_SliceStats;
+
+/*
+ * Add the variables an expression mentions to v, as they would be written
+ * in fsm_12B.c ("rtDW.Merge_g == 2.0" adds rtDW->Merge_g).  Returns the
+ * number added, or -1 when v is full.
+ */
+extern int_T fsm_12B_slice_vars(fsm_12B_SliceVars *v, const char_T *expr);
+
+/*
+ * Malloc'ed copy of the source text of fsm_12B.c whose fsm_12B_step keeps
+ * only the cone of influence of observed.  banner, when not NULL, is put
+ * in a comment at the top.  Returns NULL when the step function cannot be
+ * parsed or a limit is exceeded.
+ */
+extern char_T *fsm_12B_slice(const char_T *text, size_t len, const
+  fsm_12B_SliceVars *observed, boolean_T persistent, const char_T *banner,
+  fsm_12B_SliceStats *stats, size_t *outlen);
+
+#endif                                 /* fsm_12B_slice_h_ */
+
+/*
+ * File trailer for fsm_12B_slice.h
+ *
+ * [EOF]
+ */
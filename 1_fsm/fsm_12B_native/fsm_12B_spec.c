@@ -0,0 +1,774 @@
+/*
+ * File: fsm_12B_spec.c
+ *
+ * Compiler from a declarative requirement file to ESBMC harnesses, native
+ * monitors and a table of expected verdicts.
+ */
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_spec.h"
+#include "rtwtypes.h"
+
+/* Bumped whenever the generated code changes, so that all of it is redone */
+#define FSM_12B_SPEC_VERSION           "fsm_12B spec 1"
+
+/* The interface of fsm_12B that bindings may name */
+static const char_T *const fsm_12B_spec_inputs[5] = { "rtU_standby",
+  "rtU_apfail", "rtU_supported", "rtU_limits", "OverrunFlag" };
+
+static const char_T *const fsm_12B_spec_fields[9] = { "Merge", "Merge_g",
+  "UnitDelay_DSTATE", "UnitDelay1_DSTATE", "Merge_p[0]", "Merge_p[1]",
+  "Merge_p[2]", "UnitDelay2_DSTATE", NULL };
+
+static const char_T *const fsm_12B_spec_timing_name[4] = { "immediately",
+  "next", "within", "for" };
+
+/* An expression being compiled */
+typedef struct {
+  const fsm_12B_Spec *s;
+  const char_T *p;
+  boolean_T post;                      /* after the step: the response */
+  char_T *error;
+  boolean_T failed;
+} fsm_12B_SpecExpr;
+
+static void fsm_12B_spec_fail(fsm_12B_SpecExpr *e, const char_T *fmt, ...)
+{
+  va_list ap;
+  if (e->failed) {
+    return;
+  }
+
+  e->failed = true;
+  va_start(ap, fmt);
+  (void)vsnprintf(e->error, FSM_12B_SPEC_TEXT, fmt, ap);
+  va_end(ap);
+}
+
+/* Skip blanks; is the next token op? */
+static boolean_T fsm_12B_spec_peek(fsm_12B_SpecExpr *e, const char_T *op)
+{
+  while (isspace((unsigned char)*e->p)) {
+    e->p++;
+  }
+
+  return strncmp(e->p, op, strlen(op)) == 0;
+}
+
+static boolean_T fsm_12B_spec_accept(fsm_12B_SpecExpr *e, const char_T *op)
+{
+  if (fsm_12B_spec_peek(e, op)) {
+    e->p += strlen(op);
+    return true;
+  }
+
+  return false;
+}
+
+/* out = fmt, failing on overflow */
+static void fsm_12B_spec_emit(fsm_12B_SpecExpr *e, char_T *out, const char_T
+  *fmt, ...)
+{
+  va_list ap;
+  int_T n;
+  va_start(ap, fmt);
+  n = vsnprintf(out, FSM_12B_SPEC_CODE, fmt, ap);
+  va_end(ap);
+  if ((n < 0) || (n >= FSM_12B_SPEC_CODE)) {
+    fsm_12B_spec_fail(e, "expression too long");
+  }
+}
+
+/* C for a binding, or an error */
+static void fsm_12B_spec_bind(fsm_12B_SpecExpr *e, const char_T *binding,
+  const char_T *name, char_T *out)
+{
+  int_T i;
+  for (i = 0; i < 5; i++) {
+    if (strcmp(binding, fsm_12B_spec_inputs[i]) == 0) {
+      fsm_12B_spec_emit(e, out, "rtIn->%s", binding);
+      return;
+    }
+  }
+
+  if (strcmp(binding, "rtY_pullup") == 0) {
+    if (!e->post) {
+      fsm_12B_spec_fail(e, "output %s has no value before the step", name);
+    }
+
+    fsm_12B_spec_emit(e, out, "rtY_pullup");
+    return;
+  }
+
+  if (strncmp(binding, "rtDW.", 5) == 0) {
+    for (i = 0; fsm_12B_spec_fields[i] != NULL; i++) {
+      if (strcmp(&binding[5], fsm_12B_spec_fields[i]) == 0) {
+        fsm_12B_spec_emit(e, out, "%s->%s", e->post ? "rtDW" : "pre",
+                          &binding[5]);
+        return;
+      }
+    }
+  }
+
+  fsm_12B_spec_fail(e, "%s is not an input, OverrunFlag, rtY_pullup or a "
+                    "scalar field rtDW.<field>", binding);
+}
+
+static void fsm_12B_spec_implies(fsm_12B_SpecExpr *e, char_T *out);
+
+static void fsm_12B_spec_primary(fsm_12B_SpecExpr *e, char_T *out)
+{
+  char_T name[FSM_12B_SPEC_ID];
+  size_t n = 0U;
+  int_T i;
+  out[0] = '\0';
+  if (fsm_12B_spec_accept(e, "(")) {
+    char_T inner[FSM_12B_SPEC_CODE];
+    fsm_12B_spec_implies(e, inner);
+    if (!fsm_12B_spec_accept(e, ")")) {
+      fsm_12B_spec_fail(e, "missing )");
+    }
+
+    fsm_12B_spec_emit(e, out, "(%s)", inner);
+    return;
+  }
+
+  (void)fsm_12B_spec_peek(e, "");
+  if (isdigit((unsigned char)*e->p) || (*e->p == '.')) {
+    char_T *end;
+    (void)strtod(e->p, &end);
+    fsm_12B_spec_emit(e, out, "%.*s", (int)(end - e->p), e->p);
+    e->p = end;
+    return;
+  }
+
+  /* A name or a binding such as rtDW.Merge_p[2] */
+  while ((isalnum((unsigned char)e->p[n]) || (e->p[n] == '_') || (e->p[n] ==
+           '.') || (e->p[n] == '[') || (e->p[n] == ']')) && (n + 1U < sizeof
+          (name))) {
+    name[n] = e->p[n];
+    n++;
+  }
+
+  name[n] = '\0';
+  if (n == 0U) {
+    fsm_12B_spec_fail(e, "expected a signal or a number at \"%.20s\"", e->p);
+    return;
+  }
+
+  e->p += n;
+  if ((strcmp(name, "true") == 0) || (strcmp(name, "false") == 0)) {
+    fsm_12B_spec_emit(e, out, "%s", name);
+    return;
+  }
+
+  for (i = 0; i < e->s->nsignals; i++) {
+    if (strcmp(name, e->s->signal[i].name) == 0) {
+      fsm_12B_spec_bind(e, e->s->signal[i].binding, name, out);
+      return;
+    }
+  }
+
+  fsm_12B_spec_bind(e, name, name, out);
+}
+
+static void fsm_12B_spec_unary(fsm_12B_SpecExpr *e, char_T *out)
+{
+  if (fsm_12B_spec_peek(e, "!=")) {
+    fsm_12B_spec_fail(e, "expected an operand before !=");
+  } else if (fsm_12B_spec_accept(e, "!")) {
+    char_T inner[FSM_12B_SPEC_CODE];
+    fsm_12B_spec_unary(e, inner);
+    fsm_12B_spec_emit(e, out, "!%s", inner);
+  } else {
+    fsm_12B_spec_primary(e, out);
+  }
+}
+
+static void fsm_12B_spec_compare(fsm_12B_SpecExpr *e, char_T *out)
+{
+  static const char_T *const ops[7][2] = { { "==", "==" }, { "!=", "!=" }, {
+      "<=", "<=" }, { ">=", ">=" }, { "<", "<" }, { ">", ">" }, { "=", "==" } };
+
+  char_T lhs[FSM_12B_SPEC_CODE];
+  int_T i;
+  fsm_12B_spec_unary(e, lhs);
+  for (i = 0; i < 7; i++) {
+    if (fsm_12B_spec_accept(e, ops[i][0])) {
+      char_T rhs[FSM_12B_SPEC_CODE];
+      fsm_12B_spec_unary(e, rhs);
+      fsm_12B_spec_emit(e, out, "(%s %s %s)", lhs, ops[i][1], rhs);
+      return;
+    }
+  }
+
+  fsm_12B_spec_emit(e, out, "%s", lhs);
+}
+
+static void fsm_12B_spec_and(fsm_12B_SpecExpr *e, char_T *out)
+{
+  fsm_12B_spec_compare(e, out);
+  while (!e->failed && (fsm_12B_spec_accept(e, "&&") || fsm_12B_spec_accept(e,
+           "&"))) {
+    char_T lhs[FSM_12B_SPEC_CODE];
+    char_T rhs[FSM_12B_SPEC_CODE];
+    (void)strcpy(lhs, out);
+    fsm_12B_spec_compare(e, rhs);
+    fsm_12B_spec_emit(e, out, "(%s && %s)", lhs, rhs);
+  }
+}
+
+static void fsm_12B_spec_or(fsm_12B_SpecExpr *e, char_T *out)
+{
+  fsm_12B_spec_and(e, out);
+  while (!e->failed && (fsm_12B_spec_accept(e, "||") || fsm_12B_spec_accept(e,
+           "|"))) {
+    char_T lhs[FSM_12B_SPEC_CODE];
+    char_T rhs[FSM_12B_SPEC_CODE];
+    (void)strcpy(lhs, out);
+    fsm_12B_spec_and(e, rhs);
+    fsm_12B_spec_emit(e, out, "(%s || %s)", lhs, rhs);
+  }
+}
+
+/* a -> b, right associative */
+static void fsm_12B_spec_implies(fsm_12B_SpecExpr *e, char_T *out)
+{
+  char_T lhs[FSM_12B_SPEC_CODE];
+  fsm_12B_spec_or(e, lhs);
+  if (!e->failed && fsm_12B_spec_accept(e, "->")) {
+    char_T rhs[FSM_12B_SPEC_CODE];
+    fsm_12B_spec_implies(e, rhs);
+    fsm_12B_spec_emit(e, out, "(!(%s) || %s)", lhs, rhs);
+  } else {
+    fsm_12B_spec_emit(e, out, "%s", lhs);
+  }
+}
+
+/* Compile src into out; 0 or -1 with the error in s->error */
+static int_T fsm_12B_spec_expr(fsm_12B_Spec *s, const char_T *src, boolean_T
+  post, char_T *out)
+{
+  fsm_12B_SpecExpr e;
+  char_T msg[FSM_12B_SPEC_TEXT];
+  e.s = s;
+  e.p = src;
+  e.post = post;
+  e.error = msg;
+  e.failed = false;
+  fsm_12B_spec_implies(&e, out);
+  (void)fsm_12B_spec_peek(&e, "");
+  if (!e.failed && (*e.p != '\0')) {
+    fsm_12B_spec_fail(&e, "unexpected \"%.20s\"", e.p);
+  }
+
+  if (e.failed) {
+    (void)strcpy(s->error, msg);
+    return -1;
+  }
+
+  return 0;
+}
+
+/* Copy at most size - 1 characters; false when src does not fit */
+static boolean_T fsm_12B_spec_copy(char_T *dst, const char_T *src, size_t size)
+{
+  const size_t n = strlen(src);
+  if (n >= size) {
+    return false;
+  }
+
+  memcpy(dst, src, n + 1U);
+  return true;
+}
+
+/* The inside of a "..." literal at p into dst; false when malformed */
+static boolean_T fsm_12B_spec_string(const char_T *p, char_T *dst, size_t size)
+{
+  size_t n = 0U;
+  if (*p != '"') {
+    return false;
+  }
+
+  for (p++; (*p != '\0') && (*p != '"'); p++) {
+    if ((*p == '\\') && (p[1] != '\0')) {
+      if (n + 2U >= size) {
+        return false;
+      }
+
+      dst[n++] = *p++;
+    }
+
+    if (n + 1U >= size) {
+      return false;
+    }
+
+    dst[n++] = *p;
+  }
+
+  dst[n] = '\0';
+  return (*p == '"') && (p[1] == '\0');
+}
+
+static boolean_T fsm_12B_spec_name(const char_T *p)
+{
+  if (*p == '\0') {
+    return false;
+  }
+
+  for (; *p != '\0'; p++) {
+    if (!isalnum((unsigned char)*p) && (*p != '_')) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* Compile the expressions of r and check it; 0 or -1 */
+static int_T fsm_12B_spec_finish(fsm_12B_Spec *s, fsm_12B_SpecReq *r)
+{
+  int_T i;
+  if (r->response[0] == '\0') {
+    (void)snprintf(s->error, FSM_12B_SPEC_TEXT, "no response");
+    return -1;
+  }
+
+  for (i = 0; i < s->nreqs - 1; i++) {
+    if (strcmp(s->req[i].id, r->id) == 0) {
+      (void)snprintf(s->error, FSM_12B_SPEC_TEXT, "defined twice, first on "
+                     "line %d", s->req[i].line);
+      return -1;
+    }
+  }
+
+  if (r->message[0] == '\0') {
+    (void)snprintf(r->message, sizeof(r->message), "Requirement %s violated",
+                   r->id);
+  }
+
+  if ((fsm_12B_spec_expr(s, (r->scope[0] != '\0') ? r->scope : "true", false,
+        r->scope_c) != 0) || (fsm_12B_spec_expr(s, (r->condition[0] != '\0') ?
+        r->condition : "true", false, r->condition_c) != 0) ||
+      (fsm_12B_spec_expr(s, r->response, true, r->response_c) != 0)) {
+    return -1;
+  }
+
+  return 0;
+}
+
+int_T fsm_12B_spec_parse(fsm_12B_Spec *s, const char_T *text, size_t len)
+{
+  fsm_12B_SpecReq *r = NULL;
+  size_t pos = 0U;
+  int_T line = 0;
+  memset(s, 0, sizeof(fsm_12B_Spec));
+  while (pos < len) {
+    char_T buf[FSM_12B_SPEC_TEXT + 64];
+    char_T word[32];
+    const char_T *arg;
+    size_t end = pos;
+    size_t n = 0U;
+    boolean_T quoted = false;
+    boolean_T ok = true;
+    line++;
+    while ((end < len) && (text[end] != '\n')) {
+      end++;
+    }
+
+    /* The line without its comment and surrounding blanks */
+    while ((pos < end) && isspace((unsigned char)text[pos])) {
+      pos++;
+    }
+
+    for (; (pos < end) && (quoted || (text[pos] != '#')); pos++) {
+      if (n + 1U >= sizeof(buf)) {
+        (void)snprintf(s->error, FSM_12B_SPEC_TEXT, "line %d: too long", line);
+        return -1;
+      }
+
+      if ((text[pos] == '\\') && quoted && (pos + 1U < end)) {
+        buf[n++] = text[pos++];
+      } else if (text[pos] == '"') {
+        quoted = !quoted;
+      }
+
+      buf[n++] = text[pos];
+    }
+
+    while ((n > 0U) && isspace((unsigned char)buf[n - 1U])) {
+      n--;
+    }
+
+    buf[n] = '\0';
+    pos = end + 1U;
+    if (n == 0U) {
+      continue;
+    }
+
+    /* Keyword and argument */
+    n = 0U;
+    while ((buf[n] != '\0') && !isspace((unsigned char)buf[n]) && (n + 1U <
+            sizeof(word))) {
+      word[n] = buf[n];
+      n++;
+    }
+
+    word[n] = '\0';
+    arg = &buf[n];
+    while (isspace((unsigned char)*arg)) {
+      arg++;
+    }
+
+    if (r == NULL) {
+      if (strcmp(word, "signal") == 0) {
+        fsm_12B_SpecSignal *sig = &s->signal[s->nsignals];
+        const char_T *eq = strchr(arg, '=');
+        const char_T *b = (eq != NULL) ? eq + 1 : "";
+        size_t k = (eq != NULL) ? (size_t)(eq - arg) : 0U;
+        while ((k > 0U) && isspace((unsigned char)arg[k - 1U])) {
+          k--;
+        }
+
+        while (isspace((unsigned char)*b)) {
+          b++;
+        }
+
+        ok = (s->nsignals < FSM_12B_SPEC_MAX_SIGNALS) && (k > 0U) && (k <
+          sizeof(sig->name)) && fsm_12B_spec_copy(sig->binding, b, sizeof
+          (sig->binding));
+        if (ok) {
+          memcpy(sig->name, arg, k);
+          sig->name[k] = '\0';
+          ok = fsm_12B_spec_name(sig->name);
+          s->nsignals++;
+        }
+      } else if (strcmp(word, "requirement") == 0) {
+        if (s->nreqs == s->cap) {
+          const int_T cap = 2 * s->cap + 16;
+          fsm_12B_SpecReq *grown = (fsm_12B_SpecReq *)realloc(s->req, (size_t)
+            cap * sizeof(fsm_12B_SpecReq));
+          if (grown == NULL) {
+            (void)snprintf(s->error, FSM_12B_SPEC_TEXT, "out of memory");
+            return -1;
+          }
+
+          s->req = grown;
+          s->cap = cap;
+        }
+
+        r = &s->req[s->nreqs++];
+        memset(r, 0, sizeof(fsm_12B_SpecReq));
+        r->line = line;
+        ok = fsm_12B_spec_name(arg) && fsm_12B_spec_copy(r->id, arg, sizeof
+          (r->id));
+      } else {
+        ok = false;
+      }
+    } else if (strcmp(word, "end") == 0) {
+      ok = (*arg == '\0');
+      if (ok && (fsm_12B_spec_finish(s, r) != 0)) {
+        char_T msg[FSM_12B_SPEC_TEXT];
+        (void)strcpy(msg, s->error);
+        (void)snprintf(s->error, FSM_12B_SPEC_TEXT, "line %d: requirement %s: "
+                       "%.400s", r->line, r->id, msg);
+        return -1;
+      }
+
+      r = NULL;
+    } else if (strcmp(word, "text") == 0) {
+      ok = fsm_12B_spec_string(arg, r->text, sizeof(r->text));
+    } else if (strcmp(word, "message") == 0) {
+      ok = fsm_12B_spec_string(arg, r->message, sizeof(r->message));
+    } else if (strcmp(word, "scope") == 0) {
+      if (strcmp(arg, "globally") == 0) {
+        r->scope[0] = '\0';
+      } else {
+        ok = (strncmp(arg, "in", 2) == 0) && isspace((unsigned char)arg[2]) &&
+          fsm_12B_spec_copy(r->scope, &arg[3], sizeof(r->scope));
+      }
+    } else if (strcmp(word, "condition") == 0) {
+      ok = fsm_12B_spec_copy(r->condition, arg, sizeof(r->condition));
+    } else if (strcmp(word, "response") == 0) {
+      ok = fsm_12B_spec_copy(r->response, arg, sizeof(r->response));
+    } else if (strcmp(word, "timing") == 0) {
+      char_T *rest;
+      ok = false;
+      r->n = 1;
+      if (strcmp(arg, "immediately") == 0) {
+        r->timing = FSM_12B_SPEC_IMMEDIATELY;
+        ok = true;
+      } else if (strcmp(arg, "next") == 0) {
+        r->timing = FSM_12B_SPEC_NEXT;
+        ok = true;
+      } else if ((strncmp(arg, "within ", 7) == 0) || (strncmp(arg, "for ", 4)
+                  == 0)) {
+        r->timing = (arg[0] == 'w') ? FSM_12B_SPEC_WITHIN : FSM_12B_SPEC_FOR;
+        r->n = (int_T)strtol(strchr(arg, ' '), &rest, 10);
+        while (isspace((unsigned char)*rest)) {
+          rest++;
+        }
+
+        if ((strncmp(rest, "ticks", 5) == 0) || (strncmp(rest, "tick", 4) == 0))
+        {
+          rest += (rest[4] == 's') ? 5 : 4;
+        }
+
+        ok = (*rest == '\0') && (r->n >= 1) && (r->n <= FSM_12B_SPEC_MAX_N);
+      }
+    } else if (strcmp(word, "expect") == 0) {
+      ok = ((strcmp(arg, "holds") == 0) || (strcmp(arg, "violated") == 0) ||
+            (strcmp(arg, "vacuous") == 0)) && fsm_12B_spec_copy(r->expect, arg,
+        sizeof(r->expect));
+    } else {
+      ok = false;
+    }
+
+    if (!ok) {
+      (void)snprintf(s->error, FSM_12B_SPEC_TEXT,
+                     "line %d: cannot read \"%.60s\"", line, buf);
+      return -1;
+    }
+  }
+
+  if (r != NULL) {
+    (void)snprintf(s->error, FSM_12B_SPEC_TEXT, "line %d: requirement %s has "
+                   "no end", r->line, r->id);
+    return -1;
+  }
+
+  return 0;
+}
+
+void fsm_12B_spec_free(fsm_12B_Spec *s)
+{
+  free(s->req);
+  s->req = NULL;
+  s->nreqs = 0;
+  s->cap = 0;
+}
+
+int_T fsm_12B_spec_ticks(const fsm_12B_SpecReq *r, int_T k)
+{
+  switch (r->timing) {
+   case FSM_12B_SPEC_NEXT:
+    return k + 1;
+
+   case FSM_12B_SPEC_WITHIN:
+   case FSM_12B_SPEC_FOR:
+    return k + r->n - 1;
+
+   default:
+    return k;
+  }
+}
+
+void fsm_12B_spec_hash(const fsm_12B_SpecReq *r, int_T ticks, const char_T
+  *source, char_T hex[FSM_12B_SHA256_HEX])
+{
+  const char_T *const fields[10] = { FSM_12B_SPEC_VERSION, source, r->id,
+    r->text, r->message, r->scope, r->condition, r->response, r->expect,
+    fsm_12B_spec_timing_name[r->timing] };
+
+  fsm_12B_Sha256 c;
+  uint8_T digest[FSM_12B_SHA256_BYTES];
+  int_T nums[2];
+  int_T i;
+  fsm_12B_sha256_init(&c);
+  for (i = 0; i < 10; i++) {
+    fsm_12B_sha256_field(&c, fields[i], strlen(fields[i]));
+  }
+
+  /* The compiled C depends on the bindings as well */
+  fsm_12B_sha256_field(&c, r->scope_c, strlen(r->scope_c));
+  fsm_12B_sha256_field(&c, r->condition_c, strlen(r->condition_c));
+  fsm_12B_sha256_field(&c, r->response_c, strlen(r->response_c));
+  nums[0] = r->n;
+  nums[1] = ticks;
+  fsm_12B_sha256_field(&c, nums, sizeof(nums));
+  fsm_12B_sha256_final(&c, digest);
+  fsm_12B_sha256_hex(digest, hex);
+}
+
+/* The FRET fields of r as a comment block */
+static void fsm_12B_spec_fields_comment(FILE *out, const fsm_12B_SpecReq *r)
+{
+  fprintf(out, " *   scope      %s%s\n", (r->scope[0] != '\0') ? "in " :
+          "globally", r->scope);
+  fprintf(out, " *   condition  %s\n", (r->condition[0] != '\0') ?
+          r->condition : "true");
+  if ((r->timing == FSM_12B_SPEC_WITHIN) || (r->timing == FSM_12B_SPEC_FOR)) {
+    fprintf(out, " *   timing     %s %d ticks\n",
+            fsm_12B_spec_timing_name[r->timing], r->n);
+  } else {
+    fprintf(out, " *   timing     %s\n", fsm_12B_spec_timing_name[r->timing]);
+  }
+
+  fprintf(out, " *   response   %s\n", r->response);
+}
+
+int_T fsm_12B_spec_monitor(FILE *out, const fsm_12B_SpecReq *r, const char_T
+  *source)
+{
+  /* Ticks after the trigger that the response is checked on */
+  const int_T lo = (r->timing == FSM_12B_SPEC_NEXT) ? 1 : 0;
+  const int_T hi = (r->timing == FSM_12B_SPEC_NEXT) ? 1 : (r->n - 1);
+  const uint64_T keep = (((uint64_T)1U << (hi + 1)) - 1U) & ~(uint64_T)1U;
+  fprintf(out, "/*\n * File: mon_%s.c\n *\n * Requirement %s: %s\n *\n", r->id,
+          r->id, r->text);
+  fsm_12B_spec_fields_comment(out, r);
+  fprintf(out, " *\n * Generated by spec from %s; do not edit.\n */\n\n"
+          "#include \"fsm_12B_mon.h\"\n\n", source);
+  fprintf(out, "boolean_T fsm_12B_mon_%s(fsm_12B_Monitor *m, const DW *pre, "
+          "const\n  fsm_12B_ReqInputs *rtIn, const DW *rtDW, boolean_T "
+          "rtY_pullup)\n{\n", r->id);
+  if (r->scope[0] != '\0') {
+    fprintf(out, "  const boolean_T trigger = %s &&\n    %s;\n", r->scope_c,
+            r->condition_c);
+  } else {
+    fprintf(out, "  const boolean_T trigger = %s;\n", r->condition_c);
+  }
+
+  fprintf(out, "  const boolean_T response = %s;\n", r->response_c);
+  fprintf(out, "  boolean_T ok = true;\n  (void)pre;\n  (void)rtIn;\n"
+          "  (void)rtDW;\n  (void)rtY_pullup;\n  m->ticks++;\n"
+          "  if (trigger) {\n    m->triggers++;\n    m->pending |= 1U;\n"
+          "  }\n\n");
+  switch (r->timing) {
+   case FSM_12B_SPEC_WITHIN:
+    fprintf(out, "  /* Within %d ticks: any response meets every "
+            "obligation */\n  if (response) {\n    m->pending = 0U;\n"
+            "  } else if ((m->pending & 0x%llXULL) != 0U) {\n    ok = false;\n"
+            "  }\n\n", r->n,
+            (unsigned long long)((uint64_T)1U << hi));
+    break;
+
+   case FSM_12B_SPEC_FOR:
+    fprintf(out, "  /* For %d ticks: every open obligation needs the response "
+            "*/\n  if (!response && (m->pending != 0U)) {\n    ok = false;\n"
+            "    m->pending = 0U;\n  }\n\n", r->n);
+    break;
+
+   default:
+    fprintf(out, "  /* %s */\n  if (!response && ((m->pending & 0x%llXULL) != "
+            "0U)) {\n    ok = false;\n  }\n\n", (lo == 0) ?
+            "Immediately: on the triggering tick" : "Next: on the tick after "
+            "the trigger", (unsigned long long)((uint64_T)1U << lo));
+    break;
+  }
+
+  if (keep == 0U) {
+    fprintf(out, "  m->pending = 0U;\n");
+  } else {
+    fprintf(out, "  m->pending = (m->pending << 1) & 0x%llXULL;\n",
+            (unsigned long long)keep);
+  }
+
+  fprintf(out, "  if (!ok) {\n    m->violations++;\n    if (m->first == 0U) {\n"
+          "      m->first = m->ticks;\n    }\n  }\n\n  return ok;\n}\n\n"
+          "/*\n * File trailer for mon_%s.c\n *\n * [EOF]\n */\n", r->id);
+  return ferror(out) ? -1 : 0;
+}
+
+int_T fsm_12B_spec_harness(FILE *out, const fsm_12B_SpecReq *r, int_T ticks,
+  const char_T *source)
+{
+  int_T t;
+  int_T i;
+  fprintf(out, "/*\n * File: req_%s.c\n *\n * ESBMC harness of requirement %s: "
+          "%s\n *\n", r->id, r->id, r->text);
+  fsm_12B_spec_fields_comment(out, r);
+  fprintf(out, " *\n * %d ticks from fsm_12B_initialize with fresh nondet "
+          "inputs each, checked\n * by the monitor of mon_%s.c:\n *\n"
+          " *   esbmc req_%s.c fsm_12B.c -I <model dir> -I <fsm_12B_native>\n"
+          " *\n * Generated by spec from %s; do not edit.\n */\n\n",
+          ticks, r->id, r->id, source);
+  fprintf(out, "#include \"mon_%s.c\"\n\n_Bool nondet_bool();\n\n"
+          "static RT_MODEL rtM_;\n"
+          "static DW rtDW;                        /* Observable states */\n"
+          "static fsm_12B_ReqInputs rtIn;\nstatic boolean_T rtY_pullup;\n"
+          "static fsm_12B_Monitor mon;\n\n"
+          "/* One rt_OneStep with fresh inputs */\n"
+          "static void tick(RT_MODEL *const rtM)\n{\n  DW pre;\n", r->id);
+  for (i = 0; i < 5; i++) {
+    fprintf(out, "  rtIn.%s = nondet_bool();\n", fsm_12B_spec_inputs[i]);
+  }
+
+  fprintf(out, "  if (rtIn.OverrunFlag) {\n    return;\n  }\n\n  pre = rtDW;\n"
+          "  fsm_12B_step(rtM, rtIn.rtU_standby, rtIn.rtU_apfail, "
+          "rtIn.rtU_supported,\n               rtIn.rtU_limits, &rtY_pullup);\n"
+          "  __ESBMC_assert(fsm_12B_mon_%s(&mon, &pre, &rtIn, &rtDW, "
+          "rtY_pullup),\n                 \"%s\");\n}\n\n", r->id, r->message);
+  fprintf(out, "int_T main(int_T argc, const char *argv[])\n{\n"
+          "  RT_MODEL *const rtM = &rtM_;\n  (void)(argc);\n  (void)(argv);\n"
+          "  rtM->dwork = &rtDW;\n  fsm_12B_initialize(rtM);\n");
+  for (t = 0; t < ticks; t++) {
+    fprintf(out, "  tick(rtM);\n");
+  }
+
+  fprintf(out, "  return 0;\n}\n\n/*\n * File trailer for req_%s.c\n *\n"
+          " * [EOF]\n */\n", r->id);
+  return ferror(out) ? -1 : 0;
+}
+
+int_T fsm_12B_spec_table(FILE *out, const fsm_12B_Spec *s, const char_T
+  *source)
+{
+  int_T i;
+  fprintf(out, "/*\n * File: monitors.c\n *\n * Table of the requirement "
+          "monitors of %s.\n *\n * Generated by spec; do not edit.\n */\n\n"
+          "#include \"fsm_12B_mon.h\"\n\n", source);
+  for (i = 0; i < s->nreqs; i++) {
+    fprintf(out, "extern boolean_T fsm_12B_mon_%s(fsm_12B_Monitor *m, const DW"
+            " *pre,\n  const fsm_12B_ReqInputs *rtIn, const DW *rtDW, "
+            "boolean_T rtY_pullup);\n", s->req[i].id);
+  }
+
+  fprintf(out, "\nconst fsm_12B_MonitorInfo fsm_12B_monitors[%d] = {\n",
+          (s->nreqs > 0) ? s->nreqs : 1);
+  for (i = 0; i < s->nreqs; i++) {
+    const fsm_12B_SpecReq *r = &s->req[i];
+    fprintf(out, "  { \"%s\", \"%s\",\n    \"%s\",\n    \"%s\", "
+            "fsm_12B_mon_%s }%s\n", r->id, r->text, r->message, r->expect,
+            r->id, (i + 1 < s->nreqs) ? "," : "");
+  }
+
+  if (s->nreqs == 0) {
+    fprintf(out, "  { \"\", \"\", \"\", \"\", NULL }\n");
+  }
+
+  fprintf(out, "};\n\nconst int_T fsm_12B_num_monitors = %d;\n\n/*\n"
+          " * File trailer for monitors.c\n *\n * [EOF]\n */\n", s->nreqs);
+  return ferror(out) ? -1 : 0;
+}
+
+int_T fsm_12B_spec_verdicts(FILE *out, const fsm_12B_Spec *s, int_T k, const
+  char_T *source)
+{
+  int_T i;
+  fprintf(out, "# Expected verdicts of the harnesses generated from %s\n"
+          "# (k = %d).  Generated by spec; do not edit.\n#\n"
+          "# id\texpect\tverdict\tticks\tharness\tmonitor\n", source, k);
+  for (i = 0; i < s->nreqs; i++) {
+    const fsm_12B_SpecReq *r = &s->req[i];
+    const char_T *verdict = "-";
+    if (r->expect[0] != '\0') {
+      verdict = (strcmp(r->expect, "violated") == 0) ? "FAIL" : "PASS";
+    }
+
+    fprintf(out, "%s\t%s\t%s\t%d\treq_%s.c\tfsm_12B_mon_%s\n", r->id,
+            (r->expect[0] != '\0') ? r->expect : "-", verdict,
+            fsm_12B_spec_ticks(r, k), r->id, r->id);
+  }
+
+  return ferror(out) ? -1 : 0;
+}
+
+/*
+ * File trailer for fsm_12B_spec.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,120 @@
+/*
+ * File: fsm_12B_spec.h
+ *
+ * Compiler from a declarative requirement file to ESBMC harnesses, native
+ * monitors (fsm_12B_mon.h) and a table of expected verdicts.
+ *
+ * A requirement file has one statement per line and # comments:
+ *
+ *   signal mode = rtDW.Merge
+ *   signal standby = rtU_standby
+ *
+ *   requirement 5
+ *     text "Change states from NOMINAL to STANDBY when in control"
+ *     message "Requirement 5 violated: Should change to STANDBY"
+ *     scope globally
+ *     condition mode == 1 & standby
+ *     timing immediately
+ *     response mode == 3
+ *     expect holds
+ *   end
+ *
+ * A signal binds a name to an input rtU_<name>, to OverrunFlag, to the
+ * output rtY_pullup or to a field rtDW.<field> of DW; the bindings can
+ * also be written directly in expressions.  The fields follow FRET:
+ * scope is "globally" or "in <expression>", condition and response are
+ * expressions, and timing is immediately, next, within N or for N (N up to
+ * 63).  Only the response is required; the condition defaults to true.
+ * Expressions have !, & (&&), | (||), -> (implies), the comparisons =
+ * (==), !=, <, <=, > and >=, parentheses, numbers, true and false.  The
+ * output has no value before the step, so it may not appear in scope or
+ * condition.  expect is the verdict the harness should get: holds,
+ * violated or vacuous (holds without ever triggering).
+ */
+
+#ifndef fsm_12B_spec_h_
+#define fsm_12B_spec_h_
+#include <stdio.h>
+#include "rtwtypes.h"
+#include "fsm_12B_sha256.h"
+
+#define FSM_12B_SPEC_ID                32
+#define FSM_12B_SPEC_TEXT              512
+#define FSM_12B_SPEC_CODE              2048
+#define FSM_12B_SPEC_MAX_SIGNALS       256
+#define FSM_12B_SPEC_MAX_N             63
+
+typedef enum {
+  FSM_12B_SPEC_IMMEDIATELY = 0,
+  FSM_12B_SPEC_NEXT,
+  FSM_12B_SPEC_WITHIN,
+  FSM_12B_SPEC_FOR
+} fsm_12B_SpecTiming;
+
+typedef struct {
+  char_T name[FSM_12B_SPEC_ID];
+  char_T binding[FSM_12B_SPEC_ID];
+} fsm_12B_SpecSignal;
+
+typedef struct {
+  char_T id[FSM_12B_SPEC_ID];          /* letters, digits and _ */
+  int_T line;
+  char_T text[FSM_12B_SPEC_TEXT];      /* inside the quotes, escapes kept */
+  char_T message[FSM_12B_SPEC_TEXT];
+  char_T scope[FSM_12B_SPEC_TEXT];     /* as written; empty for globally */
+  char_T condition[FSM_12B_SPEC_TEXT];
+  char_T response[FSM_12B_SPEC_TEXT];
+  char_T scope_c[FSM_12B_SPEC_CODE];   /* compiled to C */
+  char_T condition_c[FSM_12B_SPEC_CODE];
+  char_T response_c[FSM_12B_SPEC_CODE];
+  fsm_12B_SpecTiming timing;
+  int_T n;                             /* N of within and for */
+  char_T expect[16];
+} fsm_12B_SpecReq;
+
+typedef struct {
+  fsm_12B_SpecSignal signal[FSM_12B_SPEC_MAX_SIGNALS];
+  int_T nsignals;
+  fsm_12B_SpecReq *req;
+  int_T nreqs;
+  int_T cap;
+  char_T error[FSM_12B_SPEC_TEXT];     /* "line 12: ..." */
+} fsm_12B_Spec;
+
+/*
+ * Parse and compile a requirement file.  Returns 0, or -1 with the first
+ * error in s->error.  s is freed with fsm_12B_spec_free either way.
+ */
+extern int_T fsm_12B_spec_parse(fsm_12B_Spec *s, const char_T *text, size_t
+  len);
+extern void fsm_12B_spec_free(fsm_12B_Spec *s);
+
+/* Ticks of the harness of r: k triggering ticks and the rest of a window */
+extern int_T fsm_12B_spec_ticks(const fsm_12B_SpecReq *r, int_T k);
+
+/*
+ * Hash of everything the two files of r are generated from; a file whose
+ * hash is unchanged need not be written again.
+ */
+extern void fsm_12B_spec_hash(const fsm_12B_SpecReq *r, int_T ticks, const
+  char_T *source, char_T hex[FSM_12B_SHA256_HEX]);
+
+/* The files of one requirement: mon_<id>.c and req_<id>.c; 0 or -1 */
+extern int_T fsm_12B_spec_monitor(FILE *out, const fsm_12B_SpecReq *r, const
+  char_T *source);
+extern int_T fsm_12B_spec_harness(FILE *out, const fsm_12B_SpecReq *r, int_T
+  ticks, const char_T *source);
+
+/* The files of all requirements: monitors.c and verdicts.txt; 0 or -1 */
+extern int_T fsm_12B_spec_table(FILE *out, const fsm_12B_Spec *s, const
+  char_T *source);
+extern int_T fsm_12B_spec_verdicts(FILE *out, const fsm_12B_Spec *s, int_T k,
+  const char_T *source);
+
+#endif                                 /* fsm_12B_spec_h_ */
+
+/*
+ * File trailer for fsm_12B_spec.h
+ *
+ * [EOF]
+ */
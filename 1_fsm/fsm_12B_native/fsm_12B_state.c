@@ -0,0 +1,58 @@
+/*
+ * File: fsm_12B_state.c
+ *
+ * Identity of a DW of Simulink model 'fsm_12B'.
+ */
+
+#include <string.h>
+#include "fsm_12B_state.h"
+#include "rtwtypes.h"
+
+static uint64_T fsm_12B_fnv1a(uint64_T h, const void *p, size_t n)
+{
+  const uint8_T *b = (const uint8_T *)p;
+  size_t i;
+  for (i = 0; i < n; i++) {
+    h = (h ^ b[i]) * 1099511628211ULL;
+  }
+
+  return h;
+}
+
+uint64_T fsm_12B_dw_hash(const DW *rtDW)
+{
+  uint64_T h = 14695981039346656037ULL;
+  h = fsm_12B_fnv1a(h, &rtDW->Merge, sizeof(rtDW->Merge));
+  h = fsm_12B_fnv1a(h, &rtDW->Merge_g, sizeof(rtDW->Merge_g));
+  h = fsm_12B_fnv1a(h, &rtDW->UnitDelay_DSTATE, sizeof(rtDW->UnitDelay_DSTATE));
+  h = fsm_12B_fnv1a(h, &rtDW->UnitDelay1_DSTATE, sizeof
+                    (rtDW->UnitDelay1_DSTATE));
+  h = fsm_12B_fnv1a(h, rtDW->Merge_p, sizeof(rtDW->Merge_p));
+  h = fsm_12B_fnv1a(h, &rtDW->UnitDelay2_DSTATE, sizeof
+                    (rtDW->UnitDelay2_DSTATE));
+
+  /* Final avalanche so that the low bits depend on every input byte */
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+boolean_T fsm_12B_dw_equal(const DW *a, const DW *b)
+{
+  return (memcmp(&a->Merge, &b->Merge, sizeof(a->Merge)) == 0) && (memcmp
+    (&a->Merge_g, &b->Merge_g, sizeof(a->Merge_g)) == 0) && (memcmp
+    (&a->UnitDelay_DSTATE, &b->UnitDelay_DSTATE, sizeof(a->UnitDelay_DSTATE)) ==
+    0) && (memcmp(&a->UnitDelay1_DSTATE, &b->UnitDelay1_DSTATE, sizeof
+                  (a->UnitDelay1_DSTATE)) == 0) && (memcmp(a->Merge_p,
+    b->Merge_p, sizeof(a->Merge_p)) == 0) && (a->UnitDelay2_DSTATE ==
+    b->UnitDelay2_DSTATE);
+}
+
+/*
+ * File trailer for fsm_12B_state.c
+ *
+ * [EOF]
+ */
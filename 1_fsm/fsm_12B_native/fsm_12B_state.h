@@ -0,0 +1,26 @@
+/*
+ * File: fsm_12B_state.h
+ *
+ * Identity of a DW of Simulink model 'fsm_12B'.
+ *
+ * Two DW are the same state when every field has the same bit pattern;
+ * structure padding is ignored.  fsm_12B_dw_hash is consistent with that
+ * equality and well mixed in all 64 bits, so any number of low bits can
+ * be used to index a hash table.
+ */
+
+#ifndef fsm_12B_state_h_
+#define fsm_12B_state_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+
+extern uint64_T fsm_12B_dw_hash(const DW *rtDW);
+extern boolean_T fsm_12B_dw_equal(const DW *a, const DW *b);
+
+#endif                                 /* fsm_12B_state_h_ */
+
+/*
+ * File trailer for fsm_12B_state.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,901 @@
+/*
+ * File: fsm_12B_store.c
+ *
+ * SQLite result store and dependency tracking of fsm_12B_store.h.
+ */
+
+#define _XOPEN_SOURCE                  700  /* realpath */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sqlite3.h>
+#include "fsm_12B_sha256.h"
+#include "fsm_12B_slice.h"
+#include "fsm_12B_store.h"
+#include "fsm_12B_util.h"
+#include "fsm_12B_verify.h"
+#include "rtwtypes.h"
+
+#define MAX_PATH                       4096
+
+const char_T *const fsm_12B_store_status_name[4] = { "NEW", "CURRENT",
+  "UNAFFECTED", "STALE" };
+
+/* The variables of fsm_12B_step whose cones are kept for every model */
+static const char_T *const fsm_12B_store_fields[9] = { "rtDW->Merge",
+  "rtDW->Merge_g", "rtDW->UnitDelay_DSTATE", "rtDW->UnitDelay1_DSTATE",
+  "rtDW->Merge_p[0]", "rtDW->Merge_p[1]", "rtDW->Merge_p[2]",
+  "rtDW->UnitDelay2_DSTATE", "rtY_pullup" };
+
+static const char_T fsm_12B_store_schema[] =
+  "PRAGMA foreign_keys = ON;\n"
+  "CREATE TABLE IF NOT EXISTS model (\n"
+  "  hash TEXT PRIMARY KEY,\n"
+  "  added TEXT NOT NULL DEFAULT (strftime('%Y-%m-%dT%H:%M:%SZ', 'now')));\n"
+  "CREATE TABLE IF NOT EXISTS field (\n"
+  "  model_hash TEXT NOT NULL REFERENCES model (hash),\n"
+  "  name TEXT NOT NULL,\n"
+  "  cone_hash TEXT NOT NULL,\n"
+  "  PRIMARY KEY (model_hash, name));\n"
+  "CREATE TABLE IF NOT EXISTS subsystem (\n"
+  "  model_hash TEXT NOT NULL REFERENCES model (hash),\n"
+  "  name TEXT NOT NULL,\n"
+  "  hash TEXT NOT NULL,\n"
+  "  PRIMARY KEY (model_hash, name));\n"
+  "CREATE TABLE IF NOT EXISTS run (\n"
+  "  id INTEGER PRIMARY KEY,\n"
+  "  started TEXT NOT NULL DEFAULT (strftime('%Y-%m-%dT%H:%M:%SZ', 'now')),\n"
+  "  harness TEXT NOT NULL,\n"
+  "  requirement TEXT NOT NULL,\n"
+  "  harness_hash TEXT NOT NULL,\n"
+  "  model_hash TEXT NOT NULL,\n"
+  "  cone_hash TEXT NOT NULL,\n"
+  "  tool_version TEXT NOT NULL,\n"
+  "  options TEXT NOT NULL,\n"
+  "  verdict TEXT NOT NULL,\n"
+  "  seconds REAL NOT NULL,\n"
+  "  peak_kib INTEGER NOT NULL,\n"
+  "  counterexample TEXT);\n"
+  "CREATE INDEX IF NOT EXISTS run_requirement ON run (harness, requirement,\n"
+  "  id);\n"
+  "CREATE TABLE IF NOT EXISTS dependency (\n"
+  "  run INTEGER NOT NULL REFERENCES run (id) ON DELETE CASCADE,\n"
+  "  kind TEXT NOT NULL,                 -- field or block\n"
+  "  name TEXT NOT NULL,\n"
+  "  PRIMARY KEY (run, kind, name));\n";
+
+/*=========*
+ * Hashing *
+ *=========*/
+
+/*
+ * Feed the tokens of C text to c: comments dropped, every run of white
+ * space one blank, so that only changes to the code change the hash.
+ */
+static void hash_code(fsm_12B_Sha256 *c, const char_T *t, size_t n)
+{
+  char_T buf[4096];
+  size_t used = 0U;
+  boolean_T blank = false;
+  size_t i = 0U;
+  while (i < n) {
+    char_T ch = t[i];
+    if ((ch == '/') && (i + 1U < n) && (t[i + 1U] == '*')) {
+      i += 2U;
+      while ((i + 1U < n) && !((t[i] == '*') && (t[i + 1U] == '/'))) {
+        i++;
+      }
+
+      i = (i + 2U < n) ? i + 2U : n;
+      blank = true;
+      continue;
+    }
+
+    if ((ch == '/') && (i + 1U < n) && (t[i + 1U] == '/')) {
+      while ((i < n) && (t[i] != '\n')) {
+        i++;
+      }
+
+      blank = true;
+      continue;
+    }
+
+    if ((ch == ' ') || (ch == '\t') || (ch == '\n') || (ch == '\r') || (ch ==
+         '\f') || (ch == '\v')) {
+      i++;
+      blank = true;
+      continue;
+    }
+
+    if (used + 2U > sizeof(buf)) {
+      fsm_12B_sha256_update(c, buf, used);
+      used = 0U;
+    }
+
+    if (blank) {
+      buf[used++] = ' ';
+      blank = false;
+    }
+
+    buf[used++] = ch;
+    i++;
+  }
+
+  fsm_12B_sha256_update(c, buf, used);
+}
+
+/* Cone of the variables of v in m; 0 or -1 */
+static int_T cone_of(const fsm_12B_StoreModel *m, const fsm_12B_SliceVars *v,
+                     boolean_T persistent, fsm_12B_SliceStats *stats, char_T
+                     hex[FSM_12B_SHA256_HEX])
+{
+  fsm_12B_Sha256 c;
+  uint8_T digest[FSM_12B_SHA256_BYTES];
+  size_t outlen;
+  char_T *out = fsm_12B_slice(m->text, m->len, v, persistent, NULL, stats,
+    &outlen);
+  if (out == NULL) {
+    return -1;
+  }
+
+  fsm_12B_sha256_init(&c);
+  fsm_12B_sha256_field(&c, m->headers, strlen(m->headers));
+  hash_code(&c, out, outlen);
+  fsm_12B_sha256_final(&c, digest);
+  fsm_12B_sha256_hex(digest, hex);
+  free(out);
+  return 0;
+}
+
+int_T fsm_12B_store_load(fsm_12B_StoreModel *m, const char_T *dir)
+{
+  static const char_T *const header[2] = { "fsm_12B.h", "rtwtypes.h" };
+
+  fsm_12B_Sha256 all;
+  fsm_12B_Sha256 headers;
+  uint8_T digest[FSM_12B_SHA256_BYTES];
+  char_T path[MAX_PATH + 16];
+  int_T i;
+  memset(m, 0, sizeof(fsm_12B_StoreModel));
+  (void)snprintf(path, sizeof(path), "%s/fsm_12B.c", dir);
+  m->text = fsm_12B_slurp(path, &m->len);
+  if (m->text == NULL) {
+    return -1;
+  }
+
+  /* fsm_12B.c, fsm_12B.h and rtwtypes.h, as in the cache key of verify */
+  fsm_12B_sha256_init(&all);
+  fsm_12B_sha256_init(&headers);
+  fsm_12B_sha256_field(&all, m->text, m->len);
+  for (i = 0; i < 2; i++) {
+    size_t len;
+    char_T *src;
+    (void)snprintf(path, sizeof(path), "%s/%s", dir, header[i]);
+    src = fsm_12B_slurp(path, &len);
+    if (src == NULL) {
+      fsm_12B_store_unload(m);
+      return -1;
+    }
+
+    fsm_12B_sha256_field(&all, src, len);
+    fsm_12B_sha256_field(&headers, src, len);
+    free(src);
+  }
+
+  fsm_12B_sha256_final(&all, digest);
+  fsm_12B_sha256_hex(digest, m->hash);
+  fsm_12B_sha256_final(&headers, digest);
+  fsm_12B_sha256_hex(digest, m->headers);
+  return 0;
+}
+
+void fsm_12B_store_unload(fsm_12B_StoreModel *m)
+{
+  free(m->text);
+  m->text = NULL;
+  m->len = 0U;
+}
+
+/* Condition of the first __ESBMC_assert in text, malloc'ed, or NULL */
+static char_T *assertion(const char_T *text, size_t len)
+{
+  static const char_T call[] = "__ESBMC_assert";
+  const char_T *p = text;
+  const char_T *end = &text[len];
+  const char_T *start;
+  int_T depth = 0;
+  char_T *cond;
+  while ((p = (const char_T *)memchr(p, '_', (size_t)(end - p))) != NULL) {
+    if (((size_t)(end - p) > sizeof(call)) && (strncmp(p, call, sizeof(call)
+          - 1U) == 0)) {
+      break;
+    }
+
+    p++;
+  }
+
+  if (p == NULL) {
+    return NULL;
+  }
+
+  p += sizeof(call) - 1U;
+  while ((p < end) && (*p != '(')) {
+    p++;
+  }
+
+  start = ++p;
+  for (; p < end; p++) {
+    if ((*p == '(') || (*p == '[')) {
+      depth++;
+    } else if ((*p == ')') || (*p == ']')) {
+      if (depth == 0) {
+        break;
+      }
+
+      depth--;
+    } else if ((*p == ',') && (depth == 0)) {
+      break;
+    }
+  }
+
+  if (p >= end) {
+    return NULL;
+  }
+
+  cond = (char_T *)malloc((size_t)(p - start) + 1U);
+  if (cond != NULL) {
+    memcpy(cond, start, (size_t)(p - start));
+    cond[p - start] = '\0';
+  }
+
+  return cond;
+}
+
+int_T fsm_12B_store_cone(const fsm_12B_StoreModel *m, const char_T *text,
+  size_t len, boolean_T persistent, fsm_12B_StoreCone *c)
+{
+  fsm_12B_SliceVars observed;
+  fsm_12B_SliceStats stats;
+  char_T *cond = assertion(text, len);
+  int_T n;
+  memset(c, 0, sizeof(fsm_12B_StoreCone));
+  if (cond == NULL) {
+    return -1;
+  }
+
+  observed.n = 0;
+  n = fsm_12B_slice_vars(&observed, cond);
+  free(cond);
+  if ((n <= 0) || (cone_of(m, &observed, persistent, &stats, c->hash) != 0)) {
+    return -1;
+  }
+
+  /* What the slice finally observed, persistence included */
+  (void)fsm_12B_slice_vars(&c->fields, stats.criterion);
+  (void)snprintf(c->blocks, sizeof(c->blocks), "%s", stats.blocks_kept);
+  return 0;
+}
+
+/*========*
+ * SQLite *
+ *========*/
+static int_T fail(fsm_12B_Store *s, const char_T *what)
+{
+  (void)snprintf(s->error, sizeof(s->error), "%s: %s", what, sqlite3_errmsg
+                 (s->db));
+  return -1;
+}
+
+static sqlite3_stmt *prepare(fsm_12B_Store *s, const char_T *sql)
+{
+  sqlite3_stmt *st = NULL;
+  if (sqlite3_prepare_v2(s->db, sql, -1, &st, NULL) != SQLITE_OK) {
+    (void)fail(s, "prepare");
+    return NULL;
+  }
+
+  return st;
+}
+
+static void bind_text(sqlite3_stmt *st, int_T i, const char_T *text)
+{
+  (void)sqlite3_bind_text(st, i, text, -1, SQLITE_TRANSIENT);
+}
+
+/*
+ * A harness path as the key of its runs: the canonical path, so that
+ * ert_main.c, ./ert_main.c and a symlink find the same runs, or the path
+ * as given when it does not resolve (a harness since deleted).
+ */
+static void bind_harness(sqlite3_stmt *st, int_T i, const char_T *path)
+{
+  char_T *real = realpath(path, NULL);
+  bind_text(st, i, (real != NULL) ? real : path);
+  free(real);
+}
+
+/* Next block name of a slice list such as "<S4>/If <S1>/Unit Delay" */
+static const char_T *next_block(const char_T *p, char_T *name, size_t size)
+{
+  const char_T *end;
+  size_t n;
+  while (*p == ' ') {
+    p++;
+  }
+
+  if (*p == '\0') {
+    return NULL;
+  }
+
+  end = strstr(p + 1, " <");
+  n = (end != NULL) ? (size_t)(end - p) : strlen(p);
+  if (n >= size) {
+    n = size - 1U;
+  }
+
+  memcpy(name, p, n);
+  name[n] = '\0';
+  return p + n;
+}
+
+int_T fsm_12B_store_open(fsm_12B_Store *s, const char_T *path)
+{
+  char_T *msg = NULL;
+  s->error[0] = '\0';
+  if (sqlite3_open(path, &s->db) != SQLITE_OK) {
+    (void)fail(s, path);
+    fsm_12B_store_close(s);
+    return -1;
+  }
+
+  (void)sqlite3_busy_timeout(s->db, 10000);
+  if (sqlite3_exec(s->db, fsm_12B_store_schema, NULL, NULL, &msg) !=
+      SQLITE_OK) {
+    (void)snprintf(s->error, sizeof(s->error), "%s: %s", path, (msg != NULL)
+                   ? msg : "cannot create the schema");
+    sqlite3_free(msg);
+    fsm_12B_store_close(s);
+    return -1;
+  }
+
+  return 0;
+}
+
+void fsm_12B_store_close(fsm_12B_Store *s)
+{
+  if (s->db != NULL) {
+    (void)sqlite3_close(s->db);
+    s->db = NULL;
+  }
+}
+
+/*
+ * Digest of every subsystem of the model: the code between "Outputs for
+ * ... SubSystem: '<name>'" and "End of Outputs for SubSystem: '<name>'",
+ * inserted for model m.  0 or -1.
+ */
+static int_T add_subsystems(fsm_12B_Store *s, const fsm_12B_StoreModel *m,
+  sqlite3_stmt *st)
+{
+  static const char_T start_tag[] = "Outputs for ";
+  static const char_T end_tag[] = "End of Outputs for SubSystem: '";
+  const char_T *p = m->text;
+  int_T rc = 0;
+  while ((rc == 0) && ((p = strstr(p, start_tag)) != NULL)) {
+    char_T name[FSM_12B_SLICE_NAME * 2];
+    char_T end_mark[sizeof(name) + sizeof(end_tag) + 2U];
+    const char_T *q;
+    const char_T *close;
+    const char_T *body;
+    const char_T *stop;
+    fsm_12B_Sha256 c;
+    uint8_T digest[FSM_12B_SHA256_BYTES];
+    char_T hex[FSM_12B_SHA256_HEX];
+    if ((p > m->text + 3) && (strncmp(p - 3, "of ", 3) == 0)) {
+      p += sizeof(start_tag) - 1U;
+      continue;                        /* an End of */
+    }
+
+    q = strstr(p, "SubSystem: '");
+    body = strstr(p, "*/");
+    if ((q == NULL) || (body == NULL) || (q > body)) {
+      p += sizeof(start_tag) - 1U;
+      continue;
+    }
+
+    q += 12;
+    close = strchr(q, '\'');
+    if ((close == NULL) || ((size_t)(close - q) >= sizeof(name))) {
+      p = body;
+      continue;
+    }
+
+    memcpy(name, q, (size_t)(close - q));
+    name[close - q] = '\0';
+    (void)snprintf(end_mark, sizeof(end_mark), "%s%s'", end_tag, name);
+    stop = strstr(body, end_mark);
+    if (stop == NULL) {
+      p = body;
+      continue;
+    }
+
+    fsm_12B_sha256_init(&c);
+    hash_code(&c, body + 2, (size_t)(stop - body - 2));
+    fsm_12B_sha256_final(&c, digest);
+    fsm_12B_sha256_hex(digest, hex);
+    (void)sqlite3_reset(st);
+    bind_text(st, 1, m->hash);
+    bind_text(st, 2, name);
+    bind_text(st, 3, hex);
+    if (sqlite3_step(st) != SQLITE_DONE) {
+      rc = fail(s, "subsystem");
+    }
+
+    p = body;
+  }
+
+  return rc;
+}
+
+int_T fsm_12B_store_add_model(fsm_12B_Store *s, const fsm_12B_StoreModel *m)
+{
+  sqlite3_stmt *st;
+  int_T rc = 0;
+  int_T i;
+  st = prepare(s, "INSERT OR IGNORE INTO model (hash) VALUES (?1)");
+  if (st == NULL) {
+    return -1;
+  }
+
+  bind_text(st, 1, m->hash);
+  if (sqlite3_step(st) != SQLITE_DONE) {
+    rc = fail(s, "model");
+  }
+
+  (void)sqlite3_finalize(st);
+  if ((rc != 0) || (sqlite3_changes(s->db) == 0)) {
+    return rc;                         /* known already */
+  }
+
+  (void)sqlite3_exec(s->db, "BEGIN", NULL, NULL, NULL);
+  st = prepare(s, "INSERT OR REPLACE INTO field (model_hash, name, cone_hash) "
+               "VALUES (?1, ?2, ?3)");
+  for (i = 0; (st != NULL) && (rc == 0) && (i < 9); i++) {
+    fsm_12B_SliceVars v;
+    fsm_12B_SliceStats stats;
+    char_T hex[FSM_12B_SHA256_HEX];
+    v.n = 0;
+    (void)fsm_12B_slice_vars(&v, fsm_12B_store_fields[i]);
+    if (cone_of(m, &v, false, &stats, hex) != 0) {
+      (void)snprintf(s->error, sizeof(s->error), "cannot slice fsm_12B_step");
+      rc = -1;
+      break;
+    }
+
+    (void)sqlite3_reset(st);
+    bind_text(st, 1, m->hash);
+    bind_text(st, 2, fsm_12B_store_fields[i]);
+    bind_text(st, 3, hex);
+    if (sqlite3_step(st) != SQLITE_DONE) {
+      rc = fail(s, "field");
+    }
+  }
+
+  (void)sqlite3_finalize(st);
+  st = (rc == 0) ? prepare(s, "INSERT OR REPLACE INTO subsystem (model_hash, "
+    "name, hash) VALUES (?1, ?2, ?3)") : NULL;
+  if (st == NULL) {
+    rc = -1;
+  } else {
+    rc = add_subsystems(s, m, st);
+    (void)sqlite3_finalize(st);
+  }
+
+  /* A model without its cones would never be completed: roll it back */
+  if (rc != 0) {
+    (void)sqlite3_exec(s->db, "ROLLBACK", NULL, NULL, NULL);
+    st = prepare(s, "DELETE FROM model WHERE hash = ?1");
+    if (st != NULL) {
+      bind_text(st, 1, m->hash);
+      (void)sqlite3_step(st);
+      (void)sqlite3_finalize(st);
+    }
+
+    return -1;
+  }
+
+  return (sqlite3_exec(s->db, "COMMIT", NULL, NULL, NULL) == SQLITE_OK) ? 0 :
+    fail(s, "commit");
+}
+
+int_T fsm_12B_store_add_run(fsm_12B_Store *s, const fsm_12B_StoreRun *run)
+{
+  sqlite3_stmt *st;
+  const char_T *p;
+  char_T name[FSM_12B_SLICE_LIST];
+  sqlite3_int64 id;
+  int_T rc = 0;
+  int_T i;
+  (void)sqlite3_exec(s->db, "BEGIN", NULL, NULL, NULL);
+  st = prepare(s, "INSERT INTO run (harness, requirement, harness_hash, "
+               "model_hash, cone_hash, tool_version, options, verdict, "
+               "seconds, peak_kib, counterexample) VALUES (?1, ?2, ?3, ?4, "
+               "?5, ?6, ?7, ?8, ?9, ?10, ?11)");
+  if (st == NULL) {
+    (void)sqlite3_exec(s->db, "ROLLBACK", NULL, NULL, NULL);
+    return -1;
+  }
+
+  bind_harness(st, 1, run->harness);
+  bind_text(st, 2, run->requirement);
+  bind_text(st, 3, run->harness_hash);
+  bind_text(st, 4, run->model_hash);
+  bind_text(st, 5, run->cone->hash);
+  bind_text(st, 6, run->tool_version);
+  bind_text(st, 7, run->options);
+  bind_text(st, 8, fsm_12B_verify_verdict_name[run->verdict]);
+  (void)sqlite3_bind_double(st, 9, run->seconds);
+  (void)sqlite3_bind_int64(st, 10, (sqlite3_int64)run->peak_kib);
+  if (run->counterexample != NULL) {
+    bind_text(st, 11, run->counterexample);
+  } else {
+    (void)sqlite3_bind_null(st, 11);
+  }
+
+  if (sqlite3_step(st) != SQLITE_DONE) {
+    rc = fail(s, "run");
+  }
+
+  (void)sqlite3_finalize(st);
+  id = sqlite3_last_insert_rowid(s->db);
+  st = (rc == 0) ? prepare(s, "INSERT OR IGNORE INTO dependency (run, kind, "
+    "name) VALUES (?1, ?2, ?3)") : NULL;
+  if (st == NULL) {
+    rc = -1;
+  }
+
+  for (i = 0; (rc == 0) && (i < run->cone->fields.n); i++) {
+    (void)sqlite3_reset(st);
+    (void)sqlite3_bind_int64(st, 1, id);
+    bind_text(st, 2, "field");
+    bind_text(st, 3, run->cone->fields.name[i]);
+    if (sqlite3_step(st) != SQLITE_DONE) {
+      rc = fail(s, "dependency");
+    }
+  }
+
+  p = run->cone->blocks;
+  while ((rc == 0) && ((p = next_block(p, name, sizeof(name))) != NULL)) {
+    (void)sqlite3_reset(st);
+    (void)sqlite3_bind_int64(st, 1, id);
+    bind_text(st, 2, "block");
+    bind_text(st, 3, name);
+    if (sqlite3_step(st) != SQLITE_DONE) {
+      rc = fail(s, "dependency");
+    }
+  }
+
+  (void)sqlite3_finalize(st);
+  if (rc != 0) {
+    (void)sqlite3_exec(s->db, "ROLLBACK", NULL, NULL, NULL);
+    return -1;
+  }
+
+  return (sqlite3_exec(s->db, "COMMIT", NULL, NULL, NULL) == SQLITE_OK) ? 0 :
+    fail(s, "commit");
+}
+
+/* Append "label name" to why, the label only before the first name */
+static void add_why(char_T *why, const char_T *label, boolean_T *first, const
+                    char_T *name)
+{
+  const size_t used = strlen(why);
+  (void)snprintf(&why[used], FSM_12B_STORE_TEXT - used, "%s%s%s", *first ?
+                 ((used > 0U) ? "; " : "") : ", ", *first ? label : "", name);
+  *first = false;
+}
+
+int_T fsm_12B_store_check(fsm_12B_Store *s, const fsm_12B_StoreModel *m,
+  const fsm_12B_StoreRun *run, fsm_12B_StoreCheck *c)
+{
+  sqlite3_stmt *st;
+  char_T harness_hash[FSM_12B_SHA256_HEX];
+  char_T model_hash[FSM_12B_SHA256_HEX];
+  char_T cone_hash[FSM_12B_SHA256_HEX];
+  char_T name[FSM_12B_SLICE_LIST];
+  const char_T *p;
+  boolean_T same_verifier;
+  boolean_T first;
+  int_T i;
+  int_T rc;
+  memset(c, 0, sizeof(fsm_12B_StoreCheck));
+  st = prepare(s, "SELECT id, started, harness_hash, model_hash, cone_hash, "
+               "tool_version = ?3 AND options = ?4, verdict, seconds FROM run "
+               "WHERE harness = ?1 AND requirement = ?2 AND verdict IN "
+               "('PASS', 'FAIL') ORDER BY id DESC LIMIT 1");
+  if (st == NULL) {
+    return -1;
+  }
+
+  bind_harness(st, 1, run->harness);
+  bind_text(st, 2, run->requirement);
+  bind_text(st, 3, run->tool_version);
+  bind_text(st, 4, run->options);
+  rc = sqlite3_step(st);
+  if (rc != SQLITE_ROW) {
+    (void)sqlite3_finalize(st);
+    c->status = FSM_12B_STORE_NEW;
+    return (rc == SQLITE_DONE) ? 0 : fail(s, "run");
+  }
+
+  c->run = (int64_T)sqlite3_column_int64(st, 0);
+  (void)snprintf(c->started, sizeof(c->started), "%s", (const char_T *)
+                 sqlite3_column_text(st, 1));
+  (void)snprintf(harness_hash, sizeof(harness_hash), "%s", (const char_T *)
+                 sqlite3_column_text(st, 2));
+  (void)snprintf(model_hash, sizeof(model_hash), "%s", (const char_T *)
+                 sqlite3_column_text(st, 3));
+  (void)snprintf(cone_hash, sizeof(cone_hash), "%s", (const char_T *)
+                 sqlite3_column_text(st, 4));
+  same_verifier = sqlite3_column_int(st, 5) != 0;
+  c->verdict = (strcmp((const char_T *)sqlite3_column_text(st, 6), "PASS") ==
+                0) ? FSM_12B_VERIFY_PASS : FSM_12B_VERIFY_FAIL;
+  c->seconds = sqlite3_column_double(st, 7);
+  (void)sqlite3_finalize(st);
+  if (strcmp(harness_hash, run->harness_hash) != 0) {
+    c->status = FSM_12B_STORE_STALE;
+    (void)snprintf(c->why, sizeof(c->why), "harness changed");
+    return 0;
+  }
+
+  if (!same_verifier) {
+    c->status = FSM_12B_STORE_STALE;
+    (void)snprintf(c->why, sizeof(c->why), "verifier changed");
+    return 0;
+  }
+
+  if (strcmp(model_hash, m->hash) == 0) {
+    c->status = FSM_12B_STORE_CURRENT;
+    return 0;
+  }
+
+  if (strcmp(cone_hash, run->cone->hash) == 0) {
+    c->status = FSM_12B_STORE_UNAFFECTED;
+    return 0;
+  }
+
+  /* Stale: which of its fields and subsystems changed */
+  c->status = FSM_12B_STORE_STALE;
+  st = prepare(s, "SELECT d.kind, d.name FROM dependency d WHERE d.run = ?1 "
+               "AND ((d.kind = 'field' AND (SELECT cone_hash FROM field WHERE "
+               "model_hash = ?2 AND name = d.name) IS NOT (SELECT cone_hash "
+               "FROM field WHERE model_hash = ?3 AND name = d.name)) OR "
+               "(d.kind = 'block' AND (SELECT hash FROM subsystem WHERE "
+               "model_hash = ?2 AND name = d.name) IS NOT (SELECT hash FROM "
+               "subsystem WHERE model_hash = ?3 AND name = d.name))) "
+               "ORDER BY d.kind DESC, d.rowid");
+  if (st == NULL) {
+    return -1;
+  }
+
+  (void)sqlite3_bind_int64(st, 1, (sqlite3_int64)c->run);
+  bind_text(st, 2, model_hash);
+  bind_text(st, 3, m->hash);
+  first = true;
+  i = 0;
+  while ((rc = sqlite3_step(st)) == SQLITE_ROW) {
+    const boolean_T field = strcmp((const char_T *)sqlite3_column_text(st, 0),
+      "field") == 0;
+    if (!field && (i == 0)) {
+      first = true;
+      i = 1;
+    }
+
+    add_why(c->why, field ? "fields " : "subsystems ", &first, (const char_T *)
+            sqlite3_column_text(st, 1));
+  }
+
+  (void)sqlite3_finalize(st);
+  if (rc != SQLITE_DONE) {
+    return fail(s, "dependency");
+  }
+
+  /* Blocks the cone did not reach before */
+  st = prepare(s, "SELECT 1 FROM dependency WHERE run = ?1 AND kind = 'block' "
+               "AND name = ?2");
+  if (st == NULL) {
+    return -1;
+  }
+
+  first = true;
+  p = run->cone->blocks;
+  while ((p = next_block(p, name, sizeof(name))) != NULL) {
+    (void)sqlite3_reset(st);
+    (void)sqlite3_bind_int64(st, 1, (sqlite3_int64)c->run);
+    bind_text(st, 2, name);
+    if (sqlite3_step(st) != SQLITE_ROW) {
+      add_why(c->why, "new in the cone ", &first, name);
+    }
+  }
+
+  (void)sqlite3_finalize(st);
+  if (c->why[0] == '\0') {
+    (void)snprintf(c->why, sizeof(c->why), "cone changed");
+  }
+
+  return 0;
+}
+
+int_T fsm_12B_store_times(fsm_12B_Store *s, const char_T *harness,
+  const char_T *requirement, const char_T *tool_version, const char_T
+  *options, int_T *runs, int_T *conclusive, real_T *seconds)
+{
+  sqlite3_stmt *st = prepare(s, "SELECT count(*), coalesce(sum(verdict IN "
+    "('PASS', 'FAIL')), 0), coalesce(sum(seconds), 0.0) FROM run WHERE "
+    "harness = ?1 AND requirement = ?2 AND tool_version = ?3 AND options = "
+    "?4");
+  if (st == NULL) {
+    return -1;
+  }
+
+  bind_harness(st, 1, harness);
+  bind_text(st, 2, requirement);
+  bind_text(st, 3, tool_version);
+  bind_text(st, 4, options);
+  if (sqlite3_step(st) != SQLITE_ROW) {
+    (void)sqlite3_finalize(st);
+    return fail(s, "run");
+  }
+
+  *runs = sqlite3_column_int(st, 0);
+  *conclusive = sqlite3_column_int(st, 1);
+  *seconds = sqlite3_column_double(st, 2);
+  (void)sqlite3_finalize(st);
+  return 0;
+}
+
+char_T *fsm_12B_store_counterexample(fsm_12B_Store *s, int64_T run)
+{
+  sqlite3_stmt *st = prepare(s, "SELECT counterexample FROM run WHERE id = ?1 "
+    "AND counterexample IS NOT NULL");
+  char_T *trace = NULL;
+  if (st == NULL) {
+    return NULL;
+  }
+
+  (void)sqlite3_bind_int64(st, 1, (sqlite3_int64)run);
+  if (sqlite3_step(st) == SQLITE_ROW) {
+    const char_T *text = (const char_T *)sqlite3_column_text(st, 0);
+    const size_t n = strlen(text);
+    trace = (char_T *)malloc(n + 1U);
+    if (trace != NULL) {
+      memcpy(trace, text, n + 1U);
+    }
+  }
+
+  (void)sqlite3_finalize(st);
+  return trace;
+}
+
+int_T fsm_12B_store_history(FILE *out, fsm_12B_Store *s, const char_T
+  *harness)
+{
+  sqlite3_stmt *st = prepare(s, "SELECT id, started, harness, requirement, "
+    "verdict, seconds, peak_kib, substr(model_hash, 1, 12), tool_version FROM "
+    "run WHERE ?1 IS NULL OR harness = ?1 ORDER BY id");
+  int_T rc;
+  if (st == NULL) {
+    return -1;
+  }
+
+  if (harness != NULL) {
+    bind_harness(st, 1, harness);
+  }
+
+  fprintf(out, "  run  started               req  verdict   seconds  peak MiB"
+          "  model         verifier  harness\n");
+  while ((rc = sqlite3_step(st)) == SQLITE_ROW) {
+    fprintf(out, "%5lld  %-20s  %3s  %-8s %8.2f  %8.1f  %-12s  %s  %s\n",
+            (long long)sqlite3_column_int64(st, 0), (const char_T *)
+            sqlite3_column_text(st, 1), (const char_T *)sqlite3_column_text(st,
+             3), (const char_T *)sqlite3_column_text(st, 4),
+            sqlite3_column_double(st, 5), (real_T)sqlite3_column_int64(st, 6) /
+            1024.0, (const char_T *)sqlite3_column_text(st, 7), (const char_T *)
+            sqlite3_column_text(st, 8), (const char_T *)sqlite3_column_text(st,
+             2));
+  }
+
+  (void)sqlite3_finalize(st);
+  return (rc == SQLITE_DONE) ? 0 : fail(s, "history");
+}
+
+int_T fsm_12B_store_trend(FILE *out, fsm_12B_Store *s, const char_T *harness,
+  real_T factor)
+{
+  sqlite3_stmt *st = prepare(s, "SELECT harness, requirement, tool_version, "
+    "count(*), avg(seconds), max(seconds), max(peak_kib) FROM run WHERE "
+    "verdict IN ('PASS', 'FAIL') AND (?1 IS NULL OR harness = ?1) GROUP BY "
+    "harness, requirement, tool_version ORDER BY harness, CAST(requirement AS "
+    "INTEGER), requirement, min(id)");
+  char_T last[FSM_12B_STORE_TEXT] = "";
+  real_T last_mean = 0.0;
+  int_T regressions = 0;
+  int_T rc;
+  if (st == NULL) {
+    return -1;
+  }
+
+  if (harness != NULL) {
+    bind_harness(st, 1, harness);
+  }
+
+  fprintf(out, "  req  runs  mean s   max s  peak MiB  verifier\n");
+  while ((rc = sqlite3_step(st)) == SQLITE_ROW) {
+    char_T key[FSM_12B_STORE_TEXT];
+    const real_T mean = sqlite3_column_double(st, 4);
+    boolean_T slower;
+    (void)snprintf(key, sizeof(key), "%s#%s", (const char_T *)
+                   sqlite3_column_text(st, 0), (const char_T *)
+                   sqlite3_column_text(st, 1));
+    slower = (strcmp(key, last) == 0) && (mean > factor * last_mean);
+    fprintf(out, "  %3s  %4d %7.2f %7.2f  %8.1f  %s%s\n", (const char_T *)
+            sqlite3_column_text(st, 1), sqlite3_column_int(st, 3), mean,
+            sqlite3_column_double(st, 5), (real_T)sqlite3_column_int64(st, 6) /
+            1024.0, (const char_T *)sqlite3_column_text(st, 2), slower ?
+            "  <-- slower" : "");
+    regressions += slower ? 1 : 0;
+    (void)snprintf(last, sizeof(last), "%s", key);
+    last_mean = mean;
+  }
+
+  (void)sqlite3_finalize(st);
+  return (rc == SQLITE_DONE) ? regressions : fail(s, "trend");
+}
+
+char_T *fsm_12B_store_trace(const char_T *log)
+{
+  char_T line[4096];
+  FILE *fp = fopen(log, "r");
+  char_T *trace = NULL;
+  size_t size = 0U;
+  size_t used = 0U;
+  boolean_T on = false;
+  if (fp == NULL) {
+    return NULL;
+  }
+
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    const size_t n = strlen(line);
+    if (strstr(line, "Counterexample") != NULL) {
+      on = true;
+    }
+
+    if (on) {
+      if (used + n + 1U > size) {
+        char_T *grown = (char_T *)realloc(trace, 2U * size + n + 4096U);
+        if (grown == NULL) {
+          break;
+        }
+
+        trace = grown;
+        size = 2U * size + n + 4096U;
+      }
+
+      memcpy(&trace[used], line, n + 1U);
+      used += n;
+    }
+
+    if (strstr(line, "VERIFICATION FAILED") != NULL) {
+      break;
+    }
+  }
+
+  (void)fclose(fp);
+  return trace;
+}
+
+/*
+ * File trailer for fsm_12B_store.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,160 @@
+/*
+ * File: fsm_12B_store.h
+ *
+ * Persistent store of verification results in SQLite, with the
+ * dependencies of every requirement on the model, so that a change to
+ * fsm_12B.c only re-verifies the requirements it can affect.
+ *
+ * Every run of the verifier on a branch harness (fsm_12B_verify.h) is a
+ * row: the harness and requirement, the SHA-256 of the branch, of the
+ * model and of the requirement's cone of influence in it, the verifier
+ * version and options, the verdict, wall time, peak memory and, for a
+ * failure, the counterexample.  The runs are never overwritten, so they
+ * are also a time series of solver performance per requirement.
+ *
+ * The cone of influence comes from fsm_12B_slice.h: fsm_12B.c sliced for
+ * the variables the branch asserts, with comments and layout removed and
+ * fsm_12B.h and rtwtypes.h added.  Two models with the same cone give the
+ * requirement the same verdict, whatever else changed.  With each run the
+ * store keeps what the cone depends on: the DW fields and the output it
+ * observes, and the blocks its code comes from.  For every model it keeps
+ * the cone of each field and a digest of each subsystem ("Outputs for
+ * ... SubSystem" to its "End of"), which tell why a requirement is stale.
+ */
+
+#ifndef fsm_12B_store_h_
+#define fsm_12B_store_h_
+#include <stddef.h>
+#include <stdio.h>
+#include "rtwtypes.h"
+#include "fsm_12B_sha256.h"
+#include "fsm_12B_slice.h"
+#include "fsm_12B_verify.h"
+
+#define FSM_12B_STORE_TEXT             512
+
+struct sqlite3;
+
+typedef struct {
+  struct sqlite3 *db;
+  char_T error[FSM_12B_STORE_TEXT];
+} fsm_12B_Store;
+
+/* The sources of one model directory */
+typedef struct {
+  char_T *text;                        /* fsm_12B.c */
+  size_t len;
+  char_T hash[FSM_12B_SHA256_HEX];     /* fsm_12B.c, fsm_12B.h, rtwtypes.h */
+  char_T headers[FSM_12B_SHA256_HEX];  /* fsm_12B.h, rtwtypes.h */
+} fsm_12B_StoreModel;
+
+/* The cone of influence of one branch harness in one model */
+typedef struct {
+  char_T hash[FSM_12B_SHA256_HEX];
+  fsm_12B_SliceVars fields;            /* rtDW->Merge_g, rtY_pullup, ... */
+  char_T blocks[FSM_12B_SLICE_LIST];   /* '<S4>/If' ... as in the slice */
+} fsm_12B_StoreCone;
+
+typedef struct {
+  const char_T *harness;               /* path, stored canonical */
+  const char_T *requirement;           /* branch value, e.g. "3" */
+  const char_T *harness_hash;          /* of the branch harness */
+  const char_T *model_hash;
+  const fsm_12B_StoreCone *cone;
+  const char_T *tool_version;          /* first line of esbmc --version */
+  const char_T *options;               /* verifier options, space separated */
+  fsm_12B_VerifyVerdict verdict;       /* NONE: killed when another won */
+  real_T seconds;
+  uint64_T peak_kib;
+  const char_T *counterexample;        /* NULL when there is none */
+} fsm_12B_StoreRun;
+
+typedef enum {
+  FSM_12B_STORE_NEW = 0,               /* no PASS or FAIL recorded */
+  FSM_12B_STORE_CURRENT,               /* verified on this very model */
+  FSM_12B_STORE_UNAFFECTED,            /* the model changed outside the cone */
+  FSM_12B_STORE_STALE                  /* needs re-verification */
+} fsm_12B_StoreStatus;
+
+extern const char_T *const fsm_12B_store_status_name[4];
+
+typedef struct {
+  fsm_12B_StoreStatus status;
+  int64_T run;                         /* the last conclusive run, or 0 */
+  fsm_12B_VerifyVerdict verdict;       /* its verdict */
+  real_T seconds;
+  char_T started[32];                  /* UTC, ISO 8601 */
+  char_T why[FSM_12B_STORE_TEXT];      /* for STALE */
+} fsm_12B_StoreCheck;
+
+/* Open or create the store at path; 0 or -1 with s->error */
+extern int_T fsm_12B_store_open(fsm_12B_Store *s, const char_T *path);
+extern void fsm_12B_store_close(fsm_12B_Store *s);
+
+/* Read fsm_12B.c, fsm_12B.h and rtwtypes.h of dir; 0 or -1 */
+extern int_T fsm_12B_store_load(fsm_12B_StoreModel *m, const char_T *dir);
+extern void fsm_12B_store_unload(fsm_12B_StoreModel *m);
+
+/*
+ * Cone of influence in m of the branch harness text, for the variables of
+ * its __ESBMC_assert; persistent as in fsm_12B_slice.  0, or -1 when the
+ * branch asserts no model variable or the model cannot be sliced.
+ */
+extern int_T fsm_12B_store_cone(const fsm_12B_StoreModel *m, const char_T
+  *text, size_t len, boolean_T persistent, fsm_12B_StoreCone *c);
+
+/* Record the field cones and subsystem digests of m, once; 0 or -1 */
+extern int_T fsm_12B_store_add_model(fsm_12B_Store *s, const
+  fsm_12B_StoreModel *m);
+
+/* Record a run and the dependencies of its cone; 0 or -1 */
+extern int_T fsm_12B_store_add_run(fsm_12B_Store *s, const fsm_12B_StoreRun
+  *run);
+
+/*
+ * Does a requirement need re-verification on model m?  run describes it
+ * as it would be recorded now (verdict and times unused); m must have
+ * been added.  The last PASS or FAIL of the same harness and requirement
+ * decides: a different branch or verifier makes it stale, the same model
+ * current, the same cone unaffected.  Otherwise c->why names the fields
+ * whose cone and the subsystems whose code changed.  0 or -1.
+ */
+extern int_T fsm_12B_store_check(fsm_12B_Store *s, const fsm_12B_StoreModel
+  *m, const fsm_12B_StoreRun *run, fsm_12B_StoreCheck *c);
+
+/*
+ * The runs of a requirement with one verifier version and options:
+ * *runs of them, *conclusive PASS or FAIL, and *seconds their total wall
+ * time, including the runs cut short by a timeout or a lost race.  0 or
+ * -1.
+ */
+extern int_T fsm_12B_store_times(fsm_12B_Store *s, const char_T *harness,
+  const char_T *requirement, const char_T *tool_version, const char_T
+  *options, int_T *runs, int_T *conclusive, real_T *seconds);
+
+/* Malloc'ed counterexample recorded with a run, or NULL */
+extern char_T *fsm_12B_store_counterexample(fsm_12B_Store *s, int64_T run);
+
+/* Every run, oldest first, of harness (NULL for all) as a table; 0 or -1 */
+extern int_T fsm_12B_store_history(FILE *out, fsm_12B_Store *s, const char_T
+  *harness);
+
+/*
+ * Mean and worst wall time and peak memory of the conclusive runs of each
+ * requirement per verifier version, in the order the versions were first
+ * used.  A mean more than factor times that of the version before is
+ * marked as a regression.  Returns the number of regressions, or -1.
+ */
+extern int_T fsm_12B_store_trend(FILE *out, fsm_12B_Store *s, const char_T
+  *harness, real_T factor);
+
+/* Malloc'ed counterexample of a FAIL log, or NULL */
+extern char_T *fsm_12B_store_trace(const char_T *log);
+
+#endif                                 /* fsm_12B_store_h_ */
+
+/*
+ * File trailer for fsm_12B_store.h
+ *
+ * [EOF]
+ */
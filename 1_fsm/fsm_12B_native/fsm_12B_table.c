@@ -0,0 +1,162 @@
+/*
+ * File: fsm_12B_table.c
+ *
+ * Transition-table engine for Simulink model 'fsm_12B'.
+ */
+
+#include <string.h>
+#include "fsm_12B_table.h"
+#include "rtwtypes.h"
+
+/* fsm_12B_table_build output for model version 25.0 */
+const uint8_T fsm_12B_table_default[FSM_12B_TABLE_SIZE] = {
+  0x41U, 0x35U, 0x41U, 0x35U, 0x41U, 0x35U, 0x41U, 0x35U, 0x44U, 0x36U, 0x44U, 0x36U, 0x44U, 0x36U, 0x44U, 0x36U,
+  0x41U, 0x35U, 0x41U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U, 0x44U, 0x36U, 0x44U, 0x36U, 0x6AU, 0x36U, 0x6AU, 0x36U,
+  0x43U, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U,
+  0x43U, 0x35U, 0x43U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U,
+  0x43U, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0x44U, 0x35U, 0x44U, 0x35U, 0x44U, 0x35U, 0x44U, 0x35U,
+  0x43U, 0x35U, 0x43U, 0x35U, 0x69U, 0x35U, 0x69U, 0x35U, 0x44U, 0x35U, 0x44U, 0x35U, 0x6AU, 0x35U, 0x6AU, 0x35U,
+  0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xB0U, 0x36U, 0xB0U, 0x36U, 0xB0U, 0x36U, 0xB0U, 0x36U,
+  0x67U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U, 0x6AU, 0x36U, 0x6AU, 0x36U, 0x6AU, 0x36U, 0x6AU, 0x36U,
+  0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U,
+  0x67U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U, 0x67U, 0x35U,
+  0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U,
+  0x69U, 0x35U, 0x69U, 0x35U, 0x69U, 0x35U, 0x69U, 0x35U, 0x6AU, 0x35U, 0x6AU, 0x35U, 0x6AU, 0x35U, 0x6AU, 0x35U,
+  0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xB0U, 0xB0U, 0xB0U, 0xB0U, 0xB0U, 0xB0U, 0xB0U, 0xB0U,
+  0xAFU, 0x35U, 0xAFU, 0x35U, 0x41U, 0x35U, 0x41U, 0x35U, 0xB0U, 0x36U, 0xB0U, 0x36U, 0x44U, 0x36U, 0x44U, 0x36U,
+  0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU,
+  0xAFU, 0x35U, 0xAFU, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U,
+  0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU, 0xAFU,
+  0xAFU, 0x35U, 0xAFU, 0x35U, 0x43U, 0x35U, 0x43U, 0x35U, 0xAFU, 0x35U, 0xAFU, 0x35U, 0x44U, 0x35U, 0x44U, 0x35U,
+  0x41U, 0x35U, 0xAFU, 0xAFU, 0x41U, 0x35U, 0xAFU, 0xAFU, 0x44U, 0x36U, 0xB0U, 0xB0U, 0x44U, 0x36U, 0xB0U, 0xB0U,
+  0x41U, 0x35U, 0xAFU, 0xAFU, 0x41U, 0x35U, 0xAFU, 0xAFU, 0x44U, 0x36U, 0xB0U, 0xB0U, 0x44U, 0x36U, 0xB0U, 0xB0U,
+  0x43U, 0x35U, 0xAFU, 0xAFU, 0x43U, 0x35U, 0xAFU, 0xAFU, 0x43U, 0x35U, 0xAFU, 0xAFU, 0x43U, 0x35U, 0xAFU, 0xAFU,
+  0x43U, 0x35U, 0xAFU, 0xAFU, 0x43U, 0x35U, 0xAFU, 0xAFU, 0x43U, 0x35U, 0xAFU, 0xAFU, 0x43U, 0x35U, 0xAFU, 0xAFU,
+  0x43U, 0x35U, 0xAFU, 0xAFU, 0x43U, 0x35U, 0xAFU, 0xAFU, 0x44U, 0x35U, 0xAFU, 0xAFU, 0x44U, 0x35U, 0xAFU, 0xAFU,
+  0x43U, 0x35U, 0xAFU, 0xAFU, 0x43U, 0x35U, 0xAFU, 0xAFU, 0x44U, 0x35U, 0xAFU, 0xAFU, 0x44U, 0x35U, 0xAFU, 0xAFU
+};
+
+/* Pack the outcome of one fsm_12B_step into a table entry */
+static boolean_T fsm_12B_table_entry(const DW *rtDW, boolean_T rtY_pullup,
+  uint8_T *entry)
+{
+  uint8_T next;
+  if (!fsm_12B_table_state_from_dw(rtDW, &next)) {
+    return false;
+  }
+
+  if ((rtDW->Merge != rtDW->UnitDelay_DSTATE) || (rtDW->Merge_g !=
+       rtDW->UnitDelay1_DSTATE) || (rtY_pullup != rtDW->Merge_p[2])) {
+    return false;
+  }
+
+  *entry = (uint8_T)(next | ((rtDW->Merge_p[0] != 0) << 5) | ((rtDW->Merge_p[1]
+    != 0) << 6) | ((rtDW->Merge_p[2] != 0) << 7));
+  return true;
+}
+
+boolean_T fsm_12B_table_build(uint8_T tbl[FSM_12B_TABLE_SIZE])
+{
+  RT_MODEL rtM;
+  DW rtDW;
+  boolean_T ok = true;
+  uint8_T s;
+  uint8_T k;
+  rtM.dwork = &rtDW;
+  for (s = 0U; s < FSM_12B_TABLE_STATES; s++) {
+    for (k = 0U; k < FSM_12B_TABLE_INPUTS; k++) {
+      boolean_T rtY_pullup = false;
+      uint8_T entry = 0U;
+      fsm_12B_table_state_to_dw(s, &rtDW);
+      fsm_12B_step(&rtM, (k & 1U) != 0, (k & 2U) != 0, (k & 4U) != 0, (k & 8U)
+                   != 0, &rtY_pullup);
+      if (!fsm_12B_table_entry(&rtDW, rtY_pullup, &entry)) {
+        ok = false;
+      }
+
+      tbl[(s << 4) | k] = entry;
+    }
+  }
+
+  return ok;
+}
+
+uint32_T fsm_12B_table_check(const uint8_T tbl[FSM_12B_TABLE_SIZE])
+{
+  RT_MODEL rtM;
+  DW rtDW;
+  uint32_T mismatches = 0U;
+  uint8_T s;
+  uint8_T k;
+  rtM.dwork = &rtDW;
+  for (s = 0U; s < FSM_12B_TABLE_STATES; s++) {
+    for (k = 0U; k < FSM_12B_TABLE_INPUTS; k++) {
+      boolean_T ok = true;
+      uint32_T merge;
+      uint32_T merge_g;
+      uint32_T merge_p;
+      for (merge = 0U; ok && (merge < 4U); merge++) {
+        for (merge_g = 0U; ok && (merge_g < 3U); merge_g++) {
+          for (merge_p = 0U; ok && (merge_p < 8U); merge_p++) {
+            boolean_T rtY_pullup = false;
+            uint8_T entry = 0U;
+            fsm_12B_table_state_to_dw(s, &rtDW);
+            rtDW.Merge = (real_T)merge;
+            rtDW.Merge_g = (real_T)merge_g;
+            rtDW.Merge_p[0] = (boolean_T)(merge_p & 1U);
+            rtDW.Merge_p[1] = (boolean_T)((merge_p >> 1) & 1U);
+            rtDW.Merge_p[2] = (boolean_T)(merge_p >> 2);
+            fsm_12B_step(&rtM, (k & 1U) != 0, (k & 2U) != 0, (k & 4U) != 0, (k
+              & 8U) != 0, &rtY_pullup);
+            ok = fsm_12B_table_entry(&rtDW, rtY_pullup, &entry) && (entry ==
+              tbl[(s << 4) | k]);
+          }
+        }
+      }
+
+      if (!ok) {
+        mismatches++;
+      }
+    }
+  }
+
+  return mismatches;
+}
+
+boolean_T fsm_12B_table_state_from_dw(const DW *rtDW, uint8_T *rtS)
+{
+  const real_T ud = rtDW->UnitDelay_DSTATE;
+  const real_T ud1 = rtDW->UnitDelay1_DSTATE;
+  if (!((ud == 0.0) || (ud == 1.0) || (ud == 2.0) || (ud == 3.0))) {
+    return false;
+  }
+
+  if (!((ud1 == 0.0) || (ud1 == 1.0) || (ud1 == 2.0))) {
+    return false;
+  }
+
+  *rtS = (uint8_T)(6U * (uint32_T)ud + 2U * (uint32_T)ud1 + (uint32_T)
+                   (rtDW->UnitDelay2_DSTATE != 0));
+  return true;
+}
+
+void fsm_12B_table_state_to_dw(uint8_T rtS, DW *rtDW)
+{
+  const uint32_T mode = (uint32_T)rtS / 6U;
+  const uint32_T sen = ((uint32_T)rtS % 6U) >> 1;
+  memset(rtDW, 0, sizeof(DW));
+  rtDW->Merge = (real_T)mode;
+  rtDW->Merge_g = (real_T)sen;
+  rtDW->UnitDelay_DSTATE = (real_T)mode;
+  rtDW->UnitDelay1_DSTATE = (real_T)sen;
+  rtDW->Merge_p[0] = (mode != 0U);
+  rtDW->Merge_p[1] = (mode < 2U);
+  rtDW->Merge_p[2] = (mode == 2U);
+  rtDW->UnitDelay2_DSTATE = (boolean_T)(rtS & 1U);
+}
+
+/*
+ * File trailer for fsm_12B_table.c
+ *
+ * [EOF]
+ */
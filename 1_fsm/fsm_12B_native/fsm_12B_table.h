@@ -0,0 +1,72 @@
+/*
+ * File: fsm_12B_table.h
+ *
+ * Transition-table engine for Simulink model 'fsm_12B'.
+ *
+ * Everything fsm_12B_step reads before writing is the three unit delays,
+ * so the reachable model is a Mealy machine over
+ *
+ *   state  s = 6 * '<S1>/Unit Delay' + 2 * '<S1>/Unit Delay1'
+ *              + '<S1>/Unit Delay2'                          (24 states)
+ *   input  k = standby | apfail << 1 | supported << 2 | limits << 3
+ *
+ * and one step is the single load tbl[16 * s + k].  Each entry packs the
+ * next state in bits 0..4 and '<S5>/Merge' in bits 5..7; rtY_pullup is
+ * Merge_p[2], bit 7.
+ */
+
+#ifndef fsm_12B_table_h_
+#define fsm_12B_table_h_
+#include "rtwtypes.h"
+#include "fsm_12B.h"
+
+#define FSM_12B_TABLE_STATES           24
+#define FSM_12B_TABLE_INPUTS           16
+#define FSM_12B_TABLE_SIZE             (FSM_12B_TABLE_STATES * FSM_12B_TABLE_INPUTS)
+
+/* Entry fields */
+#define FSM_12B_TABLE_NEXT(e)          ((uint8_T)((e) & 0x1FU))
+#define FSM_12B_TABLE_MERGE_P(e, k)    ((boolean_T)(((e) >> (5 + (k))) & 1U))
+#define FSM_12B_TABLE_PULLUP(e)        ((boolean_T)((e) >> 7))
+
+/* Table generated from fsm_12B_step at model version 25.0 */
+extern const uint8_T fsm_12B_table_default[FSM_12B_TABLE_SIZE];
+
+/*
+ * Fill tbl by running fsm_12B_step on every (state, input) pair.  Returns
+ * false if some outcome falls outside the 24-state domain.
+ */
+extern boolean_T fsm_12B_table_build(uint8_T tbl[FSM_12B_TABLE_SIZE]);
+
+/*
+ * Cross-validate tbl against fsm_12B_step.  Every entry is re-executed
+ * from every value of the fields the step overwrites before reading
+ * (Merge, Merge_g, Merge_p), so a regenerated model that starts reading
+ * one of them, or leaves the 24-state domain, is also reported.  Returns
+ * the number of entries that disagree.
+ */
+extern uint32_T fsm_12B_table_check(const uint8_T tbl[FSM_12B_TABLE_SIZE]);
+
+/* Conversion between DW and a table state */
+extern boolean_T fsm_12B_table_state_from_dw(const DW *rtDW, uint8_T *rtS);
+extern void fsm_12B_table_state_to_dw(uint8_T rtS, DW *rtDW);
+
+/* Model step function, table engine */
+static inline void fsm_12B_table_step(const uint8_T *tbl, uint8_T *rtS,
+  boolean_T rtU_standby, boolean_T rtU_apfail, boolean_T rtU_supported,
+  boolean_T rtU_limits, boolean_T *rtY_pullup)
+{
+  const uint8_T e = tbl[((uint32_T)*rtS << 4) | (uint32_T)(rtU_standby != 0) |
+                        ((uint32_T)(rtU_apfail != 0) << 1) | ((uint32_T)
+    (rtU_supported != 0) << 2) | ((uint32_T)(rtU_limits != 0) << 3)];
+  *rtS = FSM_12B_TABLE_NEXT(e);
+  *rtY_pullup = FSM_12B_TABLE_PULLUP(e);
+}
+
+#endif                                 /* fsm_12B_table_h_ */
+
+/*
+ * File trailer for fsm_12B_table.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,593 @@
+/*
+ * File: fsm_12B_trace.c
+ *
+ * Bit-packed trace container for Simulink model 'fsm_12B'.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include "fsm_12B_trace.h"
+#include "rtwtypes.h"
+
+#define FSM_12B_TRACE_HEADER_BYTES     40U
+#define FSM_12B_TRACE_RAW              0U
+#define FSM_12B_TRACE_RLE              1U
+
+static const char_T fsm_12B_trace_magic[8] = { 'F', '1', '2', 'B', 'T', 'R',
+  'C', '1' };
+
+/* Little-endian integer I/O */
+static void put_u32(uint8_T *p, uint32_T v)
+{
+  int_T i;
+  for (i = 0; i < 4; i++) {
+    p[i] = (uint8_T)(v >> (8 * i));
+  }
+}
+
+static void put_u64(uint8_T *p, uint64_T v)
+{
+  int_T i;
+  for (i = 0; i < 8; i++) {
+    p[i] = (uint8_T)(v >> (8 * i));
+  }
+}
+
+static uint32_T get_u32(const uint8_T *p)
+{
+  uint32_T v = 0U;
+  int_T i;
+  for (i = 3; i >= 0; i--) {
+    v = (v << 8) | p[i];
+  }
+
+  return v;
+}
+
+static uint64_T get_u64(const uint8_T *p)
+{
+  uint64_T v = 0U;
+  int_T i;
+  for (i = 7; i >= 0; i--) {
+    v = (v << 8) | p[i];
+  }
+
+  return v;
+}
+
+static uint32_T put_varint(uint8_T *p, uint32_T v)
+{
+  uint32_T n = 0U;
+  while (v >= 0x80U) {
+    p[n++] = (uint8_T)(v | 0x80U);
+    v >>= 7;
+  }
+
+  p[n++] = (uint8_T)v;
+  return n;
+}
+
+/* Returns bytes consumed, 0 on malformed input */
+static uint32_T get_varint(const uint8_T *p, uint32_T avail, uint32_T *v)
+{
+  uint32_T n = 0U;
+  uint32_T shift = 0U;
+  *v = 0U;
+  while ((n < avail) && (shift < 32U)) {
+    const uint8_T b = p[n++];
+    *v |= (uint32_T)(b & 0x7FU) << shift;
+    if ((b & 0x80U) == 0U) {
+      return n;
+    }
+
+    shift += 7U;
+  }
+
+  return 0U;
+}
+
+/* Plane encoders; sym holds one symbol per tick */
+static uint32_T nibble_raw(const uint8_T *sym, uint32_T n, uint8_T *out)
+{
+  uint32_T i;
+  memset(out, 0, (n + 1U) / 2U);
+  for (i = 0U; i < n; i++) {
+    out[i >> 1] |= (uint8_T)(sym[i] << ((i & 1U) * 4U));
+  }
+
+  return (n + 1U) / 2U;
+}
+
+static uint32_T nibble_rle(const uint8_T *sym, uint32_T n, uint8_T *out)
+{
+  uint32_T len = 0U;
+  uint32_T i = 0U;
+  while (i < n) {
+    uint32_T run = 1U;
+    while ((i + run < n) && (sym[i + run] == sym[i])) {
+      run++;
+    }
+
+    if (run - 1U < 15U) {
+      out[len++] = (uint8_T)(sym[i] | ((run - 1U) << 4));
+    } else {
+      out[len++] = (uint8_T)(sym[i] | 0xF0U);
+      len += put_varint(&out[len], run - 16U);
+    }
+
+    i += run;
+  }
+
+  return len;
+}
+
+static uint32_T bit_raw(const uint8_T *sym, uint32_T n, uint8_T *out)
+{
+  uint32_T i;
+  memset(out, 0, (n + 7U) / 8U);
+  for (i = 0U; i < n; i++) {
+    out[i >> 3] |= (uint8_T)((sym[i] & 1U) << (i & 7U));
+  }
+
+  return (n + 7U) / 8U;
+}
+
+static uint32_T bit_rle(const uint8_T *sym, uint32_T n, uint8_T *out)
+{
+  uint32_T len = 0U;
+  uint32_T i = 0U;
+  if (n == 0U) {
+    return 0U;
+  }
+
+  out[len++] = sym[0];
+  while (i < n) {
+    uint32_T run = 1U;
+    while ((i + run < n) && (sym[i + run] == sym[i])) {
+      run++;
+    }
+
+    len += put_varint(&out[len], run);
+    i += run;
+  }
+
+  return len;
+}
+
+/* Plane decoders; return 0 on success, -1 on malformed data */
+static int_T nibble_decode(uint8_T enc, const uint8_T *in, uint32_T bytes,
+  uint8_T *sym, uint32_T n)
+{
+  uint32_T i = 0U;
+  uint32_T pos = 0U;
+  if (enc == FSM_12B_TRACE_RAW) {
+    if (bytes != (n + 1U) / 2U) {
+      return -1;
+    }
+
+    for (i = 0U; i < n; i++) {
+      sym[i] = (uint8_T)((in[i >> 1] >> ((i & 1U) * 4U)) & 0x0FU);
+    }
+
+    return 0;
+  }
+
+  while (pos < bytes) {
+    const uint8_T s = (uint8_T)(in[pos] & 0x0FU);
+    uint32_T run = ((uint32_T)in[pos++] >> 4) + 1U;
+    if (run == 16U) {
+      uint32_T extra;
+      const uint32_T used = get_varint(&in[pos], bytes - pos, &extra);
+      if ((used == 0U) || (extra > n)) {
+        return -1;
+      }
+
+      pos += used;
+      run += extra;
+    }
+
+    if (run > n - i) {
+      return -1;
+    }
+
+    memset(&sym[i], s, run);
+    i += run;
+  }
+
+  return (i == n) ? 0 : -1;
+}
+
+static int_T bit_decode(uint8_T enc, const uint8_T *in, uint32_T bytes, uint8_T *
+  sym, uint32_T n)
+{
+  uint32_T i = 0U;
+  uint32_T pos = 1U;
+  uint8_T v;
+  if (enc == FSM_12B_TRACE_RAW) {
+    if (bytes != (n + 7U) / 8U) {
+      return -1;
+    }
+
+    for (i = 0U; i < n; i++) {
+      sym[i] = (uint8_T)((in[i >> 3] >> (i & 7U)) & 1U);
+    }
+
+    return 0;
+  }
+
+  if (n == 0U) {
+    return (bytes == 0U) ? 0 : -1;
+  }
+
+  if ((bytes == 0U) || (in[0] > 1U)) {
+    return -1;
+  }
+
+  v = in[0];
+  while (pos < bytes) {
+    uint32_T run;
+    const uint32_T used = get_varint(&in[pos], bytes - pos, &run);
+    if ((used == 0U) || (run == 0U) || (run > n - i)) {
+      return -1;
+    }
+
+    pos += used;
+    memset(&sym[i], v, run);
+    i += run;
+    v ^= 1U;
+  }
+
+  return (i == n) ? 0 : -1;
+}
+
+/* Write one plane with the smaller of its two encodings */
+static int_T write_plane(FILE *fp, const uint8_T *sym, uint32_T n, boolean_T
+  nibble, uint8_T *raw, uint8_T *rle, uint64_T *pos)
+{
+  uint8_T hdr[5];
+  const uint32_T raw_len = nibble ? nibble_raw(sym, n, raw) : bit_raw(sym, n,
+    raw);
+  const uint32_T rle_len = nibble ? nibble_rle(sym, n, rle) : bit_rle(sym, n,
+    rle);
+  const boolean_T use_rle = (rle_len < raw_len);
+  const uint32_T len = use_rle ? rle_len : raw_len;
+  hdr[0] = use_rle ? (uint8_T)FSM_12B_TRACE_RLE : (uint8_T)FSM_12B_TRACE_RAW;
+  put_u32(&hdr[1], len);
+  if ((fwrite(hdr, 1, sizeof(hdr), fp) != sizeof(hdr)) || (fwrite(use_rle ? rle
+        : raw, 1, len, fp) != len)) {
+    return -1;
+  }
+
+  *pos += sizeof(hdr) + (uint64_T)len;
+  return 0;
+}
+
+static int_T write_header(FILE *fp, uint32_T block_ticks, uint64_T ticks,
+  uint64_T nblocks, uint64_T index_offset)
+{
+  uint8_T hdr[FSM_12B_TRACE_HEADER_BYTES];
+  memcpy(hdr, fsm_12B_trace_magic, sizeof(fsm_12B_trace_magic));
+  put_u32(&hdr[8], FSM_12B_TRACE_VERSION);
+  put_u32(&hdr[12], block_ticks);
+  put_u64(&hdr[16], ticks);
+  put_u64(&hdr[24], nblocks);
+  put_u64(&hdr[32], index_offset);
+  return (fwrite(hdr, 1, sizeof(hdr), fp) == sizeof(hdr)) ? 0 : -1;
+}
+
+static int_T flush_block(fsm_12B_TraceWriter *w)
+{
+  const uint32_T n = w->fill;
+  uint8_T *sym = w->scratch;
+  uint8_T *raw = &w->scratch[(size_t)w->block_ticks + 16U];
+  uint8_T *rle = &w->scratch[2U * ((size_t)w->block_ticks + 16U)];
+  uint8_T nt[4];
+  uint32_T i;
+  if (n == 0U) {
+    return 0;
+  }
+
+  if (w->nblocks == w->index_capacity) {
+    const uint64_T cap = (w->index_capacity == 0U) ? 64U : 2U *
+      w->index_capacity;
+    uint64_T *index = (uint64_T *)realloc(w->index, (size_t)cap * sizeof
+      (uint64_T));
+    if (index == NULL) {
+      return -1;
+    }
+
+    w->index = index;
+    w->index_capacity = cap;
+  }
+
+  w->index[w->nblocks++] = w->pos;
+  put_u32(nt, n);
+  if (fwrite(nt, 1, sizeof(nt), w->fp) != sizeof(nt)) {
+    return -1;
+  }
+
+  w->pos += sizeof(nt);
+  for (i = 0U; i < n; i++) {
+    sym[i] = w->block[i].inputs;
+  }
+
+  if (write_plane(w->fp, sym, n, true, raw, rle, &w->pos) != 0) {
+    return -1;
+  }
+
+  for (i = 0U; i < n; i++) {
+    sym[i] = w->block[i].rtY_pullup;
+  }
+
+  if (write_plane(w->fp, sym, n, false, raw, rle, &w->pos) != 0) {
+    return -1;
+  }
+
+  for (i = 0U; i < n; i++) {
+    sym[i] = (uint8_T)(w->block[i].Merge | (w->block[i].Merge_g << 2));
+  }
+
+  if (write_plane(w->fp, sym, n, true, raw, rle, &w->pos) != 0) {
+    return -1;
+  }
+
+  w->fill = 0U;
+  return 0;
+}
+
+int_T fsm_12B_trace_create(fsm_12B_TraceWriter *w, const char_T *path,
+  uint32_T block_ticks)
+{
+  memset(w, 0, sizeof(fsm_12B_TraceWriter));
+  if (block_ticks == 0U) {
+    block_ticks = FSM_12B_TRACE_BLOCK_TICKS;
+  }
+
+  if (block_ticks > FSM_12B_TRACE_MAX_BLOCK_TICKS) {
+    return -1;
+  }
+
+  w->block_ticks = block_ticks;
+  w->block = (fsm_12B_TraceTick *)malloc((size_t)block_ticks * sizeof
+    (fsm_12B_TraceTick));
+  w->scratch = (uint8_T *)malloc(3U * ((size_t)block_ticks + 16U));
+  w->fp = fopen(path, "wb");
+  if ((w->block == NULL) || (w->scratch == NULL) || (w->fp == NULL) ||
+      (write_header(w->fp, block_ticks, 0U, 0U, 0U) != 0)) {
+    if (w->fp != NULL) {
+      (void)fclose(w->fp);
+    }
+
+    free(w->block);
+    free(w->scratch);
+    return -1;
+  }
+
+  w->pos = FSM_12B_TRACE_HEADER_BYTES;
+  return 0;
+}
+
+int_T fsm_12B_trace_append(fsm_12B_TraceWriter *w, const fsm_12B_TraceTick
+  *tick)
+{
+  if (w->failed || (tick->inputs > 15U) || (tick->rtY_pullup > 1U) ||
+      (tick->Merge > 3U) || (tick->Merge_g > 3U)) {
+    return -1;
+  }
+
+  w->block[w->fill++] = *tick;
+  w->ticks++;
+  if ((w->fill == w->block_ticks) && (flush_block(w) != 0)) {
+    /* The block is half written and still full */
+    w->failed = true;
+    return -1;
+  }
+
+  return 0;
+}
+
+int_T fsm_12B_trace_finish(fsm_12B_TraceWriter *w)
+{
+  int_T status = w->failed ? -1 : flush_block(w);
+  const uint64_T index_offset = w->pos;
+  uint64_T b;
+  for (b = 0U; (status == 0) && (b < w->nblocks); b++) {
+    uint8_T off[8];
+    put_u64(off, w->index[b]);
+    if (fwrite(off, 1, sizeof(off), w->fp) != sizeof(off)) {
+      status = -1;
+    }
+  }
+
+  if ((status == 0) && ((fseeko(w->fp, 0, SEEK_SET) != 0) || (write_header(w->fp,
+         w->block_ticks, w->ticks, w->nblocks, index_offset) != 0))) {
+    status = -1;
+  }
+
+  if (fclose(w->fp) != 0) {
+    status = -1;
+  }
+
+  free(w->block);
+  free(w->scratch);
+  free(w->index);
+  memset(w, 0, sizeof(fsm_12B_TraceWriter));
+  return status;
+}
+
+int_T fsm_12B_trace_open(fsm_12B_TraceReader *r, const char_T *path)
+{
+  uint8_T hdr[FSM_12B_TRACE_HEADER_BYTES];
+  uint64_T index_offset;
+  uint64_T b;
+  memset(r, 0, sizeof(fsm_12B_TraceReader));
+  r->fp = fopen(path, "rb");
+  if (r->fp == NULL) {
+    return -1;
+  }
+
+  if ((fread(hdr, 1, sizeof(hdr), r->fp) != sizeof(hdr)) || (memcmp(hdr,
+        fsm_12B_trace_magic, sizeof(fsm_12B_trace_magic)) != 0) || (get_u32
+       (&hdr[8]) != FSM_12B_TRACE_VERSION)) {
+    fsm_12B_trace_close(r);
+    return -1;
+  }
+
+  r->block_ticks = get_u32(&hdr[12]);
+  r->ticks = get_u64(&hdr[16]);
+  r->nblocks = get_u64(&hdr[24]);
+  index_offset = get_u64(&hdr[32]);
+  /* Sizes come from the file: bound them before any allocation */
+  if ((r->block_ticks == 0U) || (r->block_ticks > FSM_12B_TRACE_MAX_BLOCK_TICKS)
+      || (r->nblocks >= SIZE_MAX / sizeof(uint64_T)) || (r->nblocks != r->ticks
+       / r->block_ticks + ((r->ticks % r->block_ticks != 0U) ? 1U : 0U))) {
+    fsm_12B_trace_close(r);
+    return -1;
+  }
+
+  r->cached = r->nblocks;
+  r->index = (uint64_T *)malloc((size_t)(r->nblocks + 1U) * sizeof(uint64_T));
+  r->block = (fsm_12B_TraceTick *)malloc((size_t)r->block_ticks * sizeof
+    (fsm_12B_TraceTick));
+  r->scratch = (uint8_T *)malloc(2U * ((size_t)r->block_ticks + 16U));
+  if ((r->index == NULL) || (r->block == NULL) || (r->scratch == NULL) ||
+      (fseeko(r->fp, (off_t)index_offset, SEEK_SET) != 0)) {
+    fsm_12B_trace_close(r);
+    return -1;
+  }
+
+  for (b = 0U; b < r->nblocks; b++) {
+    uint8_T off[8];
+    if (fread(off, 1, sizeof(off), r->fp) != sizeof(off)) {
+      fsm_12B_trace_close(r);
+      return -1;
+    }
+
+    r->index[b] = get_u64(off);
+  }
+
+  return 0;
+}
+
+/* Read and decode one plane of the block at the current file position */
+static int_T read_plane(fsm_12B_TraceReader *r, boolean_T nibble, uint8_T *sym,
+  uint32_T n)
+{
+  uint8_T hdr[5];
+  uint8_T *data = &r->scratch[(size_t)r->block_ticks + 16U];
+  uint32_T len;
+  if (fread(hdr, 1, sizeof(hdr), r->fp) != sizeof(hdr)) {
+    return -1;
+  }
+
+  len = get_u32(&hdr[1]);
+  if ((hdr[0] > FSM_12B_TRACE_RLE) || ((size_t)len > (size_t)r->block_ticks +
+       16U) || (fread(data, 1, len, r->fp) != len)) {
+    return -1;
+  }
+
+  return nibble ? nibble_decode(hdr[0], data, len, sym, n) : bit_decode(hdr[0],
+    data, len, sym, n);
+}
+
+static int_T load_block(fsm_12B_TraceReader *r, uint64_T b)
+{
+  uint8_T nt[4];
+  uint8_T *sym = r->scratch;
+  uint32_T n;
+  uint32_T i;
+  if ((fseeko(r->fp, (off_t)r->index[b], SEEK_SET) != 0) || (fread(nt, 1, sizeof
+        (nt), r->fp) != sizeof(nt))) {
+    return -1;
+  }
+
+  n = get_u32(nt);
+  if (n != ((b + 1U < r->nblocks) ? r->block_ticks : (uint32_T)(r->ticks - b *
+        r->block_ticks))) {
+    return -1;
+  }
+
+  if (read_plane(r, true, sym, n) != 0) {
+    return -1;
+  }
+
+  for (i = 0U; i < n; i++) {
+    r->block[i].inputs = sym[i];
+  }
+
+  if (read_plane(r, false, sym, n) != 0) {
+    return -1;
+  }
+
+  for (i = 0U; i < n; i++) {
+    r->block[i].rtY_pullup = sym[i];
+  }
+
+  if (read_plane(r, true, sym, n) != 0) {
+    return -1;
+  }
+
+  for (i = 0U; i < n; i++) {
+    r->block[i].Merge = (uint8_T)(sym[i] & 3U);
+    r->block[i].Merge_g = (uint8_T)(sym[i] >> 2);
+  }
+
+  r->cached = b;
+  return 0;
+}
+
+int_T fsm_12B_trace_read(fsm_12B_TraceReader *r, uint64_T tick,
+  fsm_12B_TraceTick *out)
+{
+  const uint64_T b = tick / r->block_ticks;
+  if (tick >= r->ticks) {
+    return -1;
+  }
+
+  if ((b != r->cached) && (load_block(r, b) != 0)) {
+    r->cached = r->nblocks;
+    return -1;
+  }
+
+  *out = r->block[tick % r->block_ticks];
+  return 0;
+}
+
+int_T fsm_12B_trace_read_block(fsm_12B_TraceReader *r, uint64_T b, const
+  fsm_12B_TraceTick **ticks)
+{
+  if (b >= r->nblocks) {
+    return -1;
+  }
+
+  if ((b != r->cached) && (load_block(r, b) != 0)) {
+    r->cached = r->nblocks;
+    return -1;
+  }
+
+  *ticks = r->block;
+  return (b + 1U < r->nblocks) ? (int_T)r->block_ticks : (int_T)(r->ticks - b *
+    r->block_ticks);
+}
+
+void fsm_12B_trace_close(fsm_12B_TraceReader *r)
+{
+  if (r->fp != NULL) {
+    (void)fclose(r->fp);
+  }
+
+  free(r->index);
+  free(r->block);
+  free(r->scratch);
+  memset(r, 0, sizeof(fsm_12B_TraceReader));
+}
+
+/*
+ * File trailer for fsm_12B_trace.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,99 @@
+/*
+ * File: fsm_12B_trace.h
+ *
+ * Bit-packed trace container for Simulink model 'fsm_12B'.
+ *
+ * A trace is cut into blocks of block_ticks ticks.  Each block holds three
+ * planes, each stored either bit-packed or run-length encoded, whichever
+ * is smaller for that block:
+ *
+ *   inputs   nibble-plane  standby | apfail << 1 | supported << 2 |
+ *                          limits << 3
+ *   pullup   bit-plane     rtY_pullup
+ *   modes    nibble-plane  Merge | Merge_g << 2
+ *
+ * A seek index with the file offset of every block follows the last
+ * block, so reading tick k decodes at most one block whatever the length
+ * of the trace.  All integers are little-endian.
+ *
+ *   header   "F12BTRC1", uint32 version, uint32 block_ticks, uint64 ticks,
+ *            uint64 nblocks, uint64 index_offset
+ *   block    uint32 nticks, then per plane: uint8 encoding, uint32 bytes,
+ *            data
+ *   index    uint64 offset[nblocks]
+ */
+
+#ifndef fsm_12B_trace_h_
+#define fsm_12B_trace_h_
+#include <stdio.h>
+#include "rtwtypes.h"
+
+#define FSM_12B_TRACE_VERSION          1U
+#define FSM_12B_TRACE_BLOCK_TICKS      4096U
+#define FSM_12B_TRACE_MAX_BLOCK_TICKS  (1U << 24)
+
+/* One tick of a trace */
+typedef struct {
+  uint8_T inputs;                      /* input vector, 4 bits */
+  boolean_T rtY_pullup;                /* '<Root>/pullup' */
+  uint8_T Merge;                       /* '<S4>/Merge', 0..3 */
+  uint8_T Merge_g;                     /* '<S14>/Merge', 0..3 */
+} fsm_12B_TraceTick;
+
+typedef struct {
+  FILE *fp;
+  uint32_T block_ticks;
+  uint64_T ticks;
+  fsm_12B_TraceTick *block;            /* ticks of the open block */
+  uint32_T fill;
+  uint64_T *index;                     /* block offsets */
+  uint64_T nblocks;
+  uint64_T index_capacity;
+  uint64_T pos;                        /* file offset of the next block */
+  uint8_T *scratch;                    /* plane symbols and encodings */
+  boolean_T failed;                    /* a block write failed */
+} fsm_12B_TraceWriter;
+
+typedef struct {
+  FILE *fp;
+  uint32_T block_ticks;
+  uint64_T ticks;
+  uint64_T *index;
+  uint64_T nblocks;
+  fsm_12B_TraceTick *block;            /* decoded block cache */
+  uint64_T cached;                     /* cached block number, or nblocks */
+  uint8_T *scratch;
+} fsm_12B_TraceReader;
+
+/*
+ * Writer, all functions return 0 on success and -1 on failure.  Once a
+ * block fails to be written, every further append fails as well.
+ * block_ticks is 0 for the default or at most FSM_12B_TRACE_MAX_BLOCK_TICKS,
+ * and the reader rejects files with larger blocks.
+ */
+extern int_T fsm_12B_trace_create(fsm_12B_TraceWriter *w, const char_T *path,
+  uint32_T block_ticks);
+extern int_T fsm_12B_trace_append(fsm_12B_TraceWriter *w, const
+  fsm_12B_TraceTick *tick);
+extern int_T fsm_12B_trace_finish(fsm_12B_TraceWriter *w);
+
+/* Reader, random access by tick number */
+extern int_T fsm_12B_trace_open(fsm_12B_TraceReader *r, const char_T *path);
+extern int_T fsm_12B_trace_read(fsm_12B_TraceReader *r, uint64_T tick,
+  fsm_12B_TraceTick *out);
+
+/*
+ * Ticks of block b, valid until the next read.  Returns their number, or
+ * -1 on failure.
+ */
+extern int_T fsm_12B_trace_read_block(fsm_12B_TraceReader *r, uint64_T b,
+  const fsm_12B_TraceTick **ticks);
+extern void fsm_12B_trace_close(fsm_12B_TraceReader *r);
+
+#endif                                 /* fsm_12B_trace_h_ */
+
+/*
+ * File trailer for fsm_12B_trace.h
+ *
+ * [EOF]
+ */
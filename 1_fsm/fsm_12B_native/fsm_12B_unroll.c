@@ -0,0 +1,321 @@
+/*
+ * File: fsm_12B_unroll.c
+ *
+ * Requirement parsing and harness generation of fsm_12B_unroll.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_domain.h"
+#include "fsm_12B_unroll.h"
+#include "fsm_12B_verify.h"
+#include "rtwtypes.h"
+
+/* The state of the model, arbitrary in the step case */
+static const char_T *const fsm_12B_unroll_state[9][2] = { { "rtDW.Merge",
+    "double" }, { "rtDW.Merge_g", "double" }, { "rtDW.UnitDelay_DSTATE",
+    "double" }, { "rtDW.UnitDelay1_DSTATE", "double" }, { "rtDW.Merge_p[0]",
+    "bool" }, { "rtDW.Merge_p[1]", "bool" }, { "rtDW.Merge_p[2]", "bool" }, {
+    "rtDW.UnitDelay2_DSTATE", "bool" }, { "rtY_pullup", "bool" } };
+
+static const char_T *const fsm_12B_unroll_inputs[5] = { "OverrunFlag",
+  "rtU_standby", "rtU_apfail", "rtU_supported", "rtU_limits" };
+
+static char_T *dup_range(const char_T *p, size_t n)
+{
+  char_T *s;
+  while ((n > 0U) && ((p[0] == ' ') || (p[0] == '\t') || (p[0] == '\n') ||
+                      (p[0] == '\r'))) {
+    p++;
+    n--;
+  }
+
+  while ((n > 0U) && ((p[n - 1U] == ' ') || (p[n - 1U] == '\t') || (p[n - 1U]
+           == '\n') || (p[n - 1U] == '\r'))) {
+    n--;
+  }
+
+  s = (char_T *)malloc(n + 1U);
+  if (s != NULL) {
+    memcpy(s, p, n);
+    s[n] = '\0';
+  }
+
+  return s;
+}
+
+/* *dst = *dst sep src, or src when *dst is NULL */
+static int_T append(char_T **dst, const char_T *sep, const char_T *src)
+{
+  const size_t n = (*dst != NULL) ? strlen(*dst) + strlen(sep) : 0U;
+  char_T *s = (char_T *)realloc(*dst, n + strlen(src) + 1U);
+  if (s == NULL) {
+    return -1;
+  }
+
+  if (*dst == NULL) {
+    s[0] = '\0';
+  } else {
+    strcat(s, sep);
+  }
+
+  strcat(s, src);
+  *dst = s;
+  return 0;
+}
+
+/*
+ * Copy of t[0..n) with comments blanked out.  The text of the first //
+ * comment goes to *title.
+ */
+static char_T *strip(const char_T *t, size_t n, char_T **title)
+{
+  char_T *s = (char_T *)malloc(n + 1U);
+  size_t i = 0U;
+  if (s == NULL) {
+    return NULL;
+  }
+
+  memcpy(s, t, n);
+  s[n] = '\0';
+  while (i < n) {
+    if ((s[i] == '"') || (s[i] == '\'')) {
+      const char_T quote = s[i++];
+      while ((i < n) && (s[i] != quote) && (s[i] != '\n')) {
+        i += (s[i] == '\\') ? 2U : 1U;
+      }
+
+      i++;
+    } else if ((s[i] == '/') && (i + 1U < n) && (s[i + 1U] == '/')) {
+      const size_t from = i + 2U;
+      while ((i < n) && (s[i] != '\n')) {
+        i++;
+      }
+
+      if (*title == NULL) {
+        *title = dup_range(&t[from], i - from);
+      }
+
+      memset(&s[from - 2U], ' ', i - from + 2U);
+    } else if ((s[i] == '/') && (i + 1U < n) && (s[i + 1U] == '*')) {
+      while ((i < n) && !((s[i] == '*') && (i + 1U < n) && (s[i + 1U] == '/')))
+      {
+        if (s[i] != '\n') {
+          s[i] = ' ';
+        }
+
+        i++;
+      }
+
+      if (i < n) {
+        s[i++] = ' ';
+        s[i++] = ' ';
+      }
+    } else {
+      i++;
+    }
+  }
+
+  return s;
+}
+
+/*
+ * End of the statement that starts at i: the ';' at depth 0, outside
+ * literals.  With comma set, stops at the last ',' at depth 0 instead and
+ * returns n when there is none.
+ */
+static size_t scan(const char_T *s, size_t i, size_t n, boolean_T comma)
+{
+  size_t last = n;
+  int_T depth = 0;
+  while (i < n) {
+    const char_T c = s[i];
+    if ((c == '"') || (c == '\'')) {
+      i++;
+      while ((i < n) && (s[i] != c)) {
+        i += (s[i] == '\\') ? 2U : 1U;
+      }
+    } else if ((c == '(') || (c == '[') || (c == '{')) {
+      depth++;
+    } else if ((c == ')') || (c == ']') || (c == '}')) {
+      depth--;
+    } else if ((depth == 0) && (c == ',') && comma) {
+      last = i;
+    } else if ((depth == 0) && (c == ';') && !comma) {
+      return i;
+    }
+
+    i++;
+  }
+
+  return comma ? last : n;
+}
+
+/* Arguments of "name(args)" in statement st, or NULL */
+static const char_T *call_args(const char_T *st, const char_T *name, size_t
+  *len)
+{
+  const size_t n = strlen(name);
+  const char_T *p = st + n;
+  const char_T *end;
+  if (strncmp(st, name, n) != 0) {
+    return NULL;
+  }
+
+  while ((*p == ' ') || (*p == '\t') || (*p == '\n') || (*p == '\r')) {
+    p++;
+  }
+
+  end = strrchr(p, ')');
+  if ((*p != '(') || (end == NULL)) {
+    return NULL;
+  }
+
+  *len = (size_t)(end - p - 1);
+  return p + 1;
+}
+
+int_T fsm_12B_unroll_parse(const fsm_12B_Harness *h, int_T i,
+  fsm_12B_UnrollReq *r)
+{
+  const fsm_12B_Branch *b = &h->branch[i];
+  const size_t n = b->close - b->open - 1U;
+  char_T *s;
+  size_t pos = 0U;
+  int_T rc = 0;
+  memset(r, 0, sizeof(fsm_12B_UnrollReq));
+  r->value = b->value;
+  s = strip(&h->text[b->open + 1U], n, &r->title);
+  if (s == NULL) {
+    return -1;
+  }
+
+  while ((pos < n) && (rc == 0)) {
+    const size_t end = scan(s, pos, n, false);
+    char_T *st = dup_range(&s[pos], end - pos);
+    const char_T *args;
+    size_t len;
+    pos = end + 1U;
+    if (st == NULL) {
+      rc = -1;
+    } else if (st[0] == '\0') {
+      /* empty statement */
+    } else if ((args = call_args(st, "__ESBMC_assume", &len)) != NULL) {
+      char_T *cond = dup_range(args, len);
+      rc = ((cond == NULL) || (append(&r->assume, ") && (", cond) != 0)) ? -1 :
+        0;
+      free(cond);
+    } else if ((args = call_args(st, "__ESBMC_assert", &len)) != NULL) {
+      const size_t comma = scan(args, 0U, len, true);
+      if ((r->assertion != NULL) || (comma == len)) {
+        rc = -1;
+      } else {
+        r->assertion = dup_range(args, comma);
+        r->message = dup_range(&args[comma + 1U], len - comma - 1U);
+      }
+    } else {
+      rc = append(&r->step, ";\n  ", st);
+    }
+
+    free(st);
+  }
+
+  free(s);
+  if ((rc != 0) || (r->assertion == NULL) || (r->message == NULL) ||
+      (r->step == NULL)) {
+    fsm_12B_unroll_free(r);
+    return -1;
+  }
+
+  return 0;
+}
+
+void fsm_12B_unroll_free(fsm_12B_UnrollReq *r)
+{
+  free(r->title);
+  free(r->assume);
+  free(r->step);
+  free(r->assertion);
+  free(r->message);
+  memset(r, 0, sizeof(fsm_12B_UnrollReq));
+}
+
+int_T fsm_12B_unroll_write(FILE *out, const fsm_12B_UnrollReq *r,
+  fsm_12B_UnrollKind kind, int_T k, const fsm_12B_Domain *domain, const char_T
+  *name)
+{
+  int_T t;
+  int_T i;
+  fprintf(out, "/*\n * File: %s\n *\n", name);
+  if (kind == FSM_12B_UNROLL_BASE) {
+    fprintf(out, " * Base case of k-induction, k = %d: requirement %d on %d "
+            "ticks from\n * fsm_12B_initialize.\n", k, r->value, k);
+  } else {
+    fprintf(out, " * Inductive step of k-induction, k = %d: requirement %d "
+            "holds on %d ticks\n * from an arbitrary state, and so on the "
+            "next one.\n", k, r->value, k);
+  }
+
+  fprintf(out, " *\n *   %s\n *\n * Generated by unroll; do not edit.\n */\n\n",
+          (r->title != NULL) ? r->title : "");
+  fprintf(out, "#include \"fsm_12B.h\"\n\n_Bool nondet_bool();\n"
+          "double nondet_double();\n\nstatic RT_MODEL rtM_;\n"
+          "static DW rtDW;                        /* Observable states */\n");
+  for (i = 0; i < 5; i++) {
+    fprintf(out, "static boolean_T %s;\n", fsm_12B_unroll_inputs[i]);
+  }
+
+  fprintf(out, "static boolean_T rtY_pullup;\n\n"
+          "/* One rt_OneStep with fresh inputs; returns the property of the "
+          "tick */\nstatic boolean_T tick(RT_MODEL *const rtM)\n{\n"
+          "  boolean_T pre;\n");
+  for (i = 0; i < 5; i++) {
+    fprintf(out, "  %s = nondet_bool();\n", fsm_12B_unroll_inputs[i]);
+  }
+
+  fprintf(out, "  if (OverrunFlag) {\n    return true;\n  }\n\n"
+          "  pre = (%s);\n  %s;\n  return !pre || (%s);\n}\n\n",
+          (r->assume != NULL) ? r->assume : "true", r->step, r->assertion);
+  fprintf(out, "int_T main(int_T argc, const char *argv[])\n{\n"
+          "  RT_MODEL *const rtM = &rtM_;\n  (void)(argc);\n  (void)(argv);\n"
+          "  rtM->dwork = &rtDW;\n");
+  if (kind == FSM_12B_UNROLL_BASE) {
+    fprintf(out, "  fsm_12B_initialize(rtM);\n");
+    for (t = 1; t <= k; t++) {
+      fprintf(out, "  __ESBMC_assert(tick(rtM), %s \" (tick %d of %d)\");\n",
+              r->message, t, k);
+    }
+  } else {
+    for (i = 0; i < 9; i++) {
+      const char_T *lvalue = fsm_12B_unroll_state[i][0];
+      const int_T f = (domain != NULL) ? fsm_12B_domain_find(domain, &lvalue[5])
+        : -1;
+      char_T line[2048];
+      if ((f >= 0) && (fsm_12B_domain_format(domain, f, lvalue, line, sizeof
+            (line)) < (int_T)sizeof(line))) {
+        fprintf(out, "  %s\n", line);
+      } else {
+        fprintf(out, "  %s = nondet_%s();\n", lvalue,
+                fsm_12B_unroll_state[i][1]);
+      }
+    }
+
+    for (t = 1; t <= k; t++) {
+      fprintf(out, "  __ESBMC_assume(tick(rtM));\n");
+    }
+
+    fprintf(out, "  __ESBMC_assert(tick(rtM), %s \" (inductive step, k = %d)"
+            "\");\n", r->message, k);
+  }
+
+  fprintf(out, "  return 0;\n}\n\n/*\n * File trailer for %s\n *\n"
+          " * [EOF]\n */\n", name);
+  return ferror(out) ? -1 : 0;
+}
+
+/*
+ * File trailer for fsm_12B_unroll.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,65 @@
+/*
+ * File: fsm_12B_unroll.h
+ *
+ * k-step unrolled harnesses for the requirements of
+ * 1_fsm/fsm_12B_ert_rtw/ert_main.c.
+ *
+ * A requirement is read back from its "sit == k" branch: the condition of
+ * __ESBMC_assume, the fsm_12B_step call and the condition and message of
+ * __ESBMC_assert.  Property P of one tick is "assume before the step
+ * implies the assertion after it"; a tick with OverrunFlag set skips the
+ * step, as rt_OneStep does, and satisfies P.
+ *
+ * The base harness runs k ticks from fsm_12B_initialize with fresh nondet
+ * inputs each tick and asserts P on every one.  The step harness starts
+ * from an arbitrary DW, assumes P on k ticks and asserts it on tick k + 1.
+ * When both hold, P holds on every tick of every run (k-induction).
+ */
+
+#ifndef fsm_12B_unroll_h_
+#define fsm_12B_unroll_h_
+#include <stdio.h>
+#include "rtwtypes.h"
+#include "fsm_12B_domain.h"
+#include "fsm_12B_verify.h"
+
+typedef enum {
+  FSM_12B_UNROLL_BASE = 0,
+  FSM_12B_UNROLL_STEP
+} fsm_12B_UnrollKind;
+
+/* One requirement branch, all strings malloc'ed */
+typedef struct {
+  int_T value;                         /* k of sit == k */
+  char_T *title;                       /* first // comment of the branch */
+  char_T *assume;                      /* conditions of __ESBMC_assume */
+  char_T *step;                        /* the other statements */
+  char_T *assertion;                   /* condition of __ESBMC_assert */
+  char_T *message;                     /* its message, a string literal */
+} fsm_12B_UnrollReq;
+
+/*
+ * Read branch i of a split harness into r.  Several assumptions are joined
+ * with &&.  Returns 0, or -1 when the branch has no assertion or cannot be
+ * parsed.
+ */
+extern int_T fsm_12B_unroll_parse(const fsm_12B_Harness *h, int_T i,
+  fsm_12B_UnrollReq *r);
+extern void fsm_12B_unroll_free(fsm_12B_UnrollReq *r);
+
+/*
+ * Write the base or the step harness of r for k ticks; 0 or -1.  With a
+ * domain, the real_T fields of the arbitrary state in the step case are
+ * drawn from it instead of from every double.
+ */
+extern int_T fsm_12B_unroll_write(FILE *out, const fsm_12B_UnrollReq *r,
+  fsm_12B_UnrollKind kind, int_T k, const fsm_12B_Domain *domain, const char_T
+  *name);
+
+#endif                                 /* fsm_12B_unroll_h_ */
+
+/*
+ * File trailer for fsm_12B_unroll.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,93 @@
+/*
+ * File: fsm_12B_util.c
+ *
+ * Small helpers shared by the command-line tools of model 'fsm_12B'.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "fsm_12B_util.h"
+
+char_T *fsm_12B_slurp(const char_T *path, size_t *len)
+{
+  FILE *fp = fopen(path, "rb");
+  char_T *buf = NULL;
+  size_t cap = 0U;
+  size_t n = 0U;
+  size_t got;
+  if (fp == NULL) {
+    return NULL;
+  }
+
+  do {
+    if (cap - n < 4096U) {
+      char_T *grown = (char_T *)realloc(buf, 2U * cap + 4096U + 1U);
+      if (grown == NULL) {
+        free(buf);
+        (void)fclose(fp);
+        return NULL;
+      }
+
+      buf = grown;
+      cap = 2U * cap + 4096U;
+    }
+
+    got = fread(&buf[n], 1, cap - n, fp);
+    n += got;
+  } while (got > 0U);
+
+  (void)fclose(fp);
+  buf[n] = '\0';
+  *len = n;
+  return buf;
+}
+
+boolean_T fsm_12B_selected(const char_T *list, int_T k)
+{
+  const char_T *p = list;
+  if (list == NULL) {
+    return true;
+  }
+
+  while (*p != '\0') {
+    char_T *end;
+    const long lo = strtol(p, &end, 10);
+    long hi = lo;
+    if (end == p) {
+      return false;
+    }
+
+    p = end;
+    if (*p == '-') {
+      hi = strtol(p + 1, &end, 10);
+      p = end;
+    }
+
+    if ((k >= lo) && (k <= hi)) {
+      return true;
+    }
+
+    if (*p == ',') {
+      p++;
+    } else {
+      break;
+    }
+  }
+
+  return false;
+}
+
+real_T fsm_12B_now_sec(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (real_T)ts.tv_sec + 1.0e-9 * (real_T)ts.tv_nsec;
+}
+
+/*
+ * File trailer for fsm_12B_util.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,29 @@
+/*
+ * File: fsm_12B_util.h
+ *
+ * Small helpers shared by the command-line tools of model 'fsm_12B':
+ * whole-file reads, requirement lists such as 1,3,7-9 and a monotonic
+ * clock.
+ */
+
+#ifndef fsm_12B_util_h_
+#define fsm_12B_util_h_
+#include <stddef.h>
+#include "rtwtypes.h"
+
+/* Malloc'ed contents of path, NUL-terminated, or NULL; *len gets its size */
+extern char_T *fsm_12B_slurp(const char_T *path, size_t *len);
+
+/* Is k in a list such as 1,3,7-9 (NULL selects everything)? */
+extern boolean_T fsm_12B_selected(const char_T *list, int_T k);
+
+/* Seconds on the monotonic clock */
+extern real_T fsm_12B_now_sec(void);
+
+#endif                                 /* fsm_12B_util_h_ */
+
+/*
+ * File trailer for fsm_12B_util.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,659 @@
+/*
+ * File: fsm_12B_verify.c
+ *
+ * Harness splitting, the job runner and the verdict cache of
+ * fsm_12B_verify.h.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "fsm_12B_util.h"
+#include "fsm_12B_verify.h"
+#include "rtwtypes.h"
+
+#define MAX_PARALLEL                   256
+#define LOG_CHUNK                      65536
+#define LOG_OVERLAP                    64
+
+const char_T *const fsm_12B_verify_verdict_name[FSM_12B_VERIFY_VERDICTS] = {
+  "-", "PASS", "FAIL", "UNKNOWN", "TIMEOUT", "MEMOUT", "ERROR" };
+
+/*===========*
+ * Splitting *
+ *===========*/
+static boolean_T is_ident(char_T c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >=
+    '0') && (c <= '9')) || (c == '_');
+}
+
+/* Skip white space, comments and preprocessor lines */
+static size_t skip_blank(const char_T *t, size_t n, size_t i)
+{
+  while (i < n) {
+    if ((t[i] == ' ') || (t[i] == '\t') || (t[i] == '\n') || (t[i] == '\r') ||
+        (t[i] == '\f') || (t[i] == '\v')) {
+      i++;
+    } else if ((t[i] == '/') && (i + 1U < n) && (t[i + 1U] == '/')) {
+      while ((i < n) && (t[i] != '\n')) {
+        i++;
+      }
+    } else if ((t[i] == '/') && (i + 1U < n) && (t[i + 1U] == '*')) {
+      i += 2U;
+      while ((i + 1U < n) && !((t[i] == '*') && (t[i + 1U] == '/'))) {
+        i++;
+      }
+
+      i = (i + 2U < n) ? i + 2U : n;
+    } else {
+      break;
+    }
+  }
+
+  return i;
+}
+
+/* Index after the string or character literal that starts at i */
+static size_t skip_literal(const char_T *t, size_t n, size_t i)
+{
+  const char_T quote = t[i++];
+  while ((i < n) && (t[i] != quote) && (t[i] != '\n')) {
+    i += (t[i] == '\\') ? 2U : 1U;
+  }
+
+  return (i < n) ? i + 1U : n;
+}
+
+/* Index after the bracket that matches the one at i, or n */
+static size_t match(const char_T *t, size_t n, size_t i)
+{
+  const char_T open = t[i];
+  const char_T close = (open == '(') ? ')' : '}';
+  int_T depth = 0;
+  while (i < n) {
+    const size_t j = skip_blank(t, n, i);
+    if (j != i) {
+      i = j;
+      continue;
+    }
+
+    if ((t[i] == '"') || (t[i] == '\'')) {
+      i = skip_literal(t, n, i);
+      continue;
+    }
+
+    if (t[i] == open) {
+      depth++;
+    } else if ((t[i] == close) && (--depth == 0)) {
+      return i + 1U;
+    }
+
+    i++;
+  }
+
+  return n;
+}
+
+/* Is the keyword word at i (and not part of a longer identifier)? */
+static boolean_T keyword(const char_T *t, size_t n, size_t i, const char_T
+  *word)
+{
+  const size_t len = strlen(word);
+  return (i + len <= n) && (strncmp(&t[i], word, len) == 0) && ((i == 0U) ||
+    !is_ident(t[i - 1U])) && ((i + len == n) || !is_ident(t[i + len]));
+}
+
+/*
+ * Parse "( var == value )" starting at the '(' at i.  Returns true and the
+ * value when the condition has exactly that form.
+ */
+static boolean_T condition(const char_T *t, size_t n, size_t i, const char_T
+  *var, int_T *value)
+{
+  const size_t len = strlen(var);
+  boolean_T negative = false;
+  long v = 0;
+  i = skip_blank(t, n, i + 1U);
+  if (!keyword(t, n, i, var)) {
+    return false;
+  }
+
+  i = skip_blank(t, n, i + len);
+  if ((i + 2U > n) || (t[i] != '=') || (t[i + 1U] != '=')) {
+    return false;
+  }
+
+  i = skip_blank(t, n, i + 2U);
+  if ((i < n) && (t[i] == '-')) {
+    negative = true;
+    i = skip_blank(t, n, i + 1U);
+  }
+
+  if ((i >= n) || (t[i] < '0') || (t[i] > '9')) {
+    return false;
+  }
+
+  while ((i < n) && (t[i] >= '0') && (t[i] <= '9') && (v < 100000000L)) {
+    v = 10 * v + (t[i++] - '0');
+  }
+
+  i = skip_blank(t, n, i);
+  if ((i >= n) || (t[i] != ')')) {
+    return false;
+  }
+
+  *value = (int_T)(negative ? -v : v);
+  return true;
+}
+
+int_T fsm_12B_verify_split(fsm_12B_Harness *h, const char_T *text, size_t len,
+  const char_T *var)
+{
+  const char_T *t = text;
+  const size_t n = len;
+  size_t i = 0U;
+  int_T value;
+  memset(h, 0, sizeof(fsm_12B_Harness));
+  h->text = text;
+  h->len = len;
+
+  /* The first "if (var == k)" outside comments and literals */
+  for (;;) {
+    i = skip_blank(t, n, i);
+    if (i >= n) {
+      return -1;
+    }
+
+    if ((t[i] == '"') || (t[i] == '\'')) {
+      i = skip_literal(t, n, i);
+    } else if (keyword(t, n, i, "if")) {
+      const size_t p = skip_blank(t, n, i + 2U);
+      if ((p < n) && (t[p] == '(') && condition(t, n, p, var, &value)) {
+        break;
+      }
+
+      i += 2U;
+    } else {
+      i++;
+    }
+  }
+
+  /*
+   * The chain: if (cond) { } [else if (cond) { }]... [else { }].  Branches
+   * on anything other than var == k are kept in the chain but never
+   * selected.
+   */
+  h->begin = i;
+  for (;;) {
+    size_t p = skip_blank(t, n, i + 2U);
+    const boolean_T selectable = condition(t, n, p, var, &value);
+    const size_t body = skip_blank(t, n, match(t, n, p));
+    if ((body >= n) || (t[body] != '{')) {
+      return -1;
+    }
+
+    h->end = match(t, n, body);
+    if (selectable) {
+      if (h->nbranches == FSM_12B_VERIFY_MAX_BRANCHES) {
+        return -1;
+      }
+
+      h->branch[h->nbranches].value = value;
+      h->branch[h->nbranches].open = body;
+      h->branch[h->nbranches].close = h->end - 1U;
+      h->nbranches++;
+    }
+
+    p = skip_blank(t, n, h->end);
+    if (!keyword(t, n, p, "else")) {
+      break;
+    }
+
+    p = skip_blank(t, n, p + 4U);
+    if (keyword(t, n, p, "if")) {
+      i = p;
+      continue;
+    }
+
+    if ((p >= n) || (t[p] != '{')) {
+      return -1;
+    }
+
+    h->end = match(t, n, p);
+    break;
+  }
+
+  return h->nbranches;
+}
+
+char_T *fsm_12B_verify_harness(const fsm_12B_Harness *h, int_T i, size_t *len)
+{
+  const fsm_12B_Branch *b = &h->branch[i];
+  char_T *out = (char_T *)malloc(h->len + 1U);
+  size_t n = 0U;
+  size_t j;
+  if (out == NULL) {
+    return NULL;
+  }
+
+  memcpy(out, h->text, h->begin);
+  n = h->begin;
+  for (j = h->begin; j < h->end; j++) {
+    if ((j >= b->open) && (j <= b->close)) {
+      out[n++] = h->text[j];
+    } else if (h->text[j] == '\n') {
+      out[n++] = '\n';
+    }
+  }
+
+  memcpy(&out[n], &h->text[h->end], h->len - h->end);
+  n += h->len - h->end;
+  out[n] = '\0';
+  if (len != NULL) {
+    *len = n;
+  }
+
+  return out;
+}
+
+/*========*
+ * Runner *
+ *========*/
+/* Which of the needles occur in the file, as a bit mask */
+static uint32_T log_scan(const char_T *path, const char_T *const *needle,
+  int_T nneedles)
+{
+  static char_T buf[LOG_OVERLAP + LOG_CHUNK + 1];
+  FILE *fp = fopen(path, "rb");
+  uint32_T found = 0U;
+  size_t keep = 0U;
+  size_t got;
+  if (fp == NULL) {
+    return 0U;
+  }
+
+  /* Chunks overlap so that a needle can straddle two of them */
+  while ((got = fread(&buf[keep], 1, LOG_CHUNK, fp)) > 0U) {
+    const size_t total = keep + got;
+    int_T k;
+    buf[total] = '\0';
+    for (k = 0; k < nneedles; k++) {
+      if (strstr(buf, needle[k]) != NULL) {
+        found |= 1U << k;
+      }
+    }
+
+    keep = (total < LOG_OVERLAP) ? total : LOG_OVERLAP;
+    memmove(buf, &buf[total - keep], keep);
+  }
+
+  (void)fclose(fp);
+  return found;
+}
+
+fsm_12B_VerifyVerdict fsm_12B_verify_verdict(const fsm_12B_VerifyJob *job,
+  boolean_T timed_out)
+{
+  static const char_T *const needle[5] = { "VERIFICATION SUCCESSFUL",
+    "VERIFICATION FAILED", "VERIFICATION UNKNOWN", "bad_alloc",
+    "ut of memory" };
+
+  const uint32_T found = log_scan(job->log, needle, 5);
+  if ((found & 2U) != 0U) {
+    return FSM_12B_VERIFY_FAIL;
+  }
+
+  if ((found & 1U) != 0U) {
+    return FSM_12B_VERIFY_PASS;
+  }
+
+  if (timed_out) {
+    return FSM_12B_VERIFY_TIMEOUT;
+  }
+
+  if ((found & 24U) != 0U) {
+    return FSM_12B_VERIFY_MEMOUT;
+  }
+
+  return ((found & 4U) != 0U) ? FSM_12B_VERIFY_UNKNOWN :
+    FSM_12B_VERIFY_ERROR;
+}
+
+pid_t fsm_12B_verify_start(const fsm_12B_VerifyJob *job, uint64_T mem_mib,
+  fsm_12B_VerifyHook hook, void *arg)
+{
+  const int fd = open(job->log, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  pid_t pid;
+  if (fd < 0) {
+    return -1;
+  }
+
+  pid = fork();
+  if (pid == 0) {
+    (void)setpgid(0, 0);
+    (void)dup2(fd, STDOUT_FILENO);
+    (void)dup2(fd, STDERR_FILENO);
+    (void)close(fd);
+    (void)close(STDIN_FILENO);
+    if ((hook != NULL) && (hook(arg) != 0)) {
+      _exit(126);
+    }
+
+    if (mem_mib != 0U) {
+      struct rlimit rl;
+      rl.rlim_cur = (rlim_t)(mem_mib << 20);
+      rl.rlim_max = rl.rlim_cur;
+      (void)setrlimit(RLIMIT_AS, &rl);
+    }
+
+    execvp(job->argv[0], job->argv);
+    fprintf(stderr, "cannot run %s: %s\n", job->argv[0], strerror(errno));
+    _exit(127);
+  }
+
+  /* Also from the parent, so that kill(-pid) cannot race the child */
+  if (pid > 0) {
+    (void)setpgid(pid, pid);
+  }
+
+  (void)close(fd);
+  return pid;
+}
+
+int_T fsm_12B_verify_poll(pid_t pid, real_T t0, real_T timeout, boolean_T
+  stop, boolean_T *killed, int *status, struct rusage *ru)
+{
+  const pid_t r = wait4(pid, status, WNOHANG, ru);
+  if (r == pid) {
+    return 1;
+  }
+
+  if ((r < 0) && (errno != EINTR)) {
+    *status = 0;
+    memset(ru, 0, sizeof(struct rusage));
+    return -1;
+  }
+
+  if (!*killed && (stop || ((timeout > 0.0) && (fsm_12B_now_sec() - t0 >
+         timeout)))) {
+    (void)kill(-pid, SIGKILL);
+    *killed = true;
+  }
+
+  return 0;
+}
+
+void fsm_12B_verify_run(fsm_12B_VerifyJob *jobs, int_T n, int_T parallel,
+  real_T timeout, uint64_T mem_mib, volatile int_T *stop)
+{
+  pid_t pid[MAX_PARALLEL];
+  int_T slot_job[MAX_PARALLEL];
+  real_T t0[MAX_PARALLEL];
+  boolean_T killed[MAX_PARALLEL];
+  int_T running = 0;
+  int_T next = 0;
+  int_T s;
+  if (parallel < 1) {
+    parallel = 1;
+  } else if (parallel > MAX_PARALLEL) {
+    parallel = MAX_PARALLEL;
+  }
+
+  for (s = 0; s < parallel; s++) {
+    pid[s] = 0;
+  }
+
+  while ((next < n) || (running > 0)) {
+    struct timespec nap = { 0, 10000000L };
+
+    /* Fill the free slots */
+    for (s = 0; (s < parallel) && (next < n) && !*stop; s++) {
+      if (pid[s] == 0) {
+        fsm_12B_VerifyJob *job = &jobs[next];
+        job->verdict = FSM_12B_VERIFY_NONE;
+        job->seconds = 0.0;
+        job->peak_kib = 0U;
+        job->status = 0;
+        t0[s] = fsm_12B_now_sec();
+        pid[s] = fsm_12B_verify_start(job, mem_mib, NULL, NULL);
+        if (pid[s] < 0) {
+          job->verdict = FSM_12B_VERIFY_ERROR;
+          pid[s] = 0;
+        } else {
+          slot_job[s] = next;
+          killed[s] = false;
+          running++;
+        }
+
+        next++;
+      }
+    }
+
+    if (*stop && (next < n)) {
+      next = n;
+    }
+
+    /* Reap the finished jobs, kill the late ones */
+    for (s = 0; s < parallel; s++) {
+      struct rusage ru;
+      int status;
+      int_T r;
+      if (pid[s] == 0) {
+        continue;
+      }
+
+      r = fsm_12B_verify_poll(pid[s], t0[s], timeout, *stop != 0, &killed[s],
+        &status, &ru);
+      if (r > 0) {
+        fsm_12B_VerifyJob *job = &jobs[slot_job[s]];
+        job->seconds = fsm_12B_now_sec() - t0[s];
+        job->peak_kib = (uint64_T)ru.ru_maxrss;
+        job->status = status;
+        job->verdict = fsm_12B_verify_verdict(job, killed[s]);
+        if ((job->verdict == FSM_12B_VERIFY_ERROR) && (mem_mib != 0U) &&
+            WIFSIGNALED(status) && !killed[s]) {
+          /* A failed allocation under the cap often ends in a signal */
+          job->verdict = FSM_12B_VERIFY_MEMOUT;
+        }
+
+        /* Whatever the group leader left behind */
+        (void)kill(-pid[s], SIGKILL);
+        pid[s] = 0;
+        running--;
+      } else if (r < 0) {
+        jobs[slot_job[s]].verdict = FSM_12B_VERIFY_ERROR;
+        pid[s] = 0;
+        running--;
+      }
+    }
+
+    if (running > 0) {
+      (void)nanosleep(&nap, NULL);
+    }
+  }
+}
+
+/*=======*
+ * Cache *
+ *=======*/
+static int_T copy_file(const char_T *from, const char_T *to)
+{
+  static char_T buf[LOG_CHUNK];
+  FILE *in = fopen(from, "rb");
+  FILE *out = (in != NULL) ? fopen(to, "wb") : NULL;
+  int_T rc = 0;
+  size_t got;
+  if (out == NULL) {
+    if (in != NULL) {
+      (void)fclose(in);
+    }
+
+    return -1;
+  }
+
+  while ((got = fread(buf, 1, sizeof(buf), in)) > 0U) {
+    if (fwrite(buf, 1, got, out) != got) {
+      rc = -1;
+      break;
+    }
+  }
+
+  (void)fclose(in);
+  if (fclose(out) != 0) {
+    rc = -1;
+  }
+
+  return rc;
+}
+
+int_T fsm_12B_verify_cache_get(const char_T *dir, const char_T *key,
+  fsm_12B_VerifyVerdict *verdict, real_T *seconds, char_T *log, size_t size)
+{
+  char_T path[4096];
+  char_T name[32];
+  FILE *fp;
+  int_T v;
+  (void)snprintf(path, sizeof(path), "%s/%s", dir, key);
+  fp = fopen(path, "r");
+  if (fp == NULL) {
+    return -1;
+  }
+
+  if (fscanf(fp, "%31s %lf", name, seconds) != 2) {
+    (void)fclose(fp);
+    return -1;
+  }
+
+  (void)fclose(fp);
+  for (v = FSM_12B_VERIFY_PASS; v < FSM_12B_VERIFY_VERDICTS; v++) {
+    if (strcmp(name, fsm_12B_verify_verdict_name[v]) == 0) {
+      break;
+    }
+  }
+
+  if (v == FSM_12B_VERIFY_VERDICTS) {
+    return -1;
+  }
+
+  *verdict = (fsm_12B_VerifyVerdict)v;
+  (void)snprintf(log, size, "%s/%s.log", dir, key);
+  return 0;
+}
+
+int_T fsm_12B_verify_cache_put(const char_T *dir, const char_T *key,
+  fsm_12B_VerifyVerdict verdict, real_T seconds, const char_T *log)
+{
+  char_T path[4096];
+  char_T tmp[4096];
+  FILE *fp;
+  (void)mkdir(dir, 0755);
+
+  /* The log first: a verdict without its log would be a broken entry */
+  (void)snprintf(tmp, sizeof(tmp), "%s/%s.log.%ld", dir, key, (long)getpid());
+  (void)snprintf(path, sizeof(path), "%s/%s.log", dir, key);
+  if ((copy_file(log, tmp) != 0) || (rename(tmp, path) != 0)) {
+    (void)remove(tmp);
+    return -1;
+  }
+
+  (void)snprintf(tmp, sizeof(tmp), "%s/%s.%ld", dir, key, (long)getpid());
+  (void)snprintf(path, sizeof(path), "%s/%s", dir, key);
+  fp = fopen(tmp, "w");
+  if (fp == NULL) {
+    return -1;
+  }
+
+  fprintf(fp, "%s %.3f\n", fsm_12B_verify_verdict_name[verdict], seconds);
+  if ((fclose(fp) != 0) || (rename(tmp, path) != 0)) {
+    (void)remove(tmp);
+    return -1;
+  }
+
+  return 0;
+}
+
+void fsm_12B_verify_tool_version(const char_T *esbmc, char_T *version, size_t
+  size)
+{
+  int fd[2];
+  pid_t pid;
+  FILE *fp;
+  version[0] = '\0';
+  if (pipe(fd) != 0) {
+    return;
+  }
+
+  /* Exec'ed directly, as start() does, so that the path needs no quoting */
+  pid = fork();
+  if (pid == 0) {
+    (void)dup2(fd[1], STDOUT_FILENO);
+    (void)dup2(fd[1], STDERR_FILENO);
+    (void)close(fd[0]);
+    (void)close(fd[1]);
+    (void)close(STDIN_FILENO);
+    execlp(esbmc, esbmc, "--version", (char_T *)NULL);
+    _exit(127);
+  }
+
+  (void)close(fd[1]);
+  fp = (pid > 0) ? fdopen(fd[0], "r") : NULL;
+  if (fp == NULL) {
+    (void)close(fd[0]);
+  } else {
+    if (fgets(version, (int)size, fp) == NULL) {
+      version[0] = '\0';
+    }
+
+    version[strcspn(version, "\r\n")] = '\0';
+    (void)fclose(fp);
+  }
+
+  if (pid > 0) {
+    (void)waitpid(pid, NULL, 0);
+  }
+}
+
+void fsm_12B_verify_copy_trace(FILE *out, const char_T *log)
+{
+  char_T line[4096];
+  FILE *fp = fopen(log, "r");
+  boolean_T on = false;
+  if (fp == NULL) {
+    fprintf(out, "  (log %s missing)\n", log);
+    return;
+  }
+
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    if (strstr(line, "Counterexample") != NULL) {
+      on = true;
+    }
+
+    if (on) {
+      fprintf(out, "  %s", line);
+    }
+
+    if (strstr(line, "VERIFICATION FAILED") != NULL) {
+      break;
+    }
+  }
+
+  (void)fclose(fp);
+}
+
+/*
+ * File trailer for fsm_12B_verify.c
+ *
+ * [EOF]
+ */
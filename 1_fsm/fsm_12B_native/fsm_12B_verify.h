@@ -0,0 +1,155 @@
+/*
+ * File: fsm_12B_verify.h
+ *
+ * Parallel per-requirement verification of the fsm_12B harnesses.
+ *
+ * A harness such as 1_fsm/fsm_12B_ert_rtw/ert_main.c selects one of its
+ * requirements with an if / else if chain on a nondet variable,
+ * "if (sit == k) { ... }".  fsm_12B_verify_split finds that chain and
+ * fsm_12B_verify_harness writes one harness per branch, keeping only the
+ * body of branch k.  Every other line of the chain is left empty, so line
+ * numbers in a counterexample still match the original harness.
+ *
+ * fsm_12B_verify_run runs the verifier on the branches as separate
+ * processes, a bounded number at a time.  Each job gets a wall-clock
+ * timeout and an address-space cap, and its output goes to a log file
+ * from which the verdict is read.
+ *
+ * Conclusive verdicts are cached in a directory under a caller-computed
+ * key, usually the SHA-256 of the model sources, the branch harness and
+ * the verifier command line.
+ */
+
+#ifndef fsm_12B_verify_h_
+#define fsm_12B_verify_h_
+#include <stddef.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include "rtwtypes.h"
+
+#define FSM_12B_VERIFY_MAX_BRANCHES    256
+
+typedef enum {
+  FSM_12B_VERIFY_NONE = 0,             /* not run */
+  FSM_12B_VERIFY_PASS,                 /* VERIFICATION SUCCESSFUL */
+  FSM_12B_VERIFY_FAIL,                 /* VERIFICATION FAILED */
+  FSM_12B_VERIFY_UNKNOWN,              /* VERIFICATION UNKNOWN */
+  FSM_12B_VERIFY_TIMEOUT,
+  FSM_12B_VERIFY_MEMOUT,
+  FSM_12B_VERIFY_ERROR                 /* no verdict in the output */
+} fsm_12B_VerifyVerdict;
+
+#define FSM_12B_VERIFY_VERDICTS        7
+
+extern const char_T *const fsm_12B_verify_verdict_name
+  [FSM_12B_VERIFY_VERDICTS];
+
+/* One "var == value" branch, offsets into the harness text */
+typedef struct {
+  int_T value;
+  size_t open;                         /* '{' of the body */
+  size_t close;                        /* its matching '}' */
+} fsm_12B_Branch;
+
+typedef struct {
+  const char_T *text;
+  size_t len;
+  size_t begin;                        /* the whole if / else chain */
+  size_t end;
+  fsm_12B_Branch branch[FSM_12B_VERIFY_MAX_BRANCHES];
+  int_T nbranches;
+} fsm_12B_Harness;
+
+typedef struct {
+  char_T *const *argv;                 /* verifier command, NULL terminated */
+  const char_T *log;                   /* receives stdout and stderr */
+  fsm_12B_VerifyVerdict verdict;
+  real_T seconds;
+  uint64_T peak_kib;                   /* maximum resident set size */
+  int_T status;                        /* as returned by wait */
+} fsm_12B_VerifyJob;
+
+/*
+ * Find the chain of "if (var == k) { ... } else if ..." in text.  Returns
+ * the number of branches, or -1 when there is none or a branch body is not
+ * a braced block.
+ */
+extern int_T fsm_12B_verify_split(fsm_12B_Harness *h, const char_T *text,
+  size_t len, const char_T *var);
+
+/* Malloc'ed text of the harness with only branch i; *len gets its length */
+extern char_T *fsm_12B_verify_harness(const fsm_12B_Harness *h, int_T i,
+  size_t *len);
+
+/*
+ * Called in the child of fsm_12B_verify_start, with its output already
+ * going to the log, before the memory cap and the exec: 0 to go on, or -1
+ * after saying why on stderr, which ends the job with status 126.
+ */
+typedef int_T (*fsm_12B_VerifyHook)(void *arg);
+
+/*
+ * Fork and exec a job in its own process group, with stdout and stderr
+ * in its log and, for mem_mib other than 0, an address-space cap.  hook
+ * may be NULL.  Returns the pid, or -1.
+ */
+extern pid_t fsm_12B_verify_start(const fsm_12B_VerifyJob *job, uint64_T
+  mem_mib, fsm_12B_VerifyHook hook, void *arg);
+
+/*
+ * Poll a job started at t0 with fsm_12B_verify_start: 1 when it has ended,
+ * with *status and *ru; -1 when it cannot be waited for; 0 while it runs.
+ * A job past timeout seconds (0 none), or any job once stop is set, is
+ * killed with its process group and *killed set.
+ */
+extern int_T fsm_12B_verify_poll(pid_t pid, real_T t0, real_T timeout,
+  boolean_T stop, boolean_T *killed, int *status, struct rusage *ru);
+
+/*
+ * Run jobs, at most parallel at a time.  timeout is in seconds and
+ * mem_mib caps the address space of each job; 0 means no limit.  Setting
+ * *stop kills the running jobs and starts no more.
+ */
+extern void fsm_12B_verify_run(fsm_12B_VerifyJob *jobs, int_T n, int_T
+  parallel, real_T timeout, uint64_T mem_mib, volatile int_T *stop);
+
+/*
+ * Verdict of a finished job from its log; timed_out when the runner
+ * killed it.  A job killed for any other reason without a verdict in its
+ * log is an ERROR.
+ */
+extern fsm_12B_VerifyVerdict fsm_12B_verify_verdict(const fsm_12B_VerifyJob
+  *job, boolean_T timed_out);
+
+/*
+ * Cached verdict for key in dir.  Returns 0 and fills *verdict, *seconds
+ * and log (the path of the cached output, at most size bytes), or -1.
+ */
+extern int_T fsm_12B_verify_cache_get(const char_T *dir, const char_T *key,
+  fsm_12B_VerifyVerdict *verdict, real_T *seconds, char_T *log, size_t size);
+
+/* Store a verdict and a copy of its log.  Returns 0 or -1 */
+extern int_T fsm_12B_verify_cache_put(const char_T *dir, const char_T *key,
+  fsm_12B_VerifyVerdict verdict, real_T seconds, const char_T *log);
+
+/*
+ * First line of "esbmc --version" into version (at most size bytes, empty
+ * when esbmc does not run), which is part of every cache key.
+ */
+extern void fsm_12B_verify_tool_version(const char_T *esbmc, char_T *version,
+  size_t size);
+
+/*
+ * Copy the counterexample of a FAIL log to out, indented, from
+ * "Counterexample" to the verdict.
+ */
+extern void fsm_12B_verify_copy_trace(FILE *out, const char_T *log);
+
+#endif                                 /* fsm_12B_verify_h_ */
+
+/*
+ * File trailer for fsm_12B_verify.h
+ *
+ * [EOF]
+ */
@@ -0,0 +1,653 @@
+/*
+ * File: fuzz_main.c
+ *
+ * Fuzzes fsm_12B_step over sequences of ticks (fsm_12B_fuzz.h), with the
+ * requirements of ert_main.c as oracles and the mode tuples and their
+ * edges as coverage.
+ *
+ *   fuzz [-n execs] [-t seconds] [-s seed] [-l length] [-r list]
+ *        [-i seeds] [-o dir] [-a] [input...]
+ *
+ * Without inputs, a built-in coverage-guided loop mutates a corpus, read
+ * from the files in seeds, and keeps every input that produces a feature
+ * not seen before.  It stops after execs runs or seconds, or as soon as
+ * every feature reachable from fsm_12B_initialize is covered.  -o creates
+ * dir if needed and writes the corpus, minimized to the shortest inputs
+ * that still cover all its features, as dir/<hash>.bin, and the shortest
+ * input found for each violated requirement as dir/fail-<id>.bin.
+ *
+ * With inputs (files or directories), each one is run once, which replays
+ * a saved corpus as a regression suite.  -a aborts on the first violation,
+ * as AFL needs:  afl-fuzz -i seeds -o out -- ./fuzz -a @@
+ * Built with afl-clang-fast and -DFSM_12B_FUZZ_AFL, the model features
+ * are added to the AFL++ coverage map as well.  -r limits the
+ * requirements that count as violated to a list such as 1,3,7-9.
+ *
+ * Built with -DFSM_12B_FUZZ_LIBFUZZER this file provides
+ * LLVMFuzzerTestOneInput instead of main, and the model features are
+ * libFuzzer extra counters.  The requirements that crash are then taken
+ * from the environment variable FSM_12B_FUZZ_REQS (all when unset).
+ *
+ * Exit status: 0 no violation, 1 some requirement violated, 2 usage or
+ * setup error.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "fsm_12B_fuzz.h"
+#include "fsm_12B_req.h"
+#include "fsm_12B_util.h"
+#include "rtwtypes.h"
+
+#define MAX_PATH                       4096
+#define MAX_INPUT                      4096
+#define MAX_CORPUS                     8192
+
+/* First requirement of list violated in run, or -1 */
+static int_T violation(const fsm_12B_FuzzRun *run, const char_T *list)
+{
+  int_T best = -1;
+  int_T r;
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    if ((run->first[r] >= 0) && fsm_12B_selected(list,
+         fsm_12B_requirements[r].id) && ((best < 0) || (run->first[r] <
+          run->first[best]))) {
+      best = r;
+    }
+  }
+
+  return best;
+}
+
+#ifdef FSM_12B_FUZZ_AFL
+
+/* AFL++ shared memory coverage map */
+extern uint8_T *__afl_area_ptr;
+extern uint32_T __afl_map_size;
+
+static void afl_features(const fsm_12B_FuzzRun *run)
+{
+  int_T f;
+  if ((__afl_area_ptr == NULL) || (__afl_map_size == 0U)) {
+    return;
+  }
+
+  for (f = 0; f < FSM_12B_FUZZ_FEATURES; f++) {
+    if (run->hits[f] != 0U) {
+      uint8_T *cell = &__afl_area_ptr[((uint32_T)f * 2654435761U) %
+        __afl_map_size];
+      *cell = (uint8_T)(*cell + run->hits[f]);
+    }
+  }
+}
+
+#endif                                 /* FSM_12B_FUZZ_AFL */
+
+#ifdef FSM_12B_FUZZ_LIBFUZZER
+
+/*
+ * Model features, read by libFuzzer after every input.  Not static, or the
+ * compiler drops an array that is never read.
+ */
+__attribute__((section("__libfuzzer_extra_counters")))
+uint8_T fsm_12B_fuzz_counters[FSM_12B_FUZZ_FEATURES];
+
+int LLVMFuzzerTestOneInput(const unsigned char *data, size_t size)
+{
+  static fsm_12B_FuzzRun run;
+  int_T r;
+  (void)fsm_12B_fuzz_run(data, size, &run);
+  memcpy(fsm_12B_fuzz_counters, run.hits, sizeof(fsm_12B_fuzz_counters));
+  r = violation(&run, getenv("FSM_12B_FUZZ_REQS"));
+  if (r >= 0) {
+    fprintf(stderr, "fuzz: requirement %d violated at byte %d: %s\n",
+            fsm_12B_requirements[r].id, run.first[r],
+            fsm_12B_requirements[r].message);
+    abort();
+  }
+
+  return 0;
+}
+
+#else
+
+/* Inputs kept by the fuzzing loop */
+typedef struct {
+  uint8_T *data;
+  size_t len;
+} Entry;
+
+static Entry corpus[MAX_CORPUS];
+static int_T ncorpus;
+static uint8_T seen[FSM_12B_FUZZ_FEATURES];
+static uint64_T rng;
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: fuzz [-n execs] [-t seconds] [-s seed] [-l length] "
+          "[-r list]\n            [-i seeds] [-o dir] [-a] [input...]\n");
+}
+
+static uint64_T next(void)
+{
+  uint64_T z;
+
+  /* splitmix64 */
+  rng += 0x9E3779B97F4A7C15ULL;
+  z = rng;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+/* A random tick: an input vector, now and then with OverrunFlag */
+static uint8_T tick(void)
+{
+  const uint64_T z = next();
+  return (uint8_T)((z & 0x0FU) | (((z >> 8) & 0x1FU) == 0U ?
+    FSM_12B_FUZZ_OVERRUN : 0U));
+}
+
+/* Up to MAX_INPUT bytes of path; -1 when it cannot be read */
+static long read_input(const char_T *path, uint8_T *buf)
+{
+  FILE *fp = fopen(path, "rb");
+  size_t n;
+  if (fp == NULL) {
+    return -1;
+  }
+
+  n = fread(buf, 1, MAX_INPUT, fp);
+  (void)fclose(fp);
+  return (long)n;
+}
+
+/* Calls fn for path, or for every file in it when it is a directory */
+static int_T each_input(const char_T *path, void (*fn)(const char_T *path,
+  void *arg), void *arg)
+{
+  DIR *dir = opendir(path);
+  struct dirent *de;
+  if (dir == NULL) {
+    fn(path, arg);
+    return 0;
+  }
+
+  while ((de = readdir(dir)) != NULL) {
+    char_T file[MAX_PATH + 256];
+    if (de->d_name[0] == '.') {
+      continue;
+    }
+
+    (void)snprintf(file, sizeof(file), "%s/%s", path, de->d_name);
+    fn(file, arg);
+  }
+
+  (void)closedir(dir);
+  return 0;
+}
+
+/* Counts the features of run that are new; marks them seen */
+static int_T novel(const fsm_12B_FuzzRun *run, uint8_T *covered)
+{
+  int_T count = 0;
+  int_T f;
+  for (f = 0; f < FSM_12B_FUZZ_FEATURES; f++) {
+    if ((run->hits[f] != 0U) && (covered[f] == 0U)) {
+      covered[f] = 1U;
+      count++;
+    }
+  }
+
+  return count;
+}
+
+static void add(const uint8_T *data, size_t len)
+{
+  Entry *e;
+  if (ncorpus >= MAX_CORPUS) {
+    return;
+  }
+
+  e = &corpus[ncorpus];
+  e->data = (uint8_T *)malloc(len + 1U);
+  if (e->data != NULL) {
+    memcpy(e->data, data, len);
+    e->len = len;
+    ncorpus++;
+  }
+}
+
+static void hex(FILE *out, const uint8_T *data, size_t len)
+{
+  size_t j;
+  for (j = 0U; (j < len) && (j < 32U); j++) {
+    fprintf(out, " %02x", data[j]);
+  }
+
+  fprintf(out, "%s\n", (len > 32U) ? " ..." : "");
+}
+
+static int_T save(const char_T *path, const uint8_T *data, size_t len)
+{
+  FILE *fp = fopen(path, "wb");
+  int_T rc = 0;
+  if (fp == NULL) {
+    return -1;
+  }
+
+  if ((len > 0U) && (fwrite(data, 1, len, fp) != len)) {
+    rc = -1;
+  }
+
+  if (fclose(fp) != 0) {
+    rc = -1;
+  }
+
+  return rc;
+}
+
+/* Regression run of one input file */
+typedef struct {
+  const char_T *list;
+  boolean_T abort_on_fail;
+  int_T inputs;
+  int_T failed;
+  uint8_T buf[MAX_INPUT];
+  fsm_12B_FuzzRun run;
+} Replay;
+
+static void replay(const char_T *path, void *arg)
+{
+  Replay *rp = (Replay *)arg;
+  const long n = read_input(path, rp->buf);
+  int_T r;
+  if (n < 0) {
+    fprintf(stderr, "fuzz: cannot read %s\n", path);
+    return;
+  }
+
+  (void)fsm_12B_fuzz_run(rp->buf, (size_t)n, &rp->run);
+
+#ifdef FSM_12B_FUZZ_AFL
+
+  afl_features(&rp->run);
+
+#endif                                 /* FSM_12B_FUZZ_AFL */
+
+  rp->inputs++;
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    if ((rp->run.first[r] >= 0) && fsm_12B_selected(rp->list,
+         fsm_12B_requirements[r].id)) {
+      printf("%s: requirement %d violated at byte %d: %s\n", path,
+             fsm_12B_requirements[r].id, rp->run.first[r],
+             fsm_12B_requirements[r].message);
+      rp->failed++;
+    }
+  }
+
+  if (rp->abort_on_fail && (violation(&rp->run, rp->list) >= 0)) {
+    (void)fflush(stdout);
+    abort();
+  }
+}
+
+/* Seed file for the fuzzing loop */
+static void seed_file(const char_T *path, void *arg)
+{
+  uint8_T *buf = (uint8_T *)arg;
+  const long n = read_input(path, buf);
+  if (n < 0) {
+    fprintf(stderr, "fuzz: cannot read %s\n", path);
+    return;
+  }
+
+  add(buf, (size_t)n);
+}
+
+/* Mutate buf in place; returns the new length */
+static size_t mutate(uint8_T *buf, size_t len, size_t max_len)
+{
+  const int_T rounds = 1 + (int_T)(next() % 4U);
+  int_T m;
+  for (m = 0; m < rounds; m++) {
+    const size_t at = (len > 0U) ? (size_t)(next() % len) : 0U;
+    switch (next() % 6U) {
+     case 0:
+      /* Replace a tick */
+      if (len > 0U) {
+        buf[at] = tick();
+      }
+      break;
+
+     case 1:
+      /* Insert a tick */
+      if (len < max_len) {
+        memmove(&buf[at + 1U], &buf[at], len - at);
+        buf[at] = tick();
+        len++;
+      }
+      break;
+
+     case 2:
+      /* Delete a tick */
+      if (len > 0U) {
+        memmove(&buf[at], &buf[at + 1U], len - at - 1U);
+        len--;
+      }
+      break;
+
+     case 3:
+      /* Repeat a run of ticks */
+      if (len > 0U) {
+        size_t n = 1U + (size_t)(next() % 8U);
+        if (n > len - at) {
+          n = len - at;
+        }
+
+        if (n > max_len - len) {
+          n = max_len - len;
+        }
+
+        memmove(&buf[at + n], &buf[at], len - at);
+        len += n;
+      }
+      break;
+
+     case 4:
+      {
+        /* Splice the tail of another input */
+        const Entry *e = &corpus[next() % (uint64_T)ncorpus];
+        if (e->len > 0U) {
+          const size_t from = (size_t)(next() % e->len);
+          size_t n = e->len - from;
+          if (n > max_len - at) {
+            n = max_len - at;
+          }
+
+          memcpy(&buf[at], &e->data[from], n);
+          len = at + n;
+        }
+      }
+      break;
+
+     default:
+      /* Append a tick */
+      if (len < max_len) {
+        buf[len++] = tick();
+      }
+      break;
+    }
+  }
+
+  return len;
+}
+
+static int compare_length(const void *a, const void *b)
+{
+  const Entry *x = (const Entry *)a;
+  const Entry *y = (const Entry *)b;
+  return (x->len < y->len) ? -1 : ((x->len > y->len) ? 1 : 0);
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  static uint8_T buf[MAX_INPUT];
+  static uint8_T fail[FSM_12B_NUM_REQUIREMENTS][MAX_INPUT];
+  static boolean_T reachable[FSM_12B_FUZZ_FEATURES];
+  static fsm_12B_FuzzRun run;
+  static Replay rp;
+  size_t fail_len[FSM_12B_NUM_REQUIREMENTS];
+  uint64_T execs = 100000000U;
+  uint64_T seed = 1U;
+  uint64_T done = 0U;
+  uint64_T ticks = 0U;
+  real_T seconds = 0.0;
+  real_T full = -1.0;
+  real_T t0;
+  real_T secs;
+  size_t max_len = 64U;
+  const char_T *list = NULL;
+  const char_T *seeds = NULL;
+  const char_T *dir = NULL;
+  boolean_T abort_on_fail = false;
+  int_T first = argc;
+  int_T nseeds;
+  int_T nreachable;
+  int_T covered = 0;
+  int_T kept = 0;
+  int_T failed = 0;
+  int_T i;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (opt[0] != '-') {
+      first = i;
+      break;
+    }
+
+    if (strcmp(opt, "-a") == 0) {
+      abort_on_fail = true;
+      continue;
+    }
+
+    if (strcmp(opt, "-n") == 0) {
+      execs = strtoull(val, NULL, 0);
+    } else if (strcmp(opt, "-t") == 0) {
+      seconds = atof(val);
+    } else if (strcmp(opt, "-s") == 0) {
+      seed = strtoull(val, NULL, 0);
+    } else if (strcmp(opt, "-l") == 0) {
+      max_len = (size_t)strtoul(val, NULL, 0);
+    } else if (strcmp(opt, "-r") == 0) {
+      list = val;
+    } else if (strcmp(opt, "-i") == 0) {
+      seeds = val;
+    } else if (strcmp(opt, "-o") == 0) {
+      dir = val;
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if ((max_len == 0U) || (max_len > MAX_INPUT)) {
+    usage();
+    return 2;
+  }
+
+  /* Regression run over the given inputs */
+  if (first < argc) {
+    rp.list = list;
+    rp.abort_on_fail = abort_on_fail;
+    for (i = first; i < argc; i++) {
+      (void)each_input(argv[i], replay, &rp);
+    }
+
+    printf("%d inputs, %d violations\n", rp.inputs, rp.failed);
+    return (rp.failed != 0) ? 1 : 0;
+  }
+
+  nreachable = fsm_12B_fuzz_reachable(reachable);
+  if (nreachable < 0) {
+    fprintf(stderr, "fuzz: the state space does not fit the explorer\n");
+    return 2;
+  }
+
+  rng = seed;
+  if (seeds != NULL) {
+    (void)each_input(seeds, seed_file, buf);
+  }
+
+  if (ncorpus == 0) {
+    buf[0] = 0U;
+    add(buf, 1U);
+  }
+
+  nseeds = ncorpus;
+  for (i = 0; i < FSM_12B_NUM_REQUIREMENTS; i++) {
+    fail_len[i] = 0U;
+  }
+
+  t0 = fsm_12B_now_sec();
+  for (done = 0U; done < execs; done++) {
+    size_t len;
+    int_T r;
+    if (done < (uint64_T)nseeds) {
+      /* The seeds first, unchanged */
+      len = corpus[done].len;
+      memcpy(buf, corpus[done].data, len);
+    } else {
+      const Entry *e = &corpus[next() % (uint64_T)ncorpus];
+      len = (e->len < max_len) ? e->len : max_len;
+      memcpy(buf, e->data, len);
+      len = mutate(buf, len, max_len);
+    }
+
+    (void)fsm_12B_fuzz_run(buf, len, &run);
+    ticks += (uint64_T)run.ticks;
+    if ((novel(&run, seen) > 0) && (done >= (uint64_T)nseeds)) {
+      add(buf, len);
+    }
+
+    /* The shortest prefix that violates each requirement */
+    for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+      const size_t n = (size_t)run.first[r] + 1U;
+      if ((run.first[r] >= 0) && ((fail_len[r] == 0U) || (n < fail_len[r]))) {
+        memcpy(fail[r], buf, n);
+        fail_len[r] = n;
+      }
+    }
+
+    if ((done & 0xFFU) == 0U) {
+      int_T f;
+      covered = 0;
+      for (f = 0; f < FSM_12B_FUZZ_FEATURES; f++) {
+        if (reachable[f] && (seen[f] != 0U)) {
+          covered++;
+        }
+      }
+
+      if ((covered == nreachable) && (full < 0.0)) {
+        full = fsm_12B_now_sec() - t0;
+        done++;
+        break;
+      }
+
+      if ((seconds > 0.0) && (fsm_12B_now_sec() - t0 > seconds)) {
+        done++;
+        break;
+      }
+    }
+  }
+
+  secs = fsm_12B_now_sec() - t0;
+  covered = 0;
+  for (i = 0; i < FSM_12B_FUZZ_FEATURES; i++) {
+    if (reachable[i] && (seen[i] != 0U)) {
+      covered++;
+    }
+  }
+
+  printf("%lu execs, %lu ticks in %.3f s (%.0f execs/s), corpus %d inputs\n",
+         (unsigned long)done, (unsigned long)ticks, secs, (real_T)done / secs,
+         ncorpus);
+  printf("coverage: %d of %d reachable features", covered, nreachable);
+  if (full >= 0.0) {
+    printf(", all covered after %.3f s\n", full);
+  } else {
+    char_T name[64];
+    printf(", missing:\n");
+    for (i = 0; i < FSM_12B_FUZZ_FEATURES; i++) {
+      if (reachable[i] && (seen[i] == 0U)) {
+        fsm_12B_fuzz_name(i, name, sizeof(name));
+        printf("  %s\n", name);
+      }
+    }
+  }
+
+  for (i = 0; i < FSM_12B_NUM_REQUIREMENTS; i++) {
+    if ((fail_len[i] == 0U) || !fsm_12B_selected(list,
+         fsm_12B_requirements[i].id)) {
+      continue;
+    }
+
+    printf("requirement %2d violated after %2lu ticks:",
+           fsm_12B_requirements[i].id, (unsigned long)fail_len[i]);
+    hex(stdout, fail[i], fail_len[i]);
+    failed++;
+  }
+
+  /* Minimized corpus: shortest first, kept when it adds a feature */
+  qsort(corpus, (size_t)ncorpus, sizeof(Entry), compare_length);
+  memset(seen, 0, sizeof(seen));
+  for (i = 0; i < ncorpus; i++) {
+    (void)fsm_12B_fuzz_run(corpus[i].data, corpus[i].len, &run);
+    if (novel(&run, seen) == 0) {
+      free(corpus[i].data);
+      corpus[i].data = NULL;
+      continue;
+    }
+
+    kept++;
+  }
+
+  printf("minimized corpus: %d inputs\n", kept);
+  if (dir != NULL) {
+    char_T path[MAX_PATH + 32];
+    (void)mkdir(dir, 0755);
+    for (i = 0; i < ncorpus; i++) {
+      uint64_T h = 0xCBF29CE484222325ULL;
+      size_t j;
+      if (corpus[i].data == NULL) {
+        continue;
+      }
+
+      /* FNV-1a of the contents */
+      for (j = 0U; j < corpus[i].len; j++) {
+        h = (h ^ corpus[i].data[j]) * 0x100000001B3ULL;
+      }
+
+      (void)snprintf(path, sizeof(path), "%s/%016llx.bin", dir, (unsigned long
+        long)h);
+      if (save(path, corpus[i].data, corpus[i].len) != 0) {
+        fprintf(stderr, "fuzz: cannot write %s\n", path);
+        return 2;
+      }
+    }
+
+    for (i = 0; i < FSM_12B_NUM_REQUIREMENTS; i++) {
+      if ((fail_len[i] == 0U) || !fsm_12B_selected(list,
+         fsm_12B_requirements[i].id)) {
+        continue;
+      }
+
+      (void)snprintf(path, sizeof(path), "%s/fail-%d.bin", dir,
+                     fsm_12B_requirements[i].id);
+      if (save(path, fail[i], fail_len[i]) != 0) {
+        fprintf(stderr, "fuzz: cannot write %s\n", path);
+        return 2;
+      }
+    }
+  }
+
+  for (i = 0; i < ncorpus; i++) {
+    free(corpus[i].data);
+  }
+
+  return (failed != 0) ? 1 : 0;
+}
+
+#endif                                 /* FSM_12B_FUZZ_LIBFUZZER */
+
+/*
+ * File trailer for fuzz_main.c
+ *
+ * [EOF]
+ */
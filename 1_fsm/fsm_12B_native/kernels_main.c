@@ -0,0 +1,365 @@
+/*
+ * File: kernels_main.c
+ *
+ * Checks the multi-instance and compact kernels against fsm_12B_step.
+ * Each kernel holds one instance per reachable state and input vector,
+ * repeated to fill at least 17 bit-slice words so that every vector
+ * backend runs whole vectors and a tail, steps them all once, and every
+ * instance must end with the DW and output that fsm_12B_step gives from
+ * the same state and input, bit for bit; the initialize functions are
+ * compared the same way.  fsm_12B_bs_step runs as compiled, and each
+ * backend of fsm_12B_bitslice.h on its own; one that this CPU or its OS
+ * lacks is skipped.  Meant to be run after every change to a kernel or
+ * regeneration of the model.
+ *
+ *   kernels
+ *
+ * Exit status: 0 equivalent, 1 divergence, 2 setup error.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "fsm_12B_batch.h"
+#include "fsm_12B_bitslice.h"
+#include "fsm_12B_compact.h"
+#include "fsm_12B_explore.h"
+#include "fsm_12B_req.h"
+#include "fsm_12B_state.h"
+#include "rtwtypes.h"
+
+/* At least one instance per (state, input) pair */
+#define MIN_INSTANCES                  (17 * FSM_12B_BS_LANES)
+#define MAX_INSTANCES       (FSM_12B_EXPLORE_MAX_STATES * FSM_12B_NUM_INPUTS)
+#define MAX_WORDS                      (MAX_INSTANCES / FSM_12B_BS_LANES)
+
+typedef struct {
+  const char_T *name;
+  void (*initialize)(DW *rtDW);
+
+  /*
+   * Step n instances of rtDW in place under input vectors in.  false when
+   * the kernel cannot run on this CPU.
+   */
+  boolean_T (*step)(int_T n, const uint8_T *in, DW *rtDW, boolean_T
+                    *rtY_pullup);
+  boolean_T delays_only;               /* merged signals rebuilt on store */
+} Kernel;
+
+static fsm_12B_Explorer ex;
+static fsm_12B_ExploreResult results[FSM_12B_NUM_REQUIREMENTS];
+static uint8_T input[MAX_INSTANCES];
+static int_T state[MAX_INSTANCES];
+static DW expected[MAX_INSTANCES];
+static DW actual[MAX_INSTANCES];
+static boolean_T expected_pullup[MAX_INSTANCES];
+static boolean_T actual_pullup[MAX_INSTANCES];
+
+/* Columns and input planes of the batch kernel */
+static real_T b_Merge[MAX_INSTANCES];
+static real_T b_Merge_g[MAX_INSTANCES];
+static real_T b_UnitDelay[MAX_INSTANCES];
+static real_T b_UnitDelay1[MAX_INSTANCES];
+static boolean_T b_Merge_p[3][MAX_INSTANCES];
+static boolean_T b_UnitDelay2[MAX_INSTANCES];
+static boolean_T b_in[4][MAX_INSTANCES];
+static const DW_Batch batch = { b_Merge, b_Merge_g, b_UnitDelay, b_UnitDelay1,
+  { b_Merge_p[0], b_Merge_p[1], b_Merge_p[2] }, b_UnitDelay2 };
+
+/* Bit-planes of the bit-sliced kernel */
+static uint64_T s_plane[5][MAX_WORDS];
+static uint64_T s_in[4][MAX_WORDS];
+static uint64_T s_out[MAX_WORDS];
+static const DW_BitSlice bitslice = { s_plane[0], s_plane[1], s_plane[2],
+  s_plane[3], s_plane[4] };
+
+/* The reference, fsm_12B_step */
+static void model_initialize(DW *rtDW)
+{
+  RT_MODEL rtM;
+  rtM.dwork = rtDW;
+  fsm_12B_initialize(&rtM);
+}
+
+static boolean_T model_step(int_T n, const uint8_T *in, DW *rtDW, boolean_T
+  *rtY_pullup)
+{
+  RT_MODEL rtM;
+  int_T i;
+  for (i = 0; i < n; i++) {
+    const uint32_T k = in[i];
+    rtM.dwork = &rtDW[i];
+    fsm_12B_step(&rtM, FSM_12B_IN_STANDBY(k), FSM_12B_IN_APFAIL(k),
+                 FSM_12B_IN_SUPPORTED(k), FSM_12B_IN_LIMITS(k), &rtY_pullup[i]);
+  }
+
+  return true;
+}
+
+/* fsm_12B_batch.h */
+static void batch_initialize(DW *rtDW)
+{
+  fsm_12B_batch_load(&batch, 0, rtDW);
+  fsm_12B_initialize_batch(1, &batch);
+  fsm_12B_batch_store(&batch, 0, rtDW);
+}
+
+static boolean_T batch_step(int_T n, const uint8_T *in, DW *rtDW, boolean_T
+  *rtY_pullup)
+{
+  int_T i;
+  for (i = 0; i < n; i++) {
+    const uint32_T k = in[i];
+    fsm_12B_batch_load(&batch, i, &rtDW[i]);
+    b_in[0][i] = FSM_12B_IN_STANDBY(k);
+    b_in[1][i] = FSM_12B_IN_APFAIL(k);
+    b_in[2][i] = FSM_12B_IN_SUPPORTED(k);
+    b_in[3][i] = FSM_12B_IN_LIMITS(k);
+  }
+
+  fsm_12B_step_batch(n, &batch, b_in[0], b_in[1], b_in[2], b_in[3],
+                     rtY_pullup);
+  for (i = 0; i < n; i++) {
+    fsm_12B_batch_store(&batch, i, &rtDW[i]);
+  }
+
+  return true;
+}
+
+/*
+ * fsm_12B_bitslice.h, one kernel per backend and one for fsm_12B_bs_step,
+ * which picks its backend at compile time
+ */
+#define BS_COMPILED                    FSM_12B_BS_NUM_ISAS
+
+static void bitslice_initialize(DW *rtDW)
+{
+  fsm_12B_bs_initialize(1, &bitslice);
+  fsm_12B_bs_store(&bitslice, 0, rtDW);
+}
+
+static boolean_T bitslice_step(int_T isa, int_T n, const uint8_T *in, DW
+  *rtDW, boolean_T *rtY_pullup)
+{
+  const int_T nwords = (n + FSM_12B_BS_LANES - 1) / FSM_12B_BS_LANES;
+  int_T i;
+  memset(s_plane, 0, sizeof(s_plane));
+  for (i = 0; i < n; i++) {
+    const uint32_T k = in[i];
+
+    /* A state the engine cannot hold stays Transition and shows up below */
+    (void)fsm_12B_bs_load(&bitslice, i, &rtDW[i]);
+    FSM_12B_BS_SET(s_in[0], i, FSM_12B_IN_STANDBY(k));
+    FSM_12B_BS_SET(s_in[1], i, FSM_12B_IN_APFAIL(k));
+    FSM_12B_BS_SET(s_in[2], i, FSM_12B_IN_SUPPORTED(k));
+    FSM_12B_BS_SET(s_in[3], i, FSM_12B_IN_LIMITS(k));
+  }
+
+  if (isa == BS_COMPILED) {
+    fsm_12B_bs_step(nwords, &bitslice, s_in[0], s_in[1], s_in[2], s_in[3],
+                    s_out);
+  } else if (!fsm_12B_bs_step_isa((fsm_12B_BsIsa)isa, nwords, &bitslice,
+              s_in[0], s_in[1], s_in[2], s_in[3], s_out)) {
+    return false;
+  }
+
+  for (i = 0; i < n; i++) {
+    fsm_12B_bs_store(&bitslice, i, &rtDW[i]);
+    rtY_pullup[i] = FSM_12B_BS_GET(s_out, i);
+  }
+
+  return true;
+}
+
+static boolean_T bitslice_compiled_step(int_T n, const uint8_T *in, DW *rtDW,
+  boolean_T *rtY_pullup)
+{
+  return bitslice_step(BS_COMPILED, n, in, rtDW, rtY_pullup);
+}
+
+static boolean_T bitslice_u64_step(int_T n, const uint8_T *in, DW *rtDW,
+  boolean_T *rtY_pullup)
+{
+  return bitslice_step(FSM_12B_BS_UINT64, n, in, rtDW, rtY_pullup);
+}
+
+static boolean_T bitslice_avx2_step(int_T n, const uint8_T *in, DW *rtDW,
+  boolean_T *rtY_pullup)
+{
+  return bitslice_step(FSM_12B_BS_AVX2, n, in, rtDW, rtY_pullup);
+}
+
+static boolean_T bitslice_avx512f_step(int_T n, const uint8_T *in, DW *rtDW,
+  boolean_T *rtY_pullup)
+{
+  return bitslice_step(FSM_12B_BS_AVX512F, n, in, rtDW, rtY_pullup);
+}
+
+/* fsm_12B_compact.h, one instance at a time */
+static void compact_initialize(DW *rtDW)
+{
+  DW_Compact c;
+  fsm_12B_compact_initialize(&c);
+  fsm_12B_compact_to_dw(&c, rtDW);
+}
+
+static boolean_T compact_step(int_T n, const uint8_T *in, DW *rtDW, boolean_T
+  *rtY_pullup)
+{
+  int_T i;
+  for (i = 0; i < n; i++) {
+    const uint32_T k = in[i];
+    DW_Compact c;
+
+    /* A state the encoding cannot hold stays zero and shows up below */
+    c.bits = 0U;
+    (void)fsm_12B_compact_from_dw(&rtDW[i], &c);
+    fsm_12B_compact_step(&c, FSM_12B_IN_STANDBY(k), FSM_12B_IN_APFAIL(k),
+                         FSM_12B_IN_SUPPORTED(k), FSM_12B_IN_LIMITS(k),
+                         &rtY_pullup[i]);
+    fsm_12B_compact_to_dw(&c, &rtDW[i]);
+  }
+
+  return true;
+}
+
+static const Kernel kernels[] = {
+  { "batch", batch_initialize, batch_step, false },
+
+  { "bs", bitslice_initialize, bitslice_compiled_step, true },
+
+  { "bs/uint64", bitslice_initialize, bitslice_u64_step, true },
+
+  { "bs/avx2", bitslice_initialize, bitslice_avx2_step, true },
+
+  { "bs/avx512f", bitslice_initialize, bitslice_avx512f_step, true },
+
+  { "compact", compact_initialize, compact_step, false }
+};
+
+static void print_field(const char_T *name, real_T e, real_T a)
+{
+  printf("    %-18s %9g %9g%s\n", name, e, a, (memcmp(&e, &a, sizeof(real_T))
+          != 0) ? "  <--" : "");
+}
+
+/* Report instance i, or the initial state when i < 0 */
+static void print_divergence(const Kernel *kn, int_T i, const DW *e, const DW
+  *a, boolean_T output)
+{
+  printf("DIVERGENCE: %s differs from fsm_12B_step in %s ", kn->name, output ?
+         "the output" : "DW");
+  if (i < 0) {
+    printf("after initialize\n");
+  } else {
+    const uint32_T k = input[i];
+    const int_T s = state[i];
+    printf("in instance %d, from state %d (depth %d) under standby %d apfail "
+           "%d supported %d limits %d\n", i, s, ex.depth[s], FSM_12B_IN_STANDBY
+           (k), FSM_12B_IN_APFAIL(k), FSM_12B_IN_SUPPORTED(k),
+           FSM_12B_IN_LIMITS(k));
+  }
+
+  printf("    %-18s %9s %9s\n", "", "expected", "actual");
+  print_field("Merge", e->Merge, a->Merge);
+  print_field("Merge_g", e->Merge_g, a->Merge_g);
+  print_field("UnitDelay_DSTATE", e->UnitDelay_DSTATE, a->UnitDelay_DSTATE);
+  print_field("UnitDelay1_DSTATE", e->UnitDelay1_DSTATE, a->UnitDelay1_DSTATE);
+  print_field("Merge_p[0]", (real_T)e->Merge_p[0], (real_T)a->Merge_p[0]);
+  print_field("Merge_p[1]", (real_T)e->Merge_p[1], (real_T)a->Merge_p[1]);
+  print_field("Merge_p[2]", (real_T)e->Merge_p[2], (real_T)a->Merge_p[2]);
+  print_field("UnitDelay2_DSTATE", (real_T)e->UnitDelay2_DSTATE, (real_T)
+              a->UnitDelay2_DSTATE);
+  if ((i >= 0) && output) {
+    print_field("rtY_pullup", (real_T)expected_pullup[i], (real_T)
+                actual_pullup[i]);
+  }
+}
+
+/* Do the delays of a and b have the same bit patterns? */
+static boolean_T delays_equal(const DW *a, const DW *b)
+{
+  return (memcmp(&a->UnitDelay_DSTATE, &b->UnitDelay_DSTATE, sizeof(real_T))
+          == 0) && (memcmp(&a->UnitDelay1_DSTATE, &b->UnitDelay1_DSTATE, sizeof
+    (real_T)) == 0) && (a->UnitDelay2_DSTATE == b->UnitDelay2_DSTATE);
+}
+
+/*
+ * 0 when kn agrees with the reference on n instances or cannot run here,
+ * 1 otherwise
+ */
+static int_T check(const Kernel *kn, int_T n)
+{
+  DW e;
+  DW a;
+  int_T i;
+  memset(&e, 0, sizeof(DW));
+  memset(&a, 0, sizeof(DW));
+  model_initialize(&e);
+  kn->initialize(&a);
+  if (kn->delays_only ? !delays_equal(&e, &a) : !fsm_12B_dw_equal(&e, &a)) {
+    print_divergence(kn, -1, &e, &a, false);
+    return 1;
+  }
+
+  for (i = 0; i < n; i++) {
+    actual[i] = ex.state[state[i]];
+    actual_pullup[i] = false;
+  }
+
+  if (!kn->step(n, input, actual, actual_pullup)) {
+    printf("%-10s skipped, not supported by this CPU or OS\n", kn->name);
+    return 0;
+  }
+  for (i = 0; i < n; i++) {
+    const boolean_T output = (expected_pullup[i] != actual_pullup[i]);
+    if (output || !fsm_12B_dw_equal(&expected[i], &actual[i])) {
+      print_divergence(kn, i, &expected[i], &actual[i], output);
+      return 1;
+    }
+  }
+
+  printf("%-10s %d instances, equivalent\n", kn->name, n);
+  return 0;
+}
+
+int_T main(void)
+{
+  int_T pairs;
+  int_T n;
+  int_T i;
+  if (fsm_12B_explore(&ex, results) != 0) {
+    fprintf(stderr, "kernels: the state space does not fit the explorer\n");
+    return 2;
+  }
+
+  pairs = ex.count * (int_T)FSM_12B_NUM_INPUTS;
+  n = pairs;
+  while (n < MIN_INSTANCES) {
+    n += pairs;
+  }
+
+  for (i = 0; i < n; i++) {
+    input[i] = (uint8_T)(i % (int_T)FSM_12B_NUM_INPUTS);
+    state[i] = (i % pairs) / (int_T)FSM_12B_NUM_INPUTS;
+    expected[i] = ex.state[state[i]];
+  }
+
+  (void)model_step(n, input, expected, expected_pullup);
+  printf("states:    %d reachable, %d (state, input) pairs, %d instances\n",
+         ex.count, pairs, n);
+  printf("bs:        fsm_12B_bs_step built for %s\n", fsm_12B_bs_isa());
+  for (i = 0; i < (int_T)(sizeof(kernels) / sizeof(kernels[0])); i++) {
+    if (check(&kernels[i], n) != 0) {
+      return 1;
+    }
+  }
+
+  printf("EQUIVALENT\n");
+  return 0;
+}
+
+/*
+ * File trailer for kernels_main.c
+ *
+ * [EOF]
+ */
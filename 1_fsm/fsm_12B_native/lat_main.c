@@ -0,0 +1,157 @@
+/*
+ * File: lat_main.c
+ *
+ * rt_OneStep of ert_main.c with step-latency instrumentation.  Steps the
+ * model back to back with pseudo-random inputs, then prints the latency
+ * distribution, the worst case and the overrun counts, and the cost of
+ * the instrumentation itself and of the counter reads it is made of.
+ *
+ *   lat [steps]
+ *
+ * Build with -DFSM_12B_LATENCY; without it the instrumentation compiles
+ * away and only the plain step rate is reported.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B.h"
+#include "fsm_12B_lat.h"
+#include "fsm_12B_util.h"
+
+static RT_MODEL rtM_;
+static RT_MODEL *const rtMPtr = &rtM_; /* Real-time model */
+static DW rtDW;                        /* Observable states */
+
+/* '<Root>/standby' .. '<Root>/limits' */
+static boolean_T rtU_standby;
+static boolean_T rtU_apfail;
+static boolean_T rtU_supported;
+static boolean_T rtU_limits;
+
+/* '<Root>/pullup' */
+static boolean_T rtY_pullup;
+static fsm_12B_Latency lat;
+static volatile uint64_T counter_sink;
+
+static void rt_OneStep(RT_MODEL *const rtM)
+{
+  fsm_12B_step_timed(&lat, rtM, rtU_standby, rtU_apfail, rtU_supported,
+                     rtU_limits, &rtY_pullup);
+}
+
+/* Steps per second of n plain or instrumented steps */
+static real_T run(RT_MODEL *const rtM, uint64_T n, boolean_T timed)
+{
+  uint32_T x = 2463534242U;
+  real_T t0;
+  uint64_T i;
+  t0 = fsm_12B_now_sec();
+  for (i = 0U; i < n; i++) {
+    /* Set model inputs here */
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rtU_standby = (boolean_T)(x & 1U);
+    rtU_apfail = (boolean_T)((x >> 8) & 1U);
+    rtU_supported = (boolean_T)((x >> 16) & 1U);
+    rtU_limits = (boolean_T)((x >> 24) & 1U);
+    if (timed) {
+      rt_OneStep(rtM);
+    } else {
+      fsm_12B_step(rtM, rtU_standby, rtU_apfail, rtU_supported, rtU_limits,
+                   &rtY_pullup);
+    }
+  }
+
+  return (real_T)n / (fsm_12B_now_sec() - t0);
+}
+
+#ifdef FSM_12B_LATENCY
+
+/* Nanoseconds per fsm_12B_lat_now, twice of which every timed step pays */
+static real_T counter_cost(uint64_T n)
+{
+  uint64_T sum = 0U;
+  real_T t0;
+  uint64_T i;
+  t0 = fsm_12B_now_sec();
+  for (i = 0U; i < n; i++) {
+    sum += fsm_12B_lat_now();
+  }
+
+  counter_sink = sum;
+  return 1.0e9 * (fsm_12B_now_sec() - t0) / (real_T)n;
+}
+
+#endif                                 /* FSM_12B_LATENCY */
+
+int_T main(int_T argc, const char *argv[])
+{
+  static fsm_12B_LatStats s;
+  RT_MODEL *const rtM = rtMPtr;
+  const uint64_T n = (argc > 1) ? strtoull(argv[1], NULL, 0) : 10000000U;
+  real_T plain;
+  real_T timed;
+  real_T ns;
+  int_T b;
+
+  /* Pack model data into RTM */
+  rtM->dwork = &rtDW;
+
+  /* Initialize model */
+  fsm_12B_initialize(rtM);
+  fsm_12B_lat_init(&lat, FSM_12B_LAT_BASE_RATE);
+  plain = run(rtM, n, false);
+  timed = run(rtM, n, true);
+  printf("fsm_12B: %lu steps, plain %.2f ns/step, instrumented %.2f ns/step, "
+         "overhead %.2f ns/step\n", (unsigned long)n, 1.0e9 / plain, 1.0e9 /
+         timed, 1.0e9 / timed - 1.0e9 / plain);
+
+#ifdef FSM_12B_LATENCY
+
+  fsm_12B_lat_snapshot(&lat, &s);
+  ns = 1.0e9 / lat.ticks_per_sec;
+  printf("counter %.3f MHz, %.2f ns per read, budget %lu ticks\n",
+         lat.ticks_per_sec / 1.0e6, counter_cost(n), (unsigned long)lat.budget);
+  printf("steps %lu  overruns %lu  skipped %lu\n", (unsigned long)s.steps,
+         (unsigned long)s.overruns, (unsigned long)s.skipped);
+  printf("latency ns: min %.1f  mean %.1f  p50 %.1f  p99 %.1f  p99.99 %.1f  "
+         "max %.1f (step %lu)\n", ns * (real_T)s.min, ns * (real_T)s.total /
+         (real_T)s.steps, ns * (real_T)fsm_12B_lat_quantile(&s, 0.5), ns *
+         (real_T)fsm_12B_lat_quantile(&s, 0.99), ns * (real_T)
+         fsm_12B_lat_quantile(&s, 0.9999), ns * (real_T)s.max, (unsigned long)
+         s.max_step);
+
+  /* One line per power of two */
+  for (b = 0; b < FSM_12B_LAT_BUCKETS; b += FSM_12B_LAT_SUB) {
+    uint64_T sum = 0U;
+    int_T j;
+    for (j = 0; j < FSM_12B_LAT_SUB; j++) {
+      sum += s.hist[b + j];
+    }
+
+    if (sum != 0U) {
+      printf("  %12lu .. %12lu ticks  %lu\n", (unsigned long)
+             fsm_12B_lat_bucket_low(b), (unsigned long)fsm_12B_lat_bucket_high(b
+              + FSM_12B_LAT_SUB - 1), (unsigned long)sum);
+    }
+  }
+
+#else
+
+  (void)s;
+  (void)ns;
+  (void)b;
+
+#endif
+
+  return 0;
+}
+
+/*
+ * File trailer for lat_main.c
+ *
+ * [EOF]
+ */
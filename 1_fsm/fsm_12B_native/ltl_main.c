@@ -0,0 +1,172 @@
+/*
+ * File: ltl_main.c
+ *
+ * Runs online LTL monitors against fsm_12B, either live next to
+ * fsm_12B_step with pseudo-random inputs or over a packed trace.
+ *
+ *   ltl [-f formula]... [-n ticks] [packed trace]
+ *
+ * Without -f the ert_main.c requirements of fsm_12B_ltl_requirements are
+ * monitored.
+ *
+ * Exit status: 0 no violation, 1 some violation, 2 usage error.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B.h"
+#include "fsm_12B_ltl.h"
+#include "fsm_12B_trace.h"
+#include "fsm_12B_util.h"
+
+static fsm_12B_LtlMonitor mon[FSM_12B_LTL_MAX_MONITORS];
+static fsm_12B_LtlSet set;
+static RT_MODEL rtM_;
+static RT_MODEL *const rtMPtr = &rtM_; /* Real-time model */
+static DW rtDW;                        /* Observable states */
+
+/* Step the model and the monitors in lockstep */
+static uint64_T run_live(uint64_T n)
+{
+  RT_MODEL *const rtM = rtMPtr;
+  uint32_T x = 2463534242U;
+  uint64_T t;
+
+  /* Pack model data into RTM */
+  rtM->dwork = &rtDW;
+
+  /* Initialize model */
+  fsm_12B_initialize(rtM);
+  for (t = 0U; t < n; t++) {
+    boolean_T rtY_pullup;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    (void)fsm_12B_ltl_step_model(&set, rtM, (boolean_T)(x & 1U), (boolean_T)
+      ((x >> 8) & 1U), (boolean_T)((x >> 16) & 1U), (boolean_T)((x >> 24) & 1U),
+      &rtY_pullup);
+  }
+
+  return n;
+}
+
+/* Feed the ticks of a packed trace */
+static int_T run_trace(const char *path, uint64_T *n)
+{
+  fsm_12B_TraceReader r;
+  fsm_12B_LtlSample s;
+  uint64_T t;
+  if (fsm_12B_trace_open(&r, path) != 0) {
+    fprintf(stderr, "ltl: cannot open %s\n", path);
+    return -1;
+  }
+
+  /* State of fsm_12B_initialize */
+  s.mode = 0U;
+  s.sen = 0U;
+  for (t = 0U; t < r.ticks; t++) {
+    fsm_12B_TraceTick tick;
+    int_T i;
+    if (fsm_12B_trace_read(&r, t, &tick) != 0) {
+      fprintf(stderr, "ltl: %s is corrupt at tick %lu\n", path, (unsigned long)
+              t);
+      fsm_12B_trace_close(&r);
+      return -1;
+    }
+
+    s.premode = s.mode;
+    s.presen = s.sen;
+    s.standby = (boolean_T)(tick.inputs & 1U);
+    s.apfail = (boolean_T)((tick.inputs >> 1) & 1U);
+    s.supported = (boolean_T)((tick.inputs >> 2) & 1U);
+    s.limits = (boolean_T)((tick.inputs >> 3) & 1U);
+    s.pullup = tick.rtY_pullup;
+    s.mode = tick.Merge;
+    s.sen = tick.Merge_g;
+    for (i = 0; i < set.n; i++) {
+      (void)fsm_12B_ltl_step(set.mon[i], &s);
+    }
+  }
+
+  *n = r.ticks;
+  fsm_12B_trace_close(&r);
+  return 0;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  const char_T *text[FSM_12B_LTL_MAX_MONITORS];
+  const char *path = NULL;
+  int_T nformulas = 0;
+  uint64_T n = 1000000U;
+  uint64_T violated = 0U;
+  real_T t0;
+  real_T secs;
+  int_T i;
+  for (i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc)) {
+      if (nformulas >= FSM_12B_LTL_MAX_MONITORS) {
+        fprintf(stderr, "ltl: at most %d formulas\n", FSM_12B_LTL_MAX_MONITORS);
+        return 2;
+      }
+
+      text[nformulas++] = argv[++i];
+    } else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+      n = strtoull(argv[++i], NULL, 0);
+    } else if ((argv[i][0] != '-') && (path == NULL)) {
+      path = argv[i];
+    } else {
+      fprintf(stderr, "usage: ltl [-f formula]... [-n ticks] [packed trace]\n");
+      return 2;
+    }
+  }
+
+  /* Compile the formulas given with -f, or the requirements */
+  if (nformulas == 0) {
+    for (i = 0; i < FSM_12B_LTL_REQUIREMENTS; i++) {
+      text[nformulas++] = fsm_12B_ltl_requirements[i];
+    }
+  }
+
+  for (i = 0; i < nformulas; i++) {
+    if (fsm_12B_ltl_compile(&mon[i], text[i]) != 0) {
+      fprintf(stderr, "ltl: %s\n     %*s^ %s\n", text[i], mon[i].error_pos,
+              "", mon[i].error);
+      return 2;
+    }
+
+    set.mon[set.n++] = &mon[i];
+  }
+
+  t0 = fsm_12B_now_sec();
+  if (path == NULL) {
+    n = run_live(n);
+  } else if (run_trace(path, &n) != 0) {
+    return 2;
+  }
+
+  secs = fsm_12B_now_sec() - t0;
+  printf("fsm_12B: %lu ticks, %d monitors, %.1f ns/tick\n", (unsigned long)n,
+         set.n, 1.0e9 * secs / (real_T)n);
+  for (i = 0; i < set.n; i++) {
+    const fsm_12B_LtlMonitor *m = &mon[i];
+    printf("%-60s %10lu checked %10lu violated", m->text, (unsigned long)
+           m->checked, (unsigned long)m->violations);
+    if (m->first_violation != FSM_12B_LTL_NONE) {
+      printf(", first at tick %lu", (unsigned long)m->first_violation);
+      violated++;
+    }
+
+    printf("\n");
+  }
+
+  return (violated != 0U) ? 1 : 0;
+}
+
+/*
+ * File trailer for ltl_main.c
+ *
+ * [EOF]
+ */
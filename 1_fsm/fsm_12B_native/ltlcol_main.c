@@ -0,0 +1,146 @@
+/*
+ * File: ltlcol_main.c
+ *
+ * Evaluates LTL formulas offline over an archive of packed fsm_12B traces
+ * and reports the first violating tick per formula per trace.
+ *
+ *   ltlcol [-f formula]... [-j threads] [-q] trace...
+ *
+ * Without -f the ert_main.c requirements of fsm_12B_ltl_requirements are
+ * evaluated.  -q prints only the traces with a violation or an error.
+ *
+ * Exit status: 0 no violation, 1 some violation, 2 usage or read error.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_ltl.h"
+#include "fsm_12B_ltlcol.h"
+#include "fsm_12B_util.h"
+
+static fsm_12B_LtlMonitor mon[FSM_12B_LTL_MAX_MONITORS];
+
+int_T main(int_T argc, const char *argv[])
+{
+  const char_T *text[FSM_12B_LTL_MAX_MONITORS];
+  const fsm_12B_LtlMonitor *mp[FSM_12B_LTL_MAX_MONITORS];
+  const char_T **paths;
+  fsm_12B_LtlColResult *res;
+  int_T *status;
+  int_T nformulas = 0;
+  int_T npaths = 0;
+  int_T threads = 0;
+  boolean_T quiet = false;
+  boolean_T violated = false;
+  boolean_T failed = false;
+  uint64_T ticks = 0U;
+  real_T t0;
+  real_T secs;
+  int_T i;
+  int_T p;
+  paths = (const char_T **)malloc((size_t)argc * sizeof(const char_T *));
+  if (paths == NULL) {
+    return 2;
+  }
+
+  for (i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc)) {
+      if (nformulas >= FSM_12B_LTL_MAX_MONITORS) {
+        fprintf(stderr, "ltlcol: at most %d formulas\n",
+                FSM_12B_LTL_MAX_MONITORS);
+        return 2;
+      }
+
+      text[nformulas++] = argv[++i];
+    } else if ((strcmp(argv[i], "-j") == 0) && (i + 1 < argc)) {
+      threads = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-q") == 0) {
+      quiet = true;
+    } else if (argv[i][0] != '-') {
+      paths[npaths++] = argv[i];
+    } else {
+      npaths = 0;
+      break;
+    }
+  }
+
+  if (npaths == 0) {
+    fprintf(stderr,
+            "usage: ltlcol [-f formula]... [-j threads] [-q] trace...\n");
+    return 2;
+  }
+
+  /* Compile the formulas given with -f, or the requirements */
+  if (nformulas == 0) {
+    for (i = 0; i < FSM_12B_LTL_REQUIREMENTS; i++) {
+      text[nformulas++] = fsm_12B_ltl_requirements[i];
+    }
+  }
+
+  for (i = 0; i < nformulas; i++) {
+    if (fsm_12B_ltl_compile(&mon[i], text[i]) != 0) {
+      fprintf(stderr, "ltlcol: %s\n        %*s^ %s\n", text[i],
+              mon[i].error_pos, "", mon[i].error);
+      return 2;
+    }
+
+    mp[i] = &mon[i];
+  }
+
+  res = (fsm_12B_LtlColResult *)malloc((size_t)npaths * (size_t)nformulas *
+    sizeof(fsm_12B_LtlColResult));
+  status = (int_T *)malloc((size_t)npaths * sizeof(int_T));
+  if ((res == NULL) || (status == NULL)) {
+    fprintf(stderr, "ltlcol: out of memory\n");
+    return 2;
+  }
+
+  t0 = fsm_12B_now_sec();
+  fsm_12B_ltlcol_run(mp, nformulas, paths, npaths, threads, res, status);
+  secs = fsm_12B_now_sec() - t0;
+  for (p = 0; p < npaths; p++) {
+    const fsm_12B_LtlColResult *r = &res[(size_t)p * (size_t)nformulas];
+    boolean_T bad = false;
+    if (status[p] != 0) {
+      printf("%s: cannot read\n", paths[p]);
+      failed = true;
+      continue;
+    }
+
+    ticks += r[0].ticks;
+    for (i = 0; i < nformulas; i++) {
+      bad = bad || (r[i].violations != 0U);
+    }
+
+    violated = violated || bad;
+    if (quiet && !bad) {
+      continue;
+    }
+
+    printf("%s:\n", paths[p]);
+    for (i = 0; i < nformulas; i++) {
+      printf("  %-60s %10lu checked %10lu violated", mon[i].text, (unsigned
+              long)r[i].checked, (unsigned long)r[i].violations);
+      if (r[i].first_violation != FSM_12B_LTL_NONE) {
+        printf(", first at tick %lu", (unsigned long)r[i].first_violation);
+      }
+
+      printf("\n");
+    }
+  }
+
+  printf("fsm_12B: %d traces, %d formulas, %.3f s, %.1f Mticks/s\n", npaths,
+         nformulas, secs, 1.0e-6 * (real_T)ticks / secs);
+  free(status);
+  free(res);
+  free(paths);
+  return failed ? 2 : violated ? 1 : 0;
+}
+
+/*
+ * File trailer for ltlcol_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,187 @@
+/*
+ * File: mc_main.c
+ *
+ * Command line front end of the fsm_12B Monte Carlo campaign runner.
+ *
+ *   mc [-n sequences] [-t ticks] [-j threads] [-s seed]
+ *      [-p standby,apfail,supported,limits]
+ *   mc -c
+ *
+ * Defaults: 1000000 sequences of 300 ticks (one minute at the 0.2 s base
+ * rate), one thread per core, seed 1, every input true with probability
+ * 0.5.  Ticks run on a transition table rebuilt from the linked
+ * fsm_12B_step.  The report is identical for any -j.  -c instead
+ * cross-validates the compiled-in transition table against fsm_12B_step
+ * (fsm_12B_table_check), as after every regeneration of the model.
+ *
+ * Exit status: 0 no violation, 1 at least one violation (-c: table
+ * entries that disagree), 2 usage error or a model that no longer fits
+ * the table.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fsm_12B_mc.h"
+
+static const char_T *const mode_name[4] = { "Transition", "Nominal",
+  "Maneuver", "Standby" };
+
+static const char_T *const sen_name[3] = { "Nominal", "Transition", "Fault" };
+
+static fsm_12B_McStats stats;
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: mc [-n sequences] [-t ticks] [-j threads] [-s seed] "
+          "[-p standby,apfail,supported,limits]\n       mc -c\n");
+}
+
+static void print_log2(const char_T *label, const uint64_T *bins)
+{
+  int_T b;
+  printf("%s", label);
+  for (b = 0; b < FSM_12B_MC_LOG2_BINS; b++) {
+    if (bins[b] != 0U) {
+      printf(" [%lu..%lu]:%lu", (unsigned long)((uint64_T)1U << b), (unsigned
+              long)(((uint64_T)2U << b) - 1U), (unsigned long)bins[b]);
+    }
+  }
+
+  printf("\n");
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  fsm_12B_McConfig cfg;
+  struct timespec t0;
+  struct timespec t1;
+  real_T secs;
+  boolean_T check = false;
+  int_T violated = 0;
+  int_T threads;
+  int_T i;
+  int_T r;
+  cfg.seed = 1U;
+  cfg.sequences = 1000000U;
+  cfg.ticks = 300U;
+  cfg.threads = 0;
+  cfg.p_standby = 0.5;
+  cfg.p_apfail = 0.5;
+  cfg.p_supported = 0.5;
+  cfg.p_limits = 0.5;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+    if (strcmp(opt, "-c") == 0) {
+      check = true;
+      continue;
+    }
+
+    if ((strlen(opt) != 2) || (opt[0] != '-') || (val == NULL)) {
+      usage();
+      return 2;
+    }
+
+    switch (opt[1]) {
+     case 'n':
+      cfg.sequences = strtoull(val, NULL, 0);
+      break;
+
+     case 't':
+      cfg.ticks = (uint32_T)strtoul(val, NULL, 0);
+      break;
+
+     case 'j':
+      cfg.threads = atoi(val);
+      break;
+
+     case 's':
+      cfg.seed = strtoull(val, NULL, 0);
+      break;
+
+     case 'p':
+      if (sscanf(val, "%lf,%lf,%lf,%lf", &cfg.p_standby, &cfg.p_apfail,
+                 &cfg.p_supported, &cfg.p_limits) != 4) {
+        usage();
+        return 2;
+      }
+      break;
+
+     default:
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if (check) {
+    const uint32_T bad = fsm_12B_table_check(fsm_12B_table_default);
+    printf("table: %u of %d entries disagree with fsm_12B_step\n", bad,
+           FSM_12B_TABLE_SIZE);
+    return (bad != 0U) ? 1 : 0;
+  }
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &t0);
+  threads = fsm_12B_mc_run(&cfg, &stats);
+  (void)clock_gettime(CLOCK_MONOTONIC, &t1);
+  if (threads == -2) {
+    fprintf(stderr, "mc: fsm_12B_step does not fit the transition table\n");
+    return 2;
+  }
+
+  if (threads < 0) {
+    fprintf(stderr, "mc: out of memory\n");
+    return 2;
+  }
+
+  secs = (real_T)(t1.tv_sec - t0.tv_sec) + 1.0e-9 * (real_T)(t1.tv_nsec -
+    t0.tv_nsec);
+  printf("fsm_12B: %lu sequences x %u ticks, seed %lu, %d threads, %.3f s, "
+         "%.1f Mticks/s\n", (unsigned long)stats.sequences, cfg.ticks,
+         (unsigned long)cfg.seed, threads, secs, (real_T)stats.ticks / secs /
+         1.0e6);
+  printf("p(standby, apfail, supported, limits) = %g, %g, %g, %g\n",
+         cfg.p_standby, cfg.p_apfail, cfg.p_supported, cfg.p_limits);
+  printf("pullup: %.6f of ticks, %.6f of sequences\n", (real_T)
+         stats.pullup_ticks / (real_T)stats.ticks, (real_T)
+         stats.pullup_sequences / (real_T)stats.sequences);
+  print_log2("  first pullup tick", stats.first_pullup);
+  printf("state visits (Manager/Sen/UnitDelay2):\n");
+  for (i = 0; i < FSM_12B_TABLE_STATES; i++) {
+    if (stats.visits[i] != 0U) {
+      printf("  %-10s %-10s %d  %.6f\n", mode_name[i / 6], sen_name[(i / 2) % 3],
+             i % 2, (real_T)stats.visits[i] / (real_T)stats.ticks);
+    }
+  }
+
+  printf("Manager dwell (ticks):\n");
+  for (i = 0; i < 4; i++) {
+    char_T label[32];
+    (void)snprintf(label, sizeof(label), "  %-10s", mode_name[i]);
+    print_log2(label, stats.dwell[i]);
+  }
+
+  for (r = 0; r < FSM_12B_NUM_REQUIREMENTS; r++) {
+    printf("Requirement %2d: %10lu reached %10lu violated", fsm_12B_requirements
+           [r].id, (unsigned long)stats.reached[r], (unsigned long)
+           stats.violations[r]);
+    if (stats.first_violation[r] != FSM_12B_MC_NONE) {
+      printf(", first in sequence %lu", (unsigned long)stats.first_violation[r]);
+      violated++;
+    }
+
+    printf("\n");
+  }
+
+  return (violated > 0) ? 1 : 0;
+}
+
+/*
+ * File trailer for mc_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,527 @@
+/*
+ * File: portfolio_main.c
+ *
+ * Verifies the requirements of an fsm_12B harness with a portfolio of
+ * verifier configurations racing on each one (fsm_12B_portfolio.h).
+ *
+ *   portfolio [-j jobs] [-w width] [-t seconds] [-m MiB] [-c cpus]
+ *             [-g cgroup|none] [-p file] [-e esbmc] [-d db] [-o outdir]
+ *             [-r list] [-v var] harness [-- esbmc options]
+ *
+ * The branch harnesses are those of verify: outdir/req_k.c, with the model
+ * from the directory of the harness.  Every configuration of the portfolio
+ * file -p ("name options ..." per line; default boolector, z3, kinduction
+ * and incremental) runs on it with the options after -- plus its own, and
+ * logs to outdir/req_k.name.log.  The first PASS or FAIL decides the
+ * requirement and the other jobs on it are killed.  -j jobs run at a time
+ * in all (default one per core), at most -w on one requirement (default
+ * all of its configurations).  -t, -m and -c limit each job to seconds of
+ * wall time, MiB of memory and cpus CPUs.  The jobs run in cgroups under
+ * -g, a path within the cgroup hierarchies, by default the cgroup of
+ * portfolio; -g none, or no usable cgroups, falls back to an address-space
+ * limit and no CPU quota.
+ *
+ * -d records every job in the SQLite store db (fsm_12B_store.h), the jobs
+ * killed by a winner with verdict "-" and the time they had, and orders
+ * the configurations of each requirement by their past times on it, so
+ * that with a narrow -w the likely winner starts first.  The default -w
+ * starts every configuration at once, whatever the order, so learning
+ * only takes effect with a -w below the number of configurations.
+ *
+ * Exit status: 0 all passed, 1 some failed, 2 usage or setup error,
+ * 3 some inconclusive and none failed.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "fsm_12B_portfolio.h"
+#include "fsm_12B_sha256.h"
+#include "fsm_12B_store.h"
+#include "fsm_12B_util.h"
+#include "fsm_12B_verify.h"
+#include "rtwtypes.h"
+
+#define MAX_OPTIONS                    64
+#define MAX_PATH                       4096
+
+typedef struct {
+  int_T value;
+  char_T name[16];
+  char_T source[MAX_PATH];
+  char_T hash[FSM_12B_SHA256_HEX];     /* of the branch harness */
+  fsm_12B_StoreCone cone;
+  boolean_T has_cone;
+} Requirement;
+
+/* A configuration with its options split into words */
+typedef struct {
+  fsm_12B_PortfolioConfig config;
+  char_T words[FSM_12B_PORTFOLIO_TEXT];
+  char_T *word[MAX_OPTIONS];
+  int_T nwords;
+  char_T options[MAX_PATH];            /* all options, as recorded */
+} Config;
+
+static volatile int_T stop;
+static Requirement req[FSM_12B_VERIFY_MAX_BRANCHES];
+static fsm_12B_PortfolioRace races[FSM_12B_VERIFY_MAX_BRANCHES];
+static Config config[FSM_12B_PORTFOLIO_MAX_CONFIGS];
+static fsm_12B_Store store;
+static fsm_12B_StoreModel current;
+
+static void on_signal(int sig)
+{
+  (void)sig;
+  stop = 1;
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: portfolio [-j jobs] [-w width] [-t seconds] "
+          "[-m MiB] [-c cpus] [-g cgroup|none] [-p file] [-e esbmc] [-d db] "
+          "[-o outdir] [-r list] [-v var] harness [-- esbmc options]\n"
+          "the order learned with -d only saves time with -w below the "
+          "number of configurations\n");
+}
+
+/* Split the options of c into words and join them after the common ones */
+static void split(Config *c, const char_T *common)
+{
+  char_T *save;
+  char_T *w;
+  (void)snprintf(c->words, sizeof(c->words), "%s", c->config.options);
+  c->nwords = 0;
+  for (w = strtok_r(c->words, " \t", &save); (w != NULL) && (c->nwords <
+        MAX_OPTIONS); w = strtok_r(NULL, " \t", &save)) {
+    c->word[c->nwords++] = w;
+  }
+
+  (void)snprintf(c->options, sizeof(c->options), "%s%s%s", common, ((common[0]
+    != '\0') && (c->config.options[0] != '\0')) ? " " : "", c->config.options);
+}
+
+/* The state of configuration c in race r, for the report */
+static const char_T *state(const fsm_12B_PortfolioRace *r, int_T c)
+{
+  int_T k;
+  if (r->lost[c]) {
+    return "killed";
+  }
+
+  for (k = 0; k < r->started; k++) {
+    if (r->order[k] == c) {
+      return fsm_12B_verify_verdict_name[r->job[c].verdict];
+    }
+  }
+
+  return "-";
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  static fsm_12B_Harness h;
+  static fsm_12B_Cgroups cg;
+  const char_T *esbmc = "esbmc";
+  const char_T *outdir = "portfolio.out";
+  const char_T *db = NULL;
+  const char_T *file = NULL;
+  const char_T *parent = NULL;
+  const char_T *list = NULL;
+  const char_T *var = "sit";
+  const char_T *harness = NULL;
+  const char_T *options[MAX_OPTIONS];
+  fsm_12B_PortfolioLimits lim;
+  char_T modeldir[MAX_PATH];
+  char_T model_c[MAX_PATH + 16];
+  char_T include[MAX_PATH + 2];
+  char_T version[256];
+  char_T joined[MAX_PATH];
+  char_T path[MAX_PATH + 32];
+  uint8_T digest[FSM_12B_SHA256_BYTES];
+  int_T noptions = 0;
+  int_T nconfigs;
+  int_T nreq = 0;
+  int_T count[FSM_12B_VERIFY_VERDICTS];
+  int_T started = 0;
+  int_T killed = 0;
+  int_T total = 0;
+  char_T *text;
+  size_t len;
+  char_T *slash;
+  FILE *report;
+  int_T i;
+  int_T c;
+  int_T k;
+  memset(&lim, 0, sizeof(lim));
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (strcmp(opt, "--") == 0) {
+      for (i++; (i < argc) && (noptions < MAX_OPTIONS); i++) {
+        options[noptions++] = argv[i];
+      }
+
+      break;
+    }
+
+    if (opt[0] != '-') {
+      if (harness != NULL) {
+        usage();
+        return 2;
+      }
+
+      harness = opt;
+      continue;
+    }
+
+    if (strcmp(opt, "-j") == 0) {
+      lim.parallel = atoi(val);
+    } else if (strcmp(opt, "-w") == 0) {
+      lim.width = atoi(val);
+    } else if (strcmp(opt, "-t") == 0) {
+      lim.timeout = atof(val);
+    } else if (strcmp(opt, "-m") == 0) {
+      lim.mem_mib = strtoull(val, NULL, 0);
+    } else if (strcmp(opt, "-c") == 0) {
+      lim.cpus = atof(val);
+    } else if (strcmp(opt, "-g") == 0) {
+      parent = val;
+    } else if (strcmp(opt, "-p") == 0) {
+      file = val;
+    } else if (strcmp(opt, "-e") == 0) {
+      esbmc = val;
+    } else if (strcmp(opt, "-d") == 0) {
+      db = val;
+    } else if (strcmp(opt, "-o") == 0) {
+      outdir = val;
+    } else if (strcmp(opt, "-r") == 0) {
+      list = val;
+    } else if (strcmp(opt, "-v") == 0) {
+      var = val;
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if (harness == NULL) {
+    usage();
+    return 2;
+  }
+
+  if (lim.parallel <= 0) {
+    lim.parallel = (int_T)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  /* The portfolio */
+  if (file != NULL) {
+    static fsm_12B_PortfolioConfig parsed[FSM_12B_PORTFOLIO_MAX_CONFIGS];
+    char_T error[FSM_12B_PORTFOLIO_TEXT];
+    text = fsm_12B_slurp(file, &len);
+    if (text == NULL) {
+      fprintf(stderr, "portfolio: cannot read %s\n", file);
+      return 2;
+    }
+
+    nconfigs = fsm_12B_portfolio_parse(text, parsed,
+      FSM_12B_PORTFOLIO_MAX_CONFIGS, error, sizeof(error));
+    free(text);
+    if (nconfigs <= 0) {
+      fprintf(stderr, "portfolio: %s: %s\n", file, (nconfigs < 0) ? error :
+              "no configuration");
+      return 2;
+    }
+
+    for (c = 0; c < nconfigs; c++) {
+      config[c].config = parsed[c];
+    }
+  } else {
+    nconfigs = 4;
+    for (c = 0; c < nconfigs; c++) {
+      config[c].config = fsm_12B_portfolio_default[c];
+    }
+  }
+
+  joined[0] = '\0';
+  for (i = 0; i < noptions; i++) {
+    const size_t used = strlen(joined);
+    (void)snprintf(&joined[used], sizeof(joined) - used, "%s%s", (i > 0) ? " "
+                   : "", options[i]);
+  }
+
+  for (c = 0; c < nconfigs; c++) {
+    split(&config[c], joined);
+    if (noptions + config[c].nwords > MAX_OPTIONS) {
+      fprintf(stderr, "portfolio: too many options for %s\n",
+              config[c].config.name);
+      return 2;
+    }
+  }
+
+  text = fsm_12B_slurp(harness, &len);
+  if (text == NULL) {
+    fprintf(stderr, "portfolio: cannot read %s\n", harness);
+    return 2;
+  }
+
+  if (fsm_12B_verify_split(&h, text, len, var) <= 0) {
+    fprintf(stderr, "portfolio: no \"if (%s == k) { ... }\" chain in %s\n",
+            var, harness);
+    return 2;
+  }
+
+  (void)snprintf(modeldir, sizeof(modeldir), "%s", harness);
+  slash = strrchr(modeldir, '/');
+  if (slash != NULL) {
+    *slash = '\0';
+  } else {
+    (void)snprintf(modeldir, sizeof(modeldir), ".");
+  }
+
+  fsm_12B_verify_tool_version(esbmc, version, sizeof(version));
+  if ((db != NULL) && ((fsm_12B_store_open(&store, db) != 0) ||
+                       (fsm_12B_store_load(&current, modeldir) != 0) ||
+                       (fsm_12B_store_add_model(&store, &current) != 0))) {
+    fprintf(stderr, "portfolio: %s: %s\n", db, (store.error[0] != '\0') ?
+            store.error : "cannot read the model");
+    return 2;
+  }
+
+  /* An explicit cgroup must work; the default one may not */
+  if ((parent == NULL) || (strcmp(parent, "none") != 0)) {
+    if (fsm_12B_cgroups_init(&cg, parent) != 0) {
+      fprintf(stderr, "portfolio: %s\n", cg.error);
+      if (parent != NULL) {
+        return 2;
+      }
+
+      fprintf(stderr, "portfolio: running without cgroups%s\n", (lim.cpus >
+               0.0) ? "; no CPU quota" : "");
+    }
+  }
+
+  (void)mkdir(outdir, 0755);
+  (void)snprintf(model_c, sizeof(model_c), "%s/fsm_12B.c", modeldir);
+  (void)snprintf(include, sizeof(include), "-I%s", modeldir);
+  for (i = 0; i < h.nbranches; i++) {
+    Requirement *r;
+    fsm_12B_PortfolioRace *race;
+    int_T runs[FSM_12B_PORTFOLIO_MAX_CONFIGS];
+    int_T conclusive[FSM_12B_PORTFOLIO_MAX_CONFIGS];
+    real_T seconds[FSM_12B_PORTFOLIO_MAX_CONFIGS];
+    boolean_T known = false;
+    char_T *branch;
+    FILE *fp;
+    if (!fsm_12B_selected(list, h.branch[i].value)) {
+      continue;
+    }
+
+    race = &races[nreq];
+    r = &req[nreq++];
+    r->value = h.branch[i].value;
+    (void)snprintf(r->name, sizeof(r->name), "%d", r->value);
+    (void)snprintf(r->source, sizeof(r->source), "%s/req_%d.c", outdir,
+                   r->value);
+    branch = fsm_12B_verify_harness(&h, i, &len);
+    fp = (branch != NULL) ? fopen(r->source, "wb") : NULL;
+    if ((fp == NULL) || (fwrite(branch, 1, len, fp) != len)) {
+      fprintf(stderr, "portfolio: cannot write %s\n", r->source);
+      return 2;
+    }
+
+    (void)fclose(fp);
+    if (db != NULL) {
+      fsm_12B_Sha256 sha;
+      fsm_12B_sha256_init(&sha);
+      fsm_12B_sha256_field(&sha, branch, len);
+      fsm_12B_sha256_final(&sha, digest);
+      fsm_12B_sha256_hex(digest, r->hash);
+      r->has_cone = (fsm_12B_store_cone(&current, branch, len, false,
+        &r->cone) == 0);
+      if (!r->has_cone) {
+        fprintf(stderr, "portfolio: requirement %d asserts nothing of the "
+                "model; it is not recorded in %s\n", r->value, db);
+      }
+    }
+
+    free(branch);
+
+    /* The configurations by their past times on this requirement */
+    for (c = 0; c < nconfigs; c++) {
+      runs[c] = 0;
+      conclusive[c] = 0;
+      seconds[c] = 0.0;
+      if ((db != NULL) && (fsm_12B_store_times(&store, harness, r->name,
+            version, config[c].options, &runs[c], &conclusive[c], &seconds[c])
+           != 0)) {
+        fprintf(stderr, "portfolio: %s: %s\n", db, store.error);
+        return 2;
+      }
+
+      known = known || (runs[c] > 0);
+    }
+
+    fsm_12B_portfolio_rank(runs, conclusive, seconds, nconfigs, race->order);
+    race->nconfigs = nconfigs;
+    for (c = 0; c < nconfigs; c++) {
+      const Config *cf = &config[c];
+      char_T **v = (char_T **)malloc((size_t)(noptions + cf->nwords + 5) *
+        sizeof(char_T *));
+      char_T *log = (char_T *)malloc(MAX_PATH);
+      if ((v == NULL) || (log == NULL)) {
+        fprintf(stderr, "portfolio: out of memory\n");
+        return 2;
+      }
+
+      (void)snprintf(log, MAX_PATH, "%.4000s/req_%d.%.31s.log", outdir,
+                     r->value, cf->config.name);
+      v[0] = (char_T *)esbmc;
+      v[1] = r->source;
+      v[2] = model_c;
+      v[3] = include;
+      for (k = 0; k < noptions; k++) {
+        v[4 + k] = (char_T *)options[k];
+      }
+
+      for (k = 0; k < cf->nwords; k++) {
+        v[4 + noptions + k] = cf->word[k];
+      }
+
+      v[4 + noptions + cf->nwords] = NULL;
+      race->job[c].argv = v;
+      race->job[c].log = log;
+    }
+
+    if (known) {
+      printf("  %3d: ", r->value);
+      for (c = 0; c < nconfigs; c++) {
+        printf("%s%s", (c > 0) ? " " : "", config[race->order[c]].config.name);
+      }
+
+      printf("\n");
+    }
+  }
+
+  free(text);
+  if (nreq == 0) {
+    fprintf(stderr, "portfolio: no requirement selected\n");
+    return 2;
+  }
+
+  (void)signal(SIGINT, on_signal);
+  (void)signal(SIGTERM, on_signal);
+  printf("%s: %d requirements, %d configurations, %d jobs at a time, %d per "
+         "requirement, ", harness, nreq, nconfigs, lim.parallel, ((lim.width >
+           0) && (lim.width < nconfigs)) ? lim.width : nconfigs);
+  if (cg.version != 0) {
+    printf("cgroup v%d under %s\n", cg.version, cg.cpu);
+  } else {
+    printf("no cgroups\n");
+  }
+
+  (void)fflush(stdout);
+  fsm_12B_portfolio_run(races, nreq, &lim, &cg, &stop);
+
+  /* Report */
+  (void)snprintf(path, sizeof(path), "%s/report.txt", outdir);
+  report = fopen(path, "w");
+  if (report == NULL) {
+    fprintf(stderr, "portfolio: cannot write %s\n", path);
+    return 2;
+  }
+
+  memset(count, 0, sizeof(count));
+  fprintf(report, "harness  %s\nmodel    %s\nverifier %s %s\n\n", harness,
+          modeldir, version, joined);
+  for (k = 0; k < 2; k++) {
+    FILE *out = (k == 0) ? stdout : report;
+    fprintf(out, "  req  verdict   seconds  peak MiB  winner        "
+            "configurations in order\n");
+    for (i = 0; i < nreq; i++) {
+      const fsm_12B_PortfolioRace *race = &races[i];
+      fprintf(out, "  %3d  %-8s %8.2f  %8.1f  %-12s ", req[i].value,
+              fsm_12B_verify_verdict_name[race->verdict], race->seconds,
+              (race->winner >= 0) ? (real_T)race->job[race->winner].peak_kib /
+              1024.0 : 0.0, (race->winner >= 0) ?
+              config[race->winner].config.name : "-");
+      for (c = 0; c < race->nconfigs; c++) {
+        const int_T o = race->order[c];
+        fprintf(out, " %s:%s", config[o].config.name, state(race, o));
+      }
+
+      fprintf(out, "\n");
+    }
+  }
+
+  for (i = 0; i < nreq; i++) {
+    const fsm_12B_PortfolioRace *race = &races[i];
+    Requirement *r = &req[i];
+    count[race->verdict]++;
+    total += race->nconfigs;
+    started += race->started;
+    if (race->verdict == FSM_12B_VERIFY_FAIL) {
+      fprintf(report, "\nRequirement %d: counterexample (%s)\n", r->value,
+              config[race->winner].config.name);
+      fsm_12B_verify_copy_trace(report, race->job[race->winner].log);
+    }
+
+    for (k = 0; k < race->started; k++) {
+      const int_T o = race->order[k];
+      const fsm_12B_VerifyJob *job = &race->job[o];
+      fsm_12B_StoreRun run;
+      char_T *trace;
+      killed += race->lost[o] ? 1 : 0;
+      if ((db == NULL) || !r->has_cone || ((job->verdict ==
+            FSM_12B_VERIFY_NONE) && !race->lost[o])) {
+        continue;
+      }
+
+      trace = (job->verdict == FSM_12B_VERIFY_FAIL) ? fsm_12B_store_trace
+        (job->log) : NULL;
+      memset(&run, 0, sizeof(run));
+      run.harness = harness;
+      run.requirement = r->name;
+      run.harness_hash = r->hash;
+      run.model_hash = current.hash;
+      run.cone = &r->cone;
+      run.tool_version = version;
+      run.options = config[o].options;
+      run.verdict = job->verdict;
+      run.seconds = job->seconds;
+      run.peak_kib = job->peak_kib;
+      run.counterexample = trace;
+      if (fsm_12B_store_add_run(&store, &run) != 0) {
+        fprintf(stderr, "portfolio: cannot record requirement %d in %s: %s\n",
+                r->value, db, store.error);
+      }
+
+      free(trace);
+    }
+  }
+
+  (void)fclose(report);
+  fsm_12B_store_close(&store);
+  fsm_12B_store_unload(&current);
+  printf("%d passed, %d failed, %d inconclusive; %d of %d jobs started, %d "
+         "killed by a winner; report in %s\n", count[FSM_12B_VERIFY_PASS],
+         count[FSM_12B_VERIFY_FAIL], nreq - count[FSM_12B_VERIFY_PASS] -
+         count[FSM_12B_VERIFY_FAIL], started, total, killed, path);
+  if (count[FSM_12B_VERIFY_FAIL] != 0) {
+    return 1;
+  }
+
+  return (count[FSM_12B_VERIFY_PASS] != nreq) ? 3 : 0;
+}
+
+/*
+ * File trailer for portfolio_main.c
+ *
+ * [EOF]
+ */
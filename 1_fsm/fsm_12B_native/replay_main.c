@@ -0,0 +1,124 @@
+/*
+ * File: replay_main.c
+ *
+ * Replays a recorded input trace through fsm_12B.
+ *
+ *   replay <input trace> <output trace>
+ *
+ * Both files are memory-mapped: the input read-only, the output sized up
+ * front with ftruncate and written through a shared mapping.  The output
+ * must not be the input file, under the same or another name.  The replay
+ * loop itself makes no system calls and no allocations, so traces of many
+ * gigabytes stream at memory speed.  See fsm_12B_replay.h for the record
+ * layouts.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "fsm_12B.h"
+#include "fsm_12B_replay.h"
+
+static RT_MODEL rtM_;
+static RT_MODEL *const rtMPtr = &rtM_; /* Real-time model */
+static DW rtDW;                        /* Observable states */
+
+int_T main(int_T argc, const char *argv[])
+{
+  RT_MODEL *const rtM = rtMPtr;
+  const fsm_12B_InRecord *in = NULL;
+  fsm_12B_OutRecord *out = NULL;
+  struct stat st;
+  struct stat out_st;
+  uint64_T nticks;
+  size_t in_bytes;
+  size_t out_bytes;
+  int in_fd;
+  int out_fd;
+  if (argc != 3) {
+    fprintf(stderr, "usage: replay <input trace> <output trace>\n");
+    return 2;
+  }
+
+  in_fd = open(argv[1], O_RDONLY);
+  if ((in_fd < 0) || (fstat(in_fd, &st) != 0)) {
+    fprintf(stderr, "replay: %s: %s\n", argv[1], strerror(errno));
+    return 1;
+  }
+
+  if (((uint64_T)st.st_size % sizeof(fsm_12B_InRecord)) != 0U) {
+    fprintf(stderr, "replay: %s: size is not a multiple of %u bytes\n", argv[1],
+            (uint32_T)sizeof(fsm_12B_InRecord));
+    return 1;
+  }
+
+  nticks = (uint64_T)st.st_size / sizeof(fsm_12B_InRecord);
+  in_bytes = (size_t)st.st_size;
+  out_bytes = (size_t)(nticks * sizeof(fsm_12B_OutRecord));
+
+  /* Not truncated before it is known not to be the input under another name */
+  out_fd = open(argv[2], O_RDWR | O_CREAT, 0644);
+  if ((out_fd < 0) || (fstat(out_fd, &out_st) != 0)) {
+    fprintf(stderr, "replay: %s: %s\n", argv[2], strerror(errno));
+    return 1;
+  }
+
+  if ((out_st.st_dev == st.st_dev) && (out_st.st_ino == st.st_ino)) {
+    fprintf(stderr, "replay: %s and %s are the same file\n", argv[1], argv[2]);
+    return 1;
+  }
+
+  if (ftruncate(out_fd, (off_t)out_bytes) != 0) {
+    fprintf(stderr, "replay: %s: %s\n", argv[2], strerror(errno));
+    return 1;
+  }
+
+  if (nticks > 0U) {
+    void *p = mmap(NULL, in_bytes, PROT_READ, MAP_PRIVATE, in_fd, 0);
+    void *q = mmap(NULL, out_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, out_fd,
+                   0);
+    if ((p == MAP_FAILED) || (q == MAP_FAILED)) {
+      fprintf(stderr, "replay: mmap: %s\n", strerror(errno));
+      return 1;
+    }
+
+    (void)posix_madvise(p, in_bytes, POSIX_MADV_SEQUENTIAL);
+    (void)posix_madvise(q, out_bytes, POSIX_MADV_SEQUENTIAL);
+    in = (const fsm_12B_InRecord *)p;
+    out = (fsm_12B_OutRecord *)q;
+  }
+
+  /* Pack model data into RTM */
+  rtM->dwork = &rtDW;
+
+  /* Initialize model */
+  fsm_12B_initialize(rtM);
+
+  /* Step the model across the whole trace */
+  fsm_12B_replay(rtM, in, out, nticks);
+  if (nticks > 0U) {
+    if (msync(out, out_bytes, MS_SYNC) != 0) {
+      fprintf(stderr, "replay: %s: %s\n", argv[2], strerror(errno));
+      return 1;
+    }
+
+    (void)munmap(out, out_bytes);
+    (void)munmap((void *)in, in_bytes);
+  }
+
+  (void)close(out_fd);
+  (void)close(in_fd);
+  return 0;
+}
+
+/*
+ * File trailer for replay_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,217 @@
+/*
+ * File: rt_main.c
+ *
+ * Runs rt_OneStep of fsm_12B in real time, at its 0.2 s base rate or
+ * faster, and reports release jitter, response times and overruns.
+ *
+ *   rt [-n releases] [-a speedup] [-t nanosleep|timerfd]
+ *      [-o skip|catchup|abort] [-f fifo priority] [-c cpu] [-m]
+ *
+ * -a 1000 runs at 5 kHz.  -f, -c and -m need the matching privileges
+ * (CAP_SYS_NICE, CAP_IPC_LOCK or an rlimit allowing them).  SIGINT stops
+ * the run and still prints the report.
+ *
+ * Exit status: 0 completed, 1 aborted on overrun, 2 usage or setup error.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B.h"
+#include "fsm_12B_rt.h"
+
+static RT_MODEL rtM_;
+static RT_MODEL *const rtMPtr = &rtM_; /* Real-time model */
+static DW rtDW;                        /* Observable states */
+
+/* '<Root>/standby' .. '<Root>/limits' */
+static boolean_T rtU_standby;
+static boolean_T rtU_apfail;
+static boolean_T rtU_supported;
+static boolean_T rtU_limits;
+
+/* '<Root>/pullup' */
+static boolean_T rtY_pullup;
+static uint64_T pullups;
+static volatile int_T stop;
+static fsm_12B_RtStats stats;
+
+static void on_signal(int sig)
+{
+  (void)sig;
+  stop = 1;
+}
+
+/*
+ * Associating rt_OneStep with a real-time clock or interrupt service routine
+ * is what makes the generated code "real-time".  Here the executor releases
+ * it once per base-rate period.
+ */
+static void rt_OneStep(void *arg)
+{
+  static boolean_T OverrunFlag = false;
+  static uint32_T x = 2463534242U;
+  RT_MODEL *const rtM = (RT_MODEL *)arg;
+
+  /* Check for overrun */
+  if (OverrunFlag) {
+    return;
+  }
+
+  OverrunFlag = true;
+
+  /* Set model inputs here */
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  rtU_standby = (boolean_T)(x & 1U);
+  rtU_apfail = (boolean_T)((x >> 8) & 1U);
+  rtU_supported = (boolean_T)((x >> 16) & 1U);
+  rtU_limits = (boolean_T)((x >> 24) & 1U);
+
+  /* Step the model */
+  fsm_12B_step(rtM, rtU_standby, rtU_apfail, rtU_supported, rtU_limits,
+               &rtY_pullup);
+
+  /* Get model outputs here */
+  pullups += rtY_pullup ? 1U : 0U;
+
+  /* Indicate task complete */
+  OverrunFlag = false;
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: rt [-n releases] [-a speedup] [-t nanosleep|timerfd] "
+          "[-o skip|catchup|abort] [-f priority] [-c cpu] [-m]\n");
+}
+
+static void print_hist(const char_T *label, const uint64_T *hist, uint64_T max)
+{
+  int_T b;
+  printf("%s (ns), max %lu:\n", label, (unsigned long)max);
+
+  /* One line per power of two */
+  for (b = 0; b < FSM_12B_LAT_BUCKETS; b += FSM_12B_LAT_SUB) {
+    uint64_T sum = 0U;
+    int_T j;
+    for (j = 0; j < FSM_12B_LAT_SUB; j++) {
+      sum += hist[b + j];
+    }
+
+    if (sum != 0U) {
+      printf("  %12lu .. %12lu  %lu\n", (unsigned long)fsm_12B_lat_bucket_low(b),
+             (unsigned long)fsm_12B_lat_bucket_high(b + FSM_12B_LAT_SUB - 1),
+             (unsigned long)sum);
+    }
+  }
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  RT_MODEL *const rtM = rtMPtr;
+  fsm_12B_RtConfig cfg;
+  fsm_12B_RtStatus status;
+  real_T speedup = 1.0;
+  int_T i;
+  cfg.releases = 0U;
+  cfg.policy = FSM_12B_RT_SKIP;
+  cfg.timer = FSM_12B_RT_NANOSLEEP;
+  cfg.priority = 0;
+  cfg.cpu = -1;
+  cfg.lock_memory = false;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if ((strlen(opt) != 2) || (opt[0] != '-')) {
+      usage();
+      return 2;
+    }
+
+    switch (opt[1]) {
+     case 'm':
+      cfg.lock_memory = true;
+      continue;
+
+     case 'n':
+      cfg.releases = strtoull(val, NULL, 0);
+      break;
+
+     case 'a':
+      speedup = atof(val);
+      break;
+
+     case 't':
+      if (strcmp(val, "timerfd") == 0) {
+        cfg.timer = FSM_12B_RT_TIMERFD;
+      } else if (strcmp(val, "nanosleep") != 0) {
+        usage();
+        return 2;
+      }
+      break;
+
+     case 'o':
+      if (strcmp(val, "catchup") == 0) {
+        cfg.policy = FSM_12B_RT_CATCH_UP;
+      } else if (strcmp(val, "abort") == 0) {
+        cfg.policy = FSM_12B_RT_ABORT;
+      } else if (strcmp(val, "skip") != 0) {
+        usage();
+        return 2;
+      }
+      break;
+
+     case 'f':
+      cfg.priority = atoi(val);
+      break;
+
+     case 'c':
+      cfg.cpu = atoi(val);
+      break;
+
+     default:
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if (!(speedup > 0.0)) {
+    usage();
+    return 2;
+  }
+
+  cfg.period = FSM_12B_LAT_BASE_RATE / speedup;
+  (void)signal(SIGINT, on_signal);
+  (void)signal(SIGTERM, on_signal);
+
+  /* Pack model data into RTM */
+  rtM->dwork = &rtDW;
+
+  /* Initialize model */
+  fsm_12B_initialize(rtM);
+  status = fsm_12B_rt_run(&cfg, rt_OneStep, rtM, &stop, &stats);
+  if (status == FSM_12B_RT_ERROR) {
+    fprintf(stderr, "rt: %s\n", strerror(errno));
+    return 2;
+  }
+
+  printf("fsm_12B: period %g s, %lu releases, %lu steps, %lu overruns, "
+         "%lu skipped, %lu pullups%s\n", cfg.period, (unsigned long)
+         stats.releases, (unsigned long)stats.steps, (unsigned long)
+         stats.overruns, (unsigned long)stats.skipped, (unsigned long)pullups,
+         (status == FSM_12B_RT_ABORTED) ? ", aborted on overrun" : "");
+  print_hist("release jitter", stats.jitter, stats.max_jitter);
+  print_hist("response time", stats.response, stats.max_response);
+  return (status == FSM_12B_RT_ABORTED) ? 1 : 0;
+}
+
+/*
+ * File trailer for rt_main.c
+ *
+ * [EOF]
+ */
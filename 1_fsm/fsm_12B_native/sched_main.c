@@ -0,0 +1,212 @@
+/*
+ * File: sched_main.c
+ *
+ * Hosts many fsm_12B instances, each with its own RT_MODEL/DW, on the
+ * rate-monotonic scheduler and reports missed deadlines per instance.
+ *
+ *   sched [-n instances] [-w workers] [-d seconds] [-a speedup] [-r rates]
+ *         [-p]
+ *
+ * Instance i runs at the 0.2 s base rate divided by 2^(i % rates) and by
+ * speedup, with its first release spread evenly over its period.  -p pins
+ * worker w to CPU w.
+ *
+ * Exit status: 0 no missed deadline, 1 some missed, 2 usage or setup
+ * error.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "fsm_12B.h"
+#include "fsm_12B_sched.h"
+
+#define MAX_REPORT                     20
+
+/* One hosted controller */
+typedef struct {
+  RT_MODEL rtM;                        /* Real-time model */
+  DW rtDW;                             /* Observable states */
+  uint32_T x;                          /* input generator */
+  boolean_T OverrunFlag;
+  boolean_T rtY_pullup;                /* '<Root>/pullup' */
+  uint64_T pullups;
+} Instance;
+
+static volatile int_T stop;
+
+static void on_signal(int sig)
+{
+  (void)sig;
+  stop = 1;
+}
+
+static void rt_OneStep(void *arg)
+{
+  Instance *inst = (Instance *)arg;
+
+  /* Check for overrun */
+  if (inst->OverrunFlag) {
+    return;
+  }
+
+  inst->OverrunFlag = true;
+
+  /* Set model inputs here */
+  inst->x ^= inst->x << 13;
+  inst->x ^= inst->x >> 17;
+  inst->x ^= inst->x << 5;
+
+  /* Step the model */
+  fsm_12B_step(&inst->rtM, (boolean_T)(inst->x & 1U), (boolean_T)((inst->x >> 8)
+    & 1U), (boolean_T)((inst->x >> 16) & 1U), (boolean_T)((inst->x >> 24) & 1U),
+               &inst->rtY_pullup);
+
+  /* Get model outputs here */
+  inst->pullups += inst->rtY_pullup ? 1U : 0U;
+
+  /* Indicate task complete */
+  inst->OverrunFlag = false;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  fsm_12B_Sched s;
+  fsm_12B_SchedTask *tasks;
+  Instance *inst;
+  int_T n = 100;
+  int_T nworkers = (int_T)sysconf(_SC_NPROCESSORS_ONLN);
+  int_T rates = 4;
+  real_T seconds = 10.0;
+  real_T speedup = 1.0;
+  boolean_T pin = false;
+  uint64_T releases = 0U;
+  uint64_T missed = 0U;
+  uint64_T dropped = 0U;
+  int_T reported = 0;
+  int_T i;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if ((strlen(opt) != 2) || (opt[0] != '-')) {
+      fprintf(stderr, "sched: unknown option %s\n", opt);
+      return 2;
+    }
+
+    switch (opt[1]) {
+     case 'p':
+      pin = true;
+      continue;
+
+     case 'n':
+      n = atoi(val);
+      break;
+
+     case 'w':
+      nworkers = atoi(val);
+      break;
+
+     case 'd':
+      seconds = atof(val);
+      break;
+
+     case 'a':
+      speedup = atof(val);
+      break;
+
+     case 'r':
+      rates = atoi(val);
+      break;
+
+     default:
+      fprintf(stderr, "usage: sched [-n instances] [-w workers] [-d seconds] "
+              "[-a speedup] [-r rates] [-p]\n");
+      return 2;
+    }
+
+    i++;
+  }
+
+  if ((n < 1) || (nworkers < 1) || (rates < 1) || (rates > 30) || !(speedup >
+       0.0)) {
+    fprintf(stderr, "sched: bad arguments\n");
+    return 2;
+  }
+
+  inst = (Instance *)calloc((size_t)n, sizeof(Instance));
+  tasks = (fsm_12B_SchedTask *)calloc((size_t)n, sizeof(fsm_12B_SchedTask));
+  if ((inst == NULL) || (tasks == NULL)) {
+    fprintf(stderr, "sched: out of memory\n");
+    return 2;
+  }
+
+  for (i = 0; i < n; i++) {
+    /* Pack model data into RTM */
+    inst[i].rtM.dwork = &inst[i].rtDW;
+    inst[i].x = 2463534242U + (uint32_T)i;
+
+    /* Initialize model */
+    fsm_12B_initialize(&inst[i].rtM);
+    tasks[i].step = rt_OneStep;
+    tasks[i].arg = &inst[i];
+    tasks[i].period = (int64_T)(2.0e8 / speedup) >> (i % rates);
+    if (tasks[i].period < 1) {
+      tasks[i].period = 1;
+    }
+
+    tasks[i].offset = tasks[i].period * (int64_T)(i / rates) / (int64_T)((n +
+      rates - 1) / rates);
+    tasks[i].worker = -1;
+  }
+
+  if (fsm_12B_sched_init(&s, tasks, n, nworkers, pin) != 0) {
+    fprintf(stderr, "sched: cannot set up %d workers\n", nworkers);
+    return 2;
+  }
+
+  (void)signal(SIGINT, on_signal);
+  (void)signal(SIGTERM, on_signal);
+  if (fsm_12B_sched_run(&s, (int64_T)(seconds * 1.0e9), &stop) != 0) {
+    fprintf(stderr, "sched: cannot start workers\n");
+    return 2;
+  }
+
+  for (i = 0; i < n; i++) {
+    releases += tasks[i].releases;
+    missed += tasks[i].missed;
+    dropped += tasks[i].dropped;
+  }
+
+  printf("fsm_12B: %d instances, %d workers, %.1f s, %lu releases, %lu missed "
+         "(%lu dropped)\n", n, nworkers, seconds, (unsigned long)releases,
+         (unsigned long)missed, (unsigned long)dropped);
+  for (i = 0; i < nworkers; i++) {
+    printf("  worker %d: rate %.1f Hz, busy %.3f%%\n", i, s.workers[i].load,
+           100.0 * (real_T)s.workers[i].busy / (seconds * 1.0e9));
+  }
+
+  for (i = 0; i < n; i++) {
+    const fsm_12B_SchedTask *t = &tasks[i];
+    if ((t->missed != 0U) && (reported < MAX_REPORT)) {
+      printf("  instance %4d: period %10.0f ns, prio %4d, worker %2d, %lu/%lu "
+             "missed, %lu dropped, max response %.0f ns\n", i, (real_T)t->period,
+             t->priority, t->worker, (unsigned long)t->missed, (unsigned long)
+             t->releases, (unsigned long)t->dropped, (real_T)t->max_response);
+      reported++;
+    }
+  }
+
+  fsm_12B_sched_free(&s);
+  free(tasks);
+  free(inst);
+  return (missed != 0U) ? 1 : 0;
+}
+
+/*
+ * File trailer for sched_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,247 @@
+/*
+ * File: shim_main.c
+ *
+ * Runs an ESBMC harness natively through fsm_12B_shim: many generated
+ * trials as a smoke test, or one trial per input file for AFL and for
+ * replaying a saved failure.
+ *
+ *   shim [-n trials] [-s seed] [-t seconds] [-o dir] [-a] [input...]
+ *
+ * The harness is compiled with -include fsm_12B_shim.h and
+ * -Dmain=fsm_12B_harness.  -o saves the first input of every distinct
+ * failed assertion as dir/fail-<k>.bin; -a aborts on the first one, which
+ * is what AFL needs:  afl-fuzz -i seeds -o out -- ./shim -a @@
+ *
+ * Built with -DFSM_12B_SHIM_LIBFUZZER this file provides
+ * LLVMFuzzerTestOneInput instead of main.  libFuzzer keeps its own state
+ * in the executable, so there the harness object must have its data in
+ * the section fsm_12B_harness_data (fsm_12B_shim.c), and only that
+ * section is reset between inputs.
+ *
+ * Exit status: 0 no failed assertion, 1 some failed, 2 usage error.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_shim.h"
+#include "fsm_12B_util.h"
+#include "rtwtypes.h"
+
+#define MAX_MESSAGES                   64
+#define MAX_INPUT                      (1U << 20)
+
+/* The renamed main of the harness */
+extern int fsm_12B_harness();
+
+static void harness(void)
+{
+  static const char *argv[2] = { "harness", NULL };
+
+  (void)fsm_12B_harness(1, argv);
+}
+
+#ifdef FSM_12B_SHIM_LIBFUZZER
+
+int LLVMFuzzerTestOneInput(const unsigned char *data, size_t size)
+{
+  static fsm_12B_Shim s;
+  static boolean_T ready = false;
+  if (!ready) {
+    if (fsm_12B_shim_init(&s, 0U, FSM_12B_SHIM_ABORT) != 0) {
+      fprintf(stderr, "shim: the harness data is not in section "
+              "fsm_12B_harness_data\n");
+      exit(2);
+    }
+
+    ready = true;
+  }
+
+  (void)fsm_12B_shim_run(&s, harness, data, size);
+  return 0;
+}
+
+#else
+
+/* Failures with the same message, and the first input that caused them */
+typedef struct {
+  const char *message;
+  uint64_T count;
+  uint8_T *input;
+  size_t len;
+} Failure;
+
+static size_t read_input(const char *path, uint8_T *buf)
+{
+  FILE *fp = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+  size_t n;
+  if (fp == NULL) {
+    fprintf(stderr, "shim: cannot open %s\n", path);
+    exit(2);
+  }
+
+  n = fread(buf, 1, MAX_INPUT, fp);
+  if (fp != stdin) {
+    (void)fclose(fp);
+  }
+
+  return n;
+}
+
+static void record(Failure *fail, int_T *nfail, const char *message, const
+                   uint8_T *input, size_t len)
+{
+  int_T k;
+  for (k = 0; k < *nfail; k++) {
+    if (strcmp(fail[k].message, message) == 0) {
+      fail[k].count++;
+      return;
+    }
+  }
+
+  if (*nfail < MAX_MESSAGES) {
+    Failure *f = &fail[(*nfail)++];
+    f->message = message;
+    f->count = 1U;
+    f->input = (uint8_T *)malloc(len + 1U);
+    f->len = (f->input != NULL) ? len : 0U;
+    if (f->input != NULL) {
+      memcpy(f->input, input, len);
+    }
+  }
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  fsm_12B_Shim s;
+  Failure fail[MAX_MESSAGES];
+  uint8_T *buf = NULL;
+  const char *dir = NULL;
+  uint64_T trials = 1000000U;
+  uint64_T seed = 1U;
+  real_T seconds = 0.0;
+  boolean_T abort_on_fail = false;
+  uint64_T count[3] = { 0U, 0U, 0U };
+  int_T nfail = 0;
+  int_T first = argc;
+  real_T t0;
+  real_T secs;
+  int_T i;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if ((opt[0] != '-') || (strcmp(opt, "-") == 0)) {
+      first = i;
+      break;
+    }
+
+    if (strcmp(opt, "-a") == 0) {
+      abort_on_fail = true;
+      continue;
+    }
+
+    if (strcmp(opt, "-n") == 0) {
+      trials = strtoull(val, NULL, 0);
+    } else if (strcmp(opt, "-s") == 0) {
+      seed = strtoull(val, NULL, 0);
+    } else if (strcmp(opt, "-t") == 0) {
+      seconds = atof(val);
+    } else if (strcmp(opt, "-o") == 0) {
+      dir = val;
+    } else {
+      fprintf(stderr, "usage: shim [-n trials] [-s seed] [-t seconds] [-o dir] "
+              "[-a] [input...]\n");
+      return 2;
+    }
+
+    i++;
+  }
+
+  if (first < argc) {
+    buf = (uint8_T *)malloc(MAX_INPUT);
+    if (buf == NULL) {
+      return 2;
+    }
+  }
+
+  if (fsm_12B_shim_init(&s, seed, abort_on_fail ? FSM_12B_SHIM_ABORT : 0) != 0)
+  {
+    fprintf(stderr, "shim: cannot snapshot the program data\n");
+    return 2;
+  }
+
+  t0 = fsm_12B_now_sec();
+  if (first < argc) {
+    /* One trial per input file */
+    for (i = first; i < argc; i++) {
+      const size_t n = read_input(argv[i], buf);
+      const int_T status = fsm_12B_shim_run(&s, harness, buf, n);
+      count[status]++;
+      if (status == FSM_12B_SHIM_FAIL) {
+        printf("%s: assertion failed: %s\n", argv[i], s.message);
+        record(fail, &nfail, s.message, buf, n);
+      }
+    }
+  } else {
+    uint64_T t;
+    for (t = 0U; t < trials; t++) {
+      const int_T status = fsm_12B_shim_run(&s, harness, NULL, 0U);
+      count[status]++;
+      if (status == FSM_12B_SHIM_FAIL) {
+        record(fail, &nfail, s.message, s.input, s.len);
+      }
+
+      if ((seconds > 0.0) && ((t & 0xFFFU) == 0U) && (fsm_12B_now_sec() - t0
+           > seconds)) {
+        t++;
+        break;
+      }
+    }
+  }
+
+  secs = fsm_12B_now_sec() - t0;
+  printf("harness: %lu trials in %.3f s (%.0f/s): %lu passed, %lu rejected by "
+         "assumptions, %lu failed\n", (unsigned long)(count[0] + count[1] +
+          count[2]), secs, (real_T)(count[0] + count[1] + count[2]) / secs,
+         (unsigned long)count[FSM_12B_SHIM_PASS], (unsigned long)
+         count[FSM_12B_SHIM_REJECT], (unsigned long)count[FSM_12B_SHIM_FAIL]);
+  for (i = 0; i < nfail; i++) {
+    size_t j;
+    printf("  %10lu x %s\n             input", (unsigned long)fail[i].count,
+           fail[i].message);
+    for (j = 0U; (j < fail[i].len) && (j < 32U); j++) {
+      printf(" %02x", fail[i].input[j]);
+    }
+
+    printf("%s\n", (fail[i].len > 32U) ? " ..." : "");
+    if (dir != NULL) {
+      char path[4096];
+      FILE *fp;
+      (void)snprintf(path, sizeof(path), "%s/fail-%d.bin", dir, i);
+      fp = fopen(path, "wb");
+      if ((fp == NULL) || (fwrite(fail[i].input, 1, fail[i].len, fp) !=
+           fail[i].len)) {
+        fprintf(stderr, "shim: cannot write %s\n", path);
+      }
+
+      if (fp != NULL) {
+        (void)fclose(fp);
+      }
+    }
+
+    free(fail[i].input);
+  }
+
+  fsm_12B_shim_free(&s);
+  free(buf);
+  return (count[FSM_12B_SHIM_FAIL] != 0U) ? 1 : 0;
+}
+
+#endif                                 /* FSM_12B_SHIM_LIBFUZZER */
+
+/*
+ * File trailer for shim_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,251 @@
+/*
+ * File: slice_main.c
+ *
+ * Writes one minimal verification unit per requirement of an fsm_12B
+ * harness: the branch of the requirement and a copy of fsm_12B.c whose
+ * step function keeps only the cone of influence of what the branch
+ * asserts.
+ *
+ *   slice [-p] [-m fsm_12B.c] [-o outdir] [-r list] harness
+ *   slice [-p] [-m fsm_12B.c] [-o output] -v variables
+ *
+ * Requirement k becomes outdir/req_k.c and outdir/fsm_12B_req_k.c, to be
+ * verified together in place of the full model:
+ *
+ *   esbmc outdir/req_k.c outdir/fsm_12B_req_k.c -I<model directory>
+ *
+ * The observed variables are those of the condition of __ESBMC_assert.
+ * -v slices for a comma separated list instead, e.g. rtDW.Merge_g,
+ * rtY_pullup, and writes the model to output (stdout by default).  -p
+ * slices for a harness that runs more than one step, such as those of
+ * unroll (fsm_12B_slice.h).  The model defaults to fsm_12B.c next to the
+ * harness, outdir to slice.out.
+ *
+ * Exit status: 0 done, 2 usage or setup error.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "fsm_12B_slice.h"
+#include "fsm_12B_unroll.h"
+#include "fsm_12B_util.h"
+#include "fsm_12B_verify.h"
+#include "rtwtypes.h"
+
+#define MAX_PATH                       4096
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: slice [-p] [-m fsm_12B.c] [-o outdir] [-r list] "
+          "harness\n       slice [-p] [-m fsm_12B.c] [-o output] -v "
+          "variables\n");
+}
+
+/* Write n bytes of text to path; 0 or -1 */
+static int_T save(const char_T *path, const char_T *text, size_t n)
+{
+  FILE *fp = fopen(path, "wb");
+  int_T rc = 0;
+  if (fp == NULL) {
+    return -1;
+  }
+
+  if (fwrite(text, 1, n, fp) != n) {
+    rc = -1;
+  }
+
+  if (fclose(fp) != 0) {
+    rc = -1;
+  }
+
+  return rc;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  static fsm_12B_Harness h;
+  static fsm_12B_SliceVars observed;
+  static fsm_12B_SliceStats stats;
+  const char_T *model = NULL;
+  const char_T *outdir = NULL;
+  const char_T *list = NULL;
+  const char_T *vars = NULL;
+  const char_T *harness = NULL;
+  boolean_T persistent = false;
+  char_T model_default[MAX_PATH + 16];
+  char_T path[MAX_PATH + 32];
+  char_T banner[2 * MAX_PATH + 256];
+  char_T *source;
+  char_T *text;
+  char_T *out;
+  size_t source_len;
+  size_t len;
+  size_t outlen;
+  int_T units = 0;
+  int_T i;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (opt[0] != '-') {
+      if (harness != NULL) {
+        usage();
+        return 2;
+      }
+
+      harness = opt;
+      continue;
+    }
+
+    if (strcmp(opt, "-p") == 0) {
+      persistent = true;
+      continue;
+    }
+
+    if (strcmp(opt, "-m") == 0) {
+      model = val;
+    } else if (strcmp(opt, "-o") == 0) {
+      outdir = val;
+    } else if (strcmp(opt, "-r") == 0) {
+      list = val;
+    } else if (strcmp(opt, "-v") == 0) {
+      vars = val;
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if ((harness == NULL) == (vars == NULL)) {
+    usage();
+    return 2;
+  }
+
+  if (model == NULL) {
+    const char_T *slash = (harness != NULL) ? strrchr(harness, '/') : NULL;
+    (void)snprintf(model_default, sizeof(model_default), "%.*sfsm_12B.c",
+                   (slash != NULL) ? (int)(slash - harness + 1) : 0, (harness
+      != NULL) ? harness : "");
+    model = model_default;
+  }
+
+  source = fsm_12B_slurp(model, &source_len);
+  if (source == NULL) {
+    fprintf(stderr, "slice: cannot read %s\n", model);
+    return 2;
+  }
+
+  if (vars != NULL) {
+    FILE *fp = (outdir != NULL) ? fopen(outdir, "wb") : stdout;
+    if (fsm_12B_slice_vars(&observed, vars) <= 0) {
+      fprintf(stderr, "slice: no variables in \"%s\"\n", vars);
+      return 2;
+    }
+
+    (void)snprintf(banner, sizeof(banner), "Cone of influence of %s%s in\n%s.",
+                   vars, persistent ? " over several steps" : "", model);
+    out = fsm_12B_slice(source, source_len, &observed, persistent, banner,
+                        &stats, &outlen);
+    if (out == NULL) {
+      fprintf(stderr, "slice: cannot parse fsm_12B_step in %s\n", model);
+      return 2;
+    }
+
+    if ((fp == NULL) || (fwrite(out, 1, outlen, fp) != outlen)) {
+      fprintf(stderr, "slice: cannot write %s\n", (outdir != NULL) ? outdir :
+              "stdout");
+      return 2;
+    }
+
+    if (fp != stdout) {
+      (void)fclose(fp);
+    }
+
+    fprintf(stderr, "slice: %d of %d assignments kept\n  observed: %s\n"
+            "  kept:     %s\n  removed:  %s\n", stats.kept, stats.assignments,
+            stats.criterion, stats.blocks_kept, stats.blocks_removed);
+    free(out);
+    free(source);
+    return 0;
+  }
+
+  if (outdir == NULL) {
+    outdir = "slice.out";
+  }
+
+  text = fsm_12B_slurp(harness, &len);
+  if (text == NULL) {
+    fprintf(stderr, "slice: cannot read %s\n", harness);
+    return 2;
+  }
+
+  if (fsm_12B_verify_split(&h, text, len, "sit") <= 0) {
+    fprintf(stderr, "slice: no \"if (sit == k) { ... }\" chain in %s\n",
+            harness);
+    return 2;
+  }
+
+  (void)mkdir(outdir, 0755);
+  printf("  req  kept  blocks kept\n");
+  for (i = 0; i < h.nbranches; i++) {
+    fsm_12B_UnrollReq r;
+    char_T *unit;
+    size_t unit_len;
+    if (!fsm_12B_selected(list, h.branch[i].value)) {
+      continue;
+    }
+
+    if (fsm_12B_unroll_parse(&h, i, &r) != 0) {
+      fprintf(stderr, "slice: cannot read requirement %d of %s\n",
+              h.branch[i].value, harness);
+      return 2;
+    }
+
+    observed.n = 0;
+    (void)fsm_12B_slice_vars(&observed, r.assertion);
+    (void)snprintf(banner, sizeof(banner), "Cone of influence of requirement "
+                   "%d of\n%s, which asserts\n\n  %s\n\nin %s%s.", r.value,
+                   harness, r.assertion, model, persistent ?
+                   " over several steps" : "");
+    out = fsm_12B_slice(source, source_len, &observed, persistent, banner,
+                        &stats, &outlen);
+    unit = fsm_12B_verify_harness(&h, i, &unit_len);
+    if ((out == NULL) || (unit == NULL)) {
+      fprintf(stderr, "slice: cannot slice requirement %d\n", r.value);
+      return 2;
+    }
+
+    (void)snprintf(path, sizeof(path), "%s/fsm_12B_req_%d.c", outdir, r.value);
+    if (save(path, out, outlen) != 0) {
+      fprintf(stderr, "slice: cannot write %s\n", path);
+      return 2;
+    }
+
+    (void)snprintf(path, sizeof(path), "%s/req_%d.c", outdir, r.value);
+    if (save(path, unit, unit_len) != 0) {
+      fprintf(stderr, "slice: cannot write %s\n", path);
+      return 2;
+    }
+
+    printf("  %3d  %2d/%-2d %s\n", r.value, stats.kept, stats.assignments,
+           stats.blocks_kept);
+    units++;
+    free(unit);
+    free(out);
+    fsm_12B_unroll_free(&r);
+  }
+
+  printf("%d units in %s\n", units, outdir);
+  free(text);
+  free(source);
+  return 0;
+}
+
+/*
+ * File trailer for slice_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,331 @@
+/*
+ * File: spec_main.c
+ *
+ * Compiles a requirement file (fsm_12B_spec.h) into a directory of ESBMC
+ * harnesses, native monitors and expected verdicts.
+ *
+ *   spec [-o outdir] [-k ticks] [-f] [-q] file
+ *
+ * Requirement <id> becomes outdir/mon_<id>.c, its monitor, and
+ * outdir/req_<id>.c, a harness that runs the monitor for k triggering
+ * ticks (and the rest of its window) from fsm_12B_initialize:
+ *
+ *   esbmc outdir/req_<id>.c fsm_12B.c -I<model directory> -I<fsm_12B_native>
+ *
+ * outdir/monitors.c tables all monitors for native use (fsm_12B_mon.h) and
+ * outdir/verdicts.txt lists the verdict each harness should get.
+ * outdir/spec.manifest records a hash of every requirement, so that a run
+ * after an edit rewrites only the files of the requirements that changed
+ * and removes those of deleted ones; -f rewrites everything.  Defaults:
+ * outdir spec.out, k 4 (twice the depth of the reachable state space).
+ *
+ * Exit status: 0 done, 2 usage, parse or write error.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "fsm_12B_sha256.h"
+#include "fsm_12B_spec.h"
+#include "fsm_12B_util.h"
+#include "rtwtypes.h"
+
+#define MAX_PATH                       4096
+
+/* One line of spec.manifest */
+typedef struct {
+  char_T id[FSM_12B_SPEC_ID];
+  char_T hash[FSM_12B_SHA256_HEX];
+  boolean_T seen;
+} Entry;
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: spec [-o outdir] [-k ticks] [-f] [-q] file\n");
+}
+
+/* Write n bytes of text to path; 0 or -1 */
+static int_T save(const char_T *path, const char_T *text, size_t n)
+{
+  FILE *fp = fopen(path, "wb");
+  int_T rc = 0;
+  if (fp == NULL) {
+    return -1;
+  }
+
+  if (fwrite(text, 1, n, fp) != n) {
+    rc = -1;
+  }
+
+  if (fclose(fp) != 0) {
+    rc = -1;
+  }
+
+  return rc;
+}
+
+/* Save text to path unless the file already holds exactly that; 0 or -1 */
+static int_T update(const char_T *path, const char_T *text, size_t n)
+{
+  size_t len;
+  char_T *old = fsm_12B_slurp(path, &len);
+  const boolean_T same = (old != NULL) && (len == n) && (memcmp(old, text, n)
+    == 0);
+  free(old);
+  return same ? 0 : save(path, text, n);
+}
+
+/* The entries of outdir/spec.manifest, malloc'ed; none when it is absent */
+static Entry *read_manifest(const char_T *path, int_T *count)
+{
+  Entry *e = NULL;
+  int_T cap = 0;
+  size_t len;
+  char_T *text = fsm_12B_slurp(path, &len);
+  char_T *line;
+  *count = 0;
+  if (text == NULL) {
+    return NULL;
+  }
+
+  for (line = strtok(text, "\n"); line != NULL; line = strtok(NULL, "\n")) {
+    char_T id[FSM_12B_SPEC_ID];
+    char_T hash[FSM_12B_SHA256_HEX];
+    if ((line[0] == '#') || (sscanf(line, "%31s %64s", id, hash) != 2)) {
+      continue;
+    }
+
+    if (*count == cap) {
+      Entry *grown;
+      cap = 2 * cap + 64;
+      grown = (Entry *)realloc(e, (size_t)cap * sizeof(Entry));
+      if (grown == NULL) {
+        break;
+      }
+
+      e = grown;
+    }
+
+    (void)strcpy(e[*count].id, id);
+    (void)strcpy(e[*count].hash, hash);
+    e[*count].seen = false;
+    (*count)++;
+  }
+
+  free(text);
+  return e;
+}
+
+/* Write mon_<id>.c of r, or req_<id>.c for a harness, to path; 0 or -1 */
+static int_T generate(const char_T *path, const fsm_12B_SpecReq *r, int_T
+                      ticks, const char_T *source, boolean_T harness)
+{
+  FILE *fp = fopen(path, "w");
+  int_T rc;
+  if (fp == NULL) {
+    return -1;
+  }
+
+  rc = harness ? fsm_12B_spec_harness(fp, r, ticks, source) :
+    fsm_12B_spec_monitor(fp, r, source);
+  if (fclose(fp) != 0) {
+    rc = -1;
+  }
+
+  return rc;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  static fsm_12B_Spec s;
+  const char_T *outdir = "spec.out";
+  const char_T *file = NULL;
+  const char_T *source;
+  boolean_T force = false;
+  boolean_T quiet = false;
+  int_T k = 4;
+  Entry *old;
+  int_T nold;
+  int_T recompiled = 0;
+  int_T removed = 0;
+  char_T path[MAX_PATH + 64];
+  char_T *text;
+  char_T *buf = NULL;
+  size_t size = 0U;
+  size_t len;
+  FILE *mem;
+  int_T rc = 0;
+  int_T i;
+  int_T j;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (opt[0] != '-') {
+      if (file != NULL) {
+        usage();
+        return 2;
+      }
+
+      file = opt;
+      continue;
+    }
+
+    if (strcmp(opt, "-f") == 0) {
+      force = true;
+      continue;
+    }
+
+    if (strcmp(opt, "-q") == 0) {
+      quiet = true;
+      continue;
+    }
+
+    if (strcmp(opt, "-o") == 0) {
+      outdir = val;
+    } else if (strcmp(opt, "-k") == 0) {
+      k = atoi(val);
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if ((file == NULL) || (k < 1)) {
+    usage();
+    return 2;
+  }
+
+  text = fsm_12B_slurp(file, &len);
+  if (text == NULL) {
+    fprintf(stderr, "spec: cannot read %s\n", file);
+    return 2;
+  }
+
+  if (fsm_12B_spec_parse(&s, text, len) != 0) {
+    fprintf(stderr, "spec: %s: %s\n", file, s.error);
+    fsm_12B_spec_free(&s);
+    free(text);
+    return 2;
+  }
+
+  free(text);
+  source = strrchr(file, '/');
+  source = (source != NULL) ? source + 1 : file;
+  (void)mkdir(outdir, 0755);
+  (void)snprintf(path, sizeof(path), "%s/spec.manifest", outdir);
+  old = read_manifest(path, &nold);
+  mem = open_memstream(&buf, &size);
+  if (mem == NULL) {
+    fprintf(stderr, "spec: out of memory\n");
+    return 2;
+  }
+
+  fprintf(mem, "# Hashes of the requirements of %s; generated by spec.\n",
+          source);
+
+  /* The files of the requirements that changed */
+  for (i = 0; (i < s.nreqs) && (rc == 0); i++) {
+    const fsm_12B_SpecReq *r = &s.req[i];
+    const int_T ticks = fsm_12B_spec_ticks(r, k);
+    char_T hash[FSM_12B_SHA256_HEX];
+    char_T harness[MAX_PATH + 64];
+    boolean_T fresh = force;
+    fsm_12B_spec_hash(r, ticks, source, hash);
+    fprintf(mem, "%s %s\n", r->id, hash);
+    (void)snprintf(path, sizeof(path), "%s/mon_%s.c", outdir, r->id);
+    (void)snprintf(harness, sizeof(harness), "%s/req_%s.c", outdir, r->id);
+    for (j = 0; j < nold; j++) {
+      if (strcmp(old[j].id, r->id) == 0) {
+        old[j].seen = true;
+        fresh = fresh || (strcmp(old[j].hash, hash) != 0);
+        break;
+      }
+    }
+
+    if ((j == nold) || fresh || (access(path, R_OK) != 0) || (access(harness,
+          R_OK) != 0)) {
+      if ((generate(path, r, ticks, source, false) != 0) || (generate(harness,
+            r, ticks, source, true) != 0)) {
+        fprintf(stderr, "spec: cannot write the files of requirement %s in "
+                "%s\n", r->id, outdir);
+        rc = 2;
+      }
+
+      if (!quiet) {
+        printf("  %s: %s\n", r->id, harness);
+      }
+
+      recompiled++;
+    }
+  }
+
+  /* The files of the requirements that are gone */
+  for (j = 0; j < nold; j++) {
+    if (!old[j].seen) {
+      (void)snprintf(path, sizeof(path), "%s/mon_%s.c", outdir, old[j].id);
+      (void)remove(path);
+      (void)snprintf(path, sizeof(path), "%s/req_%s.c", outdir, old[j].id);
+      (void)remove(path);
+      if (!quiet) {
+        printf("  %s: removed\n", old[j].id);
+      }
+
+      removed++;
+    }
+  }
+
+  /* The manifest last, so that a failed run is redone */
+  if ((fclose(mem) != 0) || (rc != 0)) {
+    rc = 2;
+  } else {
+    char_T manifest[MAX_PATH + 64];
+    (void)snprintf(manifest, sizeof(manifest), "%s/spec.manifest", outdir);
+    for (j = 0; (j < 2) && (rc == 0); j++) {
+      char_T *gen = NULL;
+      size_t n = 0U;
+      FILE *fp = open_memstream(&gen, &n);
+      if (fp == NULL) {
+        rc = 2;
+        break;
+      }
+
+      if (j == 0) {
+        (void)snprintf(path, sizeof(path), "%s/monitors.c", outdir);
+        rc = (fsm_12B_spec_table(fp, &s, source) != 0) ? 2 : 0;
+      } else {
+        (void)snprintf(path, sizeof(path), "%s/verdicts.txt", outdir);
+        rc = (fsm_12B_spec_verdicts(fp, &s, k, source) != 0) ? 2 : 0;
+      }
+
+      if ((fclose(fp) != 0) || (rc != 0) || (update(path, gen, n) != 0)) {
+        fprintf(stderr, "spec: cannot write %s\n", path);
+        rc = 2;
+      }
+
+      free(gen);
+    }
+
+    if ((rc == 0) && (update(manifest, buf, size) != 0)) {
+      fprintf(stderr, "spec: cannot write %s\n", manifest);
+      rc = 2;
+    }
+  }
+
+  printf("%d requirements in %s: %d recompiled, %d unchanged, %d removed\n",
+         s.nreqs, outdir, recompiled, s.nreqs - recompiled, removed);
+  free(buf);
+  free(old);
+  fsm_12B_spec_free(&s);
+  return rc;
+}
+
+/*
+ * File trailer for spec_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,262 @@
+/*
+ * File: store_main.c
+ *
+ * Queries the verification result store that verify -d fills
+ * (fsm_12B_store.h).
+ *
+ *   store [-d db] stale [-e esbmc] [-r list] [-v var] harness
+ *         [-- esbmc options]
+ *   store [-d db] history [harness]
+ *   store [-d db] trend [-f factor] [harness]
+ *   store [-d db] cex run
+ *
+ * stale lists which requirements of harness need re-verification against
+ * the model next to it, and why: NEW never verified, STALE changed in the
+ * branch, the verifier or the cone of influence, CURRENT verified on this
+ * model, UNAFFECTED changed only outside its cone.  The verifier version
+ * and options must be given as for verify.  history lists every run;
+ * trend the mean and worst time and memory per requirement and verifier
+ * version, marking means more than factor (default 1.5) times those of
+ * the version before; cex prints the counterexample of a run.  db
+ * defaults to results.db.
+ *
+ * Exit status: 0 done (stale: nothing to re-verify; trend: no
+ * regression), 1 stale: some to re-verify, trend: some regression,
+ * 2 usage or setup error.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_sha256.h"
+#include "fsm_12B_store.h"
+#include "fsm_12B_util.h"
+#include "fsm_12B_verify.h"
+#include "rtwtypes.h"
+
+#define MAX_PATH                       4096
+
+static fsm_12B_Store store;
+static fsm_12B_StoreModel current;
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: store [-d db] stale [-e esbmc] [-r list] [-v var] "
+          "harness [-- esbmc options]\n       store [-d db] history "
+          "[harness]\n       store [-d db] trend [-f factor] [harness]\n"
+          "       store [-d db] cex run\n");
+}
+
+/* The stale command; 0 nothing to re-verify, 1 some, 2 error */
+static int_T stale(const char_T *harness, const char_T *esbmc, const char_T
+                   *list, const char_T *var, const char_T *options)
+{
+  static fsm_12B_Harness h;
+  char_T modeldir[MAX_PATH];
+  char_T version[256];
+  char_T *slash;
+  char_T *text;
+  size_t len;
+  int_T count[4] = { 0, 0, 0, 0 };
+  int_T i;
+  text = fsm_12B_slurp(harness, &len);
+  if (text == NULL) {
+    fprintf(stderr, "store: cannot read %s\n", harness);
+    return 2;
+  }
+
+  if (fsm_12B_verify_split(&h, text, len, var) <= 0) {
+    fprintf(stderr, "store: no \"if (%s == k) { ... }\" chain in %s\n", var,
+            harness);
+    return 2;
+  }
+
+  (void)snprintf(modeldir, sizeof(modeldir), "%s", harness);
+  slash = strrchr(modeldir, '/');
+  if (slash != NULL) {
+    *slash = '\0';
+  } else {
+    (void)snprintf(modeldir, sizeof(modeldir), ".");
+  }
+
+  if ((fsm_12B_store_load(&current, modeldir) != 0) ||
+      (fsm_12B_store_add_model(&store, &current) != 0)) {
+    fprintf(stderr, "store: cannot add the model of %s: %s\n", modeldir,
+            store.error);
+    return 2;
+  }
+
+  fsm_12B_verify_tool_version(esbmc, version, sizeof(version));
+  printf("model %.12s of %s, %s\n", current.hash, modeldir, version);
+  printf("  req  status      last  run    why\n");
+  for (i = 0; i < h.nbranches; i++) {
+    fsm_12B_StoreCone cone;
+    fsm_12B_StoreRun run;
+    fsm_12B_StoreCheck check;
+    fsm_12B_Sha256 c;
+    uint8_T digest[FSM_12B_SHA256_BYTES];
+    char_T hash[FSM_12B_SHA256_HEX];
+    char_T name[16];
+    char_T *branch;
+    if (!fsm_12B_selected(list, h.branch[i].value)) {
+      continue;
+    }
+
+    branch = fsm_12B_verify_harness(&h, i, &len);
+    if ((branch == NULL) || (fsm_12B_store_cone(&current, branch, len, false,
+          &cone) != 0)) {
+      fprintf(stderr, "store: requirement %d asserts nothing of the model\n",
+              h.branch[i].value);
+      free(branch);
+      continue;
+    }
+
+    fsm_12B_sha256_init(&c);
+    fsm_12B_sha256_field(&c, branch, len);
+    fsm_12B_sha256_final(&c, digest);
+    fsm_12B_sha256_hex(digest, hash);
+    free(branch);
+    (void)snprintf(name, sizeof(name), "%d", h.branch[i].value);
+    memset(&run, 0, sizeof(run));
+    run.harness = harness;
+    run.requirement = name;
+    run.harness_hash = hash;
+    run.model_hash = current.hash;
+    run.cone = &cone;
+    run.tool_version = version;
+    run.options = options;
+    if (fsm_12B_store_check(&store, &current, &run, &check) != 0) {
+      fprintf(stderr, "store: %s\n", store.error);
+      return 2;
+    }
+
+    if (check.run == 0) {
+      printf("  %3s  %-10s  %4s  %5s\n", name,
+             fsm_12B_store_status_name[check.status], "-", "-");
+    } else {
+      printf("  %3s  %-10s  %4s  %5lld  %s\n", name,
+             fsm_12B_store_status_name[check.status],
+             fsm_12B_verify_verdict_name[check.verdict], (long long)check.run,
+             check.why);
+    }
+
+    count[check.status]++;
+  }
+
+  free(text);
+  printf("%d to re-verify (%d new, %d stale), %d current, %d unaffected\n",
+         count[FSM_12B_STORE_NEW] + count[FSM_12B_STORE_STALE],
+         count[FSM_12B_STORE_NEW], count[FSM_12B_STORE_STALE],
+         count[FSM_12B_STORE_CURRENT], count[FSM_12B_STORE_UNAFFECTED]);
+  return ((count[FSM_12B_STORE_NEW] + count[FSM_12B_STORE_STALE]) != 0) ? 1 :
+    0;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  const char_T *db = "results.db";
+  const char_T *esbmc = "esbmc";
+  const char_T *list = NULL;
+  const char_T *var = "sit";
+  const char_T *command = NULL;
+  const char_T *arg = NULL;
+  char_T options[MAX_PATH];
+  real_T factor = 1.5;
+  int_T rc = 0;
+  int_T i;
+  options[0] = '\0';
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (strcmp(opt, "--") == 0) {
+      for (i++; i < argc; i++) {
+        const size_t used = strlen(options);
+        (void)snprintf(&options[used], sizeof(options) - used, "%s%s", (used >
+          0U) ? " " : "", argv[i]);
+      }
+
+      break;
+    }
+
+    if (opt[0] != '-') {
+      if (command == NULL) {
+        command = opt;
+      } else if (arg == NULL) {
+        arg = opt;
+      } else {
+        usage();
+        return 2;
+      }
+
+      continue;
+    }
+
+    if (strcmp(opt, "-d") == 0) {
+      db = val;
+    } else if (strcmp(opt, "-e") == 0) {
+      esbmc = val;
+    } else if (strcmp(opt, "-r") == 0) {
+      list = val;
+    } else if (strcmp(opt, "-v") == 0) {
+      var = val;
+    } else if (strcmp(opt, "-f") == 0) {
+      factor = atof(val);
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if ((command == NULL) || (((strcmp(command, "stale") == 0) || (strcmp
+         (command, "cex") == 0)) && (arg == NULL))) {
+    usage();
+    return 2;
+  }
+
+  if (fsm_12B_store_open(&store, db) != 0) {
+    fprintf(stderr, "store: %s\n", store.error);
+    return 2;
+  }
+
+  if (strcmp(command, "stale") == 0) {
+    rc = stale(arg, esbmc, list, var, options);
+  } else if (strcmp(command, "history") == 0) {
+    rc = (fsm_12B_store_history(stdout, &store, arg) != 0) ? 2 : 0;
+  } else if (strcmp(command, "trend") == 0) {
+    const int_T regressions = fsm_12B_store_trend(stdout, &store, arg, factor);
+    rc = (regressions < 0) ? 2 : (regressions > 0) ? 1 : 0;
+    if (regressions > 0) {
+      printf("%d regressions of more than %gx\n", regressions, factor);
+    }
+  } else if (strcmp(command, "cex") == 0) {
+    char_T *trace = fsm_12B_store_counterexample(&store, (int64_T)strtoll(arg,
+      NULL, 10));
+    if (trace == NULL) {
+      fprintf(stderr, "store: run %s has no counterexample\n", arg);
+      rc = 2;
+    } else {
+      fputs(trace, stdout);
+      free(trace);
+    }
+  } else {
+    usage();
+    rc = 2;
+  }
+
+  if ((rc == 2) && (store.error[0] != '\0')) {
+    fprintf(stderr, "store: %s\n", store.error);
+  }
+
+  fsm_12B_store_close(&store);
+  fsm_12B_store_unload(&current);
+  return rc;
+}
+
+/*
+ * File trailer for store_main.c
+ *
+ * [EOF]
+ */
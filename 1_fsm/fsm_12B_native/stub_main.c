@@ -0,0 +1,151 @@
+/*
+ * File: stub_main.c
+ *
+ * A stand-in for esbmc, so that verify and portfolio can be tried on a
+ * machine without the verifier.
+ *
+ *   esbmc_stub --version
+ *   esbmc_stub harness.c fsm_12B.c -I... [options]
+ *
+ * The requirement is the N of the first "Requirement N violated" in the
+ * harness, which for a branch harness of verify is the one it keeps.  Its
+ * verdict is FAIL when N is in $FSM_12B_STUB_FAIL (default 1,3,7,8,10-13,
+ * the verdicts of explore for ert_main.c) and PASS otherwise.  How the stub
+ * gets there depends on a hash of N and the options, as the time of a
+ * real solver does on the encoding: it burns between 1 and 64 times
+ * $FSM_12B_STUB_SCALE seconds of CPU (default 0.05), touches between 1 and
+ * 64 MiB, and for about one pair in eight answers UNKNOWN or never
+ * answers at all.  Under a CPU quota the wall time grows accordingly.
+ *
+ * Exit status: 0 PASS, 1 FAIL, 6 UNKNOWN, as esbmc.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "rtwtypes.h"
+#include "fsm_12B_util.h"
+
+#define MAX_PATH                       4096
+
+static uint32_T fnv1a(uint32_T h, const char_T *s)
+{
+  while (*s != '\0') {
+    h = (h ^ (uint8_T)*s++) * 16777619U;
+  }
+
+  return h;
+}
+
+static real_T cpu_sec(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (real_T)ts.tv_sec + 1.0e-9 * (real_T)ts.tv_nsec;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  const char_T *fails = getenv("FSM_12B_STUB_FAIL");
+  const char_T *scale = getenv("FSM_12B_STUB_SCALE");
+  const char_T *harness = NULL;
+  char_T line[MAX_PATH];
+  char_T key[32];
+  uint32_T h = 2166136261U;
+  int_T req = 0;
+  int_T line_no = 0;
+  int_T at = 0;
+  real_T burn;
+  size_t mib;
+  volatile uint8_T *mem;
+  volatile uint32_T spin = 0U;
+  real_T t0;
+  FILE *fp;
+  int_T i;
+  if ((argc == 2) && (strcmp(argv[1], "--version") == 0)) {
+    printf("ESBMC version 7.4.0 (fsm_12B stub)\n");
+    return 0;
+  }
+
+  for (i = 1; i < argc; i++) {
+    const size_t n = strlen(argv[i]);
+    if (argv[i][0] == '-') {
+      h = fnv1a(fnv1a(h, argv[i]), " ");
+    } else if ((harness == NULL) && (n > 2U) && (strcmp(&argv[i][n - 2U], ".c")
+                == 0)) {
+      harness = argv[i];
+    }
+  }
+
+  if (harness == NULL) {
+    fprintf(stderr, "ERROR: no harness given\n");
+    return 6;
+  }
+
+  fp = fopen(harness, "r");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: failed to open input file %s\n", harness);
+    return 6;
+  }
+
+  while ((req == 0) && (fgets(line, sizeof(line), fp) != NULL)) {
+    const char_T *p = strstr(line, "Requirement ");
+    line_no++;
+    if ((p != NULL) && (strstr(p, " violated") != NULL)) {
+      req = atoi(p + 12);
+      at = line_no;
+    }
+  }
+
+  (void)fclose(fp);
+  (void)snprintf(key, sizeof(key), "%d", req);
+  h = fnv1a(h, key);
+  burn = ((scale != NULL) ? atof(scale) : 0.05) * (real_T)(1U << (h % 7U));
+  mib = (size_t)((h >> 8) % 64U) + 1U;
+  printf("ESBMC version 7.4.0 (fsm_12B stub)\nParsing %s\n"
+         "Requirement %d, %.2f s of CPU, %lu MiB\n", harness, req, burn,
+         (unsigned long)mib);
+  (void)fflush(stdout);
+
+  /* The memory, then the time, of the solver */
+  mem = (volatile uint8_T *)malloc(mib << 20);
+  if (mem == NULL) {
+    fprintf(stderr, "terminate called after throwing an instance of "
+            "'std::bad_alloc'\n");
+    return 6;
+  }
+
+  for (i = 0; (size_t)i < (mib << 20); i += 4096) {
+    mem[i] = (uint8_T)i;
+  }
+
+  t0 = cpu_sec();
+  while (((h >> 16) % 16U == 0U) || (cpu_sec() - t0 < burn)) {
+    spin += 1U;
+  }
+
+  if ((h >> 16) % 16U == 1U) {
+    printf("\nVERIFICATION UNKNOWN\n");
+    return 6;
+  }
+
+  if (fsm_12B_selected((fails != NULL) ? fails : "1,3,7,8,10-13", req)) {
+    printf("\n[Counterexample]\n\n\nState 1 file %s line %d thread 0\n"
+           "----------------------------------------------------\n"
+           "  stub = %d\n\nViolated property:\n  file %s line %d\n"
+           "  Requirement %d violated\n\n\nVERIFICATION FAILED\n", harness,
+           at, req, harness, at, req);
+    return 1;
+  }
+
+  printf("\nVERIFICATION SUCCESSFUL\n");
+  return 0;
+}
+
+/*
+ * File trailer for stub_main.c
+ *
+ * [EOF]
+ */
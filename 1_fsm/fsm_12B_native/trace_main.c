@@ -0,0 +1,131 @@
+/*
+ * File: trace_main.c
+ *
+ * Converts replay records into the bit-packed trace container and reads
+ * ticks back by random access.
+ *
+ *   trace pack <input trace> <output trace> <packed trace> [block ticks]
+ *   trace dump <packed trace> [first tick [count]]
+ *
+ * The input and output traces are the record files read and written by
+ * replay (fsm_12B_replay.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsm_12B_replay.h"
+#include "fsm_12B_trace.h"
+
+static int_T pack(const char *in_path, const char *out_path, const char
+                  *packed_path, uint32_T block_ticks)
+{
+  fsm_12B_TraceWriter w;
+  fsm_12B_InRecord in;
+  fsm_12B_OutRecord out;
+  FILE *fin = fopen(in_path, "rb");
+  FILE *fout = fopen(out_path, "rb");
+  int_T status = 0;
+  if ((fin == NULL) || (fout == NULL)) {
+    fprintf(stderr, "trace: cannot open %s\n", (fin == NULL) ? in_path :
+            out_path);
+    return 1;
+  }
+
+  if (fsm_12B_trace_create(&w, packed_path, block_ticks) != 0) {
+    fprintf(stderr, "trace: cannot create %s\n", packed_path);
+    return 1;
+  }
+
+  while (fread(&in, sizeof(in), 1, fin) == 1) {
+    fsm_12B_TraceTick tick;
+    if (fread(&out, sizeof(out), 1, fout) != 1) {
+      fprintf(stderr, "trace: %s is shorter than %s\n", out_path, in_path);
+      status = 1;
+      break;
+    }
+
+    tick.inputs = (uint8_T)((in.rtU_standby != 0) | ((in.rtU_apfail != 0) << 1)
+      | ((in.rtU_supported != 0) << 2) | ((in.rtU_limits != 0) << 3));
+    tick.rtY_pullup = (boolean_T)(out.rtY_pullup != 0);
+    tick.Merge = out.Merge;
+    tick.Merge_g = out.Merge_g;
+    if (fsm_12B_trace_append(&w, &tick) != 0) {
+      fprintf(stderr, "trace: cannot append tick %lu\n", (unsigned long)
+              w.ticks);
+      status = 1;
+      break;
+    }
+  }
+
+  if (fsm_12B_trace_finish(&w) != 0) {
+    fprintf(stderr, "trace: cannot write %s\n", packed_path);
+    status = 1;
+  }
+
+  (void)fclose(fin);
+  (void)fclose(fout);
+  return status;
+}
+
+static int_T dump(const char *packed_path, uint64_T first, uint64_T count)
+{
+  fsm_12B_TraceReader r;
+  uint64_T t;
+  if (fsm_12B_trace_open(&r, packed_path) != 0) {
+    fprintf(stderr, "trace: cannot open %s\n", packed_path);
+    return 1;
+  }
+
+  printf("# %lu ticks, %lu blocks of %u\n", (unsigned long)r.ticks, (unsigned
+          long)r.nblocks, r.block_ticks);
+  printf("# tick standby apfail supported limits pullup Merge Merge_g\n");
+  for (t = first; (t < r.ticks) && (t - first < count); t++) {
+    fsm_12B_TraceTick tick;
+    if (fsm_12B_trace_read(&r, t, &tick) != 0) {
+      fprintf(stderr, "trace: %s is corrupt at tick %lu\n", packed_path,
+              (unsigned long)t);
+      fsm_12B_trace_close(&r);
+      return 1;
+    }
+
+    printf("%lu %d %d %d %d %d %d %d\n", (unsigned long)t, tick.inputs & 1,
+           (tick.inputs >> 1) & 1, (tick.inputs >> 2) & 1, tick.inputs >> 3,
+           tick.rtY_pullup, tick.Merge, tick.Merge_g);
+  }
+
+  fsm_12B_trace_close(&r);
+  return 0;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  if ((argc >= 5) && (argc <= 6) && (strcmp(argv[1], "pack") == 0)) {
+    const unsigned long block_ticks = (argc == 6) ? strtoul(argv[5], NULL, 10)
+      : 0UL;
+    if (block_ticks > FSM_12B_TRACE_MAX_BLOCK_TICKS) {
+      fprintf(stderr, "trace: at most %u block ticks\n",
+              FSM_12B_TRACE_MAX_BLOCK_TICKS);
+      return 2;
+    }
+
+    return pack(argv[2], argv[3], argv[4], (uint32_T)block_ticks);
+  }
+
+  if ((argc >= 3) && (argc <= 5) && (strcmp(argv[1], "dump") == 0)) {
+    return dump(argv[2], (argc >= 4) ? (uint64_T)strtoull(argv[3], NULL, 10) :
+                0U, (argc == 5) ? (uint64_T)strtoull(argv[4], NULL, 10) :
+                ~(uint64_T)0U);
+  }
+
+  fprintf(stderr, "usage: trace pack <input trace> <output trace> "
+          "<packed trace> [block ticks]\n"
+          "       trace dump <packed trace> [first tick [count]]\n");
+  return 2;
+}
+
+/*
+ * File trailer for trace_main.c
+ *
+ * [EOF]
+ */
@@ -0,0 +1,378 @@
+/*
+ * File: unroll_main.c
+ *
+ * Finds the smallest k for which k-induction proves each requirement of an
+ * fsm_12B harness, or a counterexample of at most k ticks.
+ *
+ *   unroll [-k max] [-g] [-d explore|model] [-i] [-j jobs] [-t seconds]
+ *          [-m MiB] [-e esbmc] [-o outdir] [-r list] harness
+ *          [-- esbmc options]
+ *
+ * Round k writes outdir/req_<n>_base_<k>.c and outdir/req_<n>_step_<k>.c
+ * for every requirement still open and verifies them all in parallel.  A
+ * failed base case is a real counterexample; a passed base case with a
+ * passed step case is a proof.  -g only writes the harnesses for k = 1 to
+ * max.  -d restricts the arbitrary state of the step case to the value
+ * domains from the explorer or from the constants of fsm_12B.c, and -i
+ * draws them as integers (fsm_12B_domain.h).  Defaults: max 8, one job per
+ * core, no limits, outdir unroll.out.
+ *
+ * Exit status: 0 all proved, 1 some violated, 2 usage or setup error,
+ * 3 some neither proved nor violated.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "fsm_12B_domain.h"
+#include "fsm_12B_unroll.h"
+#include "fsm_12B_util.h"
+#include "fsm_12B_verify.h"
+#include "rtwtypes.h"
+
+#define MAX_OPTIONS                    64
+#define MAX_PATH                       4096
+
+typedef enum {
+  OPEN = 0,
+  PROVED,
+  VIOLATED,
+  INCONCLUSIVE
+} Status;
+
+static const char_T *const status_name[4] = { "OPEN", "PROVED", "VIOLATED",
+  "INCONCLUSIVE" };
+
+typedef struct {
+  fsm_12B_UnrollReq req;
+  Status status;
+  int_T k;                             /* depth of the verdict */
+  fsm_12B_VerifyVerdict last;          /* of the job that decided it */
+  char_T source[2][MAX_PATH];          /* base and step harness */
+  char_T log[2][MAX_PATH];
+  char_T *argv[2][MAX_OPTIONS + 8];
+} Requirement;
+
+static volatile int_T stop;
+static Requirement req[FSM_12B_VERIFY_MAX_BRANCHES];
+static fsm_12B_Domain domain;
+
+static void on_signal(int sig)
+{
+  (void)sig;
+  stop = 1;
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: unroll [-k max] [-g] [-d explore|model] [-i] "
+          "[-j jobs] [-t seconds] [-m MiB] [-e esbmc] [-o outdir] [-r list] "
+          "harness [-- esbmc options]\n");
+}
+
+/* Write the base (kind 0) or step harness of r for k ticks */
+static int_T generate(Requirement *r, int_T kind, int_T k, const
+                      fsm_12B_Domain *dom, const char_T *outdir)
+{
+  static const char_T *const kind_name[2] = { "base", "step" };
+
+  const char_T *name;
+  FILE *fp;
+  int_T rc;
+  (void)snprintf(r->source[kind], sizeof(r->source[kind]), "%s/req_%d_%s_%d.c",
+                 outdir, r->req.value, kind_name[kind], k);
+  (void)snprintf(r->log[kind], sizeof(r->log[kind]), "%s/req_%d_%s_%d.log",
+                 outdir, r->req.value, kind_name[kind], k);
+  fp = fopen(r->source[kind], "w");
+  if (fp == NULL) {
+    fprintf(stderr, "unroll: cannot write %s\n", r->source[kind]);
+    return -1;
+  }
+
+  name = strrchr(r->source[kind], '/');
+  rc = fsm_12B_unroll_write(fp, &r->req, (fsm_12B_UnrollKind)kind, k, dom,
+    (name != NULL) ? name + 1 : r->source[kind]);
+  if ((fclose(fp) != 0) || (rc != 0)) {
+    fprintf(stderr, "unroll: cannot write %s\n", r->source[kind]);
+    return -1;
+  }
+
+  return 0;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  static fsm_12B_Harness h;
+  static fsm_12B_VerifyJob jobs[2 * FSM_12B_VERIFY_MAX_BRANCHES];
+  const char_T *esbmc = "esbmc";
+  const char_T *outdir = "unroll.out";
+  const char_T *list = NULL;
+  const char_T *harness = NULL;
+  const char_T *source = NULL;
+  const fsm_12B_Domain *dom = NULL;
+  const char_T *options[MAX_OPTIONS];
+  char_T modeldir[MAX_PATH];
+  char_T model_c[MAX_PATH + 16];
+  char_T include[MAX_PATH + 2];
+  int_T noptions = 0;
+  int_T kmax = 8;
+  boolean_T generate_only = false;
+  int_T parallel = 0;
+  real_T timeout = 0.0;
+  uint64_T mem_mib = 0U;
+  int_T nreq = 0;
+  int_T count[4] = { 0, 0, 0, 0 };
+  char_T *text;
+  size_t len;
+  char_T *slash;
+  int_T k;
+  int_T i;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (strcmp(opt, "--") == 0) {
+      for (i++; (i < argc) && (noptions < MAX_OPTIONS); i++) {
+        options[noptions++] = argv[i];
+      }
+
+      break;
+    }
+
+    if (opt[0] != '-') {
+      if (harness != NULL) {
+        usage();
+        return 2;
+      }
+
+      harness = opt;
+      continue;
+    }
+
+    if (strcmp(opt, "-g") == 0) {
+      generate_only = true;
+      continue;
+    }
+
+    if (strcmp(opt, "-i") == 0) {
+      domain.integer = true;
+      continue;
+    }
+
+    if (strcmp(opt, "-k") == 0) {
+      kmax = atoi(val);
+    } else if (strcmp(opt, "-j") == 0) {
+      parallel = atoi(val);
+    } else if (strcmp(opt, "-t") == 0) {
+      timeout = atof(val);
+    } else if (strcmp(opt, "-m") == 0) {
+      mem_mib = strtoull(val, NULL, 0);
+    } else if (strcmp(opt, "-e") == 0) {
+      esbmc = val;
+    } else if (strcmp(opt, "-o") == 0) {
+      outdir = val;
+    } else if (strcmp(opt, "-r") == 0) {
+      list = val;
+    } else if (strcmp(opt, "-d") == 0) {
+      source = val;
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if ((harness == NULL) || (kmax < 1)) {
+    usage();
+    return 2;
+  }
+
+  if (parallel <= 0) {
+    parallel = (int_T)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  text = fsm_12B_slurp(harness, &len);
+  if (text == NULL) {
+    fprintf(stderr, "unroll: cannot read %s\n", harness);
+    return 2;
+  }
+
+  if (fsm_12B_verify_split(&h, text, len, "sit") <= 0) {
+    fprintf(stderr, "unroll: no \"if (sit == k) { ... }\" chain in %s\n",
+            harness);
+    return 2;
+  }
+
+  for (i = 0; i < h.nbranches; i++) {
+    if (!fsm_12B_selected(list, h.branch[i].value)) {
+      continue;
+    }
+
+    if (fsm_12B_unroll_parse(&h, i, &req[nreq].req) != 0) {
+      fprintf(stderr, "unroll: cannot read requirement %d of %s\n",
+              h.branch[i].value, harness);
+      return 2;
+    }
+
+    nreq++;
+  }
+
+  (void)snprintf(modeldir, sizeof(modeldir), "%s", harness);
+  slash = strrchr(modeldir, '/');
+  if (slash != NULL) {
+    *slash = '\0';
+  } else {
+    (void)snprintf(modeldir, sizeof(modeldir), ".");
+  }
+
+  (void)snprintf(model_c, sizeof(model_c), "%s/fsm_12B.c", modeldir);
+  (void)snprintf(include, sizeof(include), "-I%s", modeldir);
+  if ((source != NULL) && (strcmp(source, "explore") == 0)) {
+    const boolean_T integer = domain.integer;
+    if (fsm_12B_domain_explore(&domain) != 0) {
+      fprintf(stderr, "unroll: state space exceeds the explorer\n");
+      return 2;
+    }
+
+    domain.integer = integer;
+    dom = &domain;
+  } else if ((source != NULL) && (strcmp(source, "model") == 0)) {
+    const boolean_T integer = domain.integer;
+    char_T *model = fsm_12B_slurp(model_c, &len);
+    if (model == NULL) {
+      fprintf(stderr, "unroll: cannot read %s\n", model_c);
+      return 2;
+    }
+
+    fsm_12B_domain_model(&domain, model, len);
+    free(model);
+    domain.integer = integer;
+    dom = &domain;
+  } else if (source != NULL) {
+    usage();
+    return 2;
+  }
+
+  (void)mkdir(outdir, 0755);
+  if (generate_only) {
+    for (i = 0; i < nreq; i++) {
+      for (k = 1; k <= kmax; k++) {
+        if ((generate(&req[i], 0, k, dom, outdir) != 0) || (generate(&req[i], 1,
+              k, dom, outdir) != 0)) {
+          return 2;
+        }
+      }
+    }
+
+    printf("%d requirements, k = 1..%d: %d harnesses in %s\n", nreq, kmax, 2 *
+           nreq * kmax, outdir);
+    return 0;
+  }
+
+  (void)signal(SIGINT, on_signal);
+  (void)signal(SIGTERM, on_signal);
+  for (k = 1; (k <= kmax) && !stop; k++) {
+    int_T njobs = 0;
+    for (i = 0; i < nreq; i++) {
+      Requirement *r = &req[i];
+      int_T kind;
+      if (r->status != OPEN) {
+        continue;
+      }
+
+      for (kind = 0; kind < 2; kind++) {
+        int_T a;
+        if (generate(r, kind, k, dom, outdir) != 0) {
+          return 2;
+        }
+
+        r->argv[kind][0] = (char_T *)esbmc;
+        r->argv[kind][1] = r->source[kind];
+        r->argv[kind][2] = model_c;
+        r->argv[kind][3] = include;
+        for (a = 0; a < noptions; a++) {
+          r->argv[kind][4 + a] = (char_T *)options[a];
+        }
+
+        r->argv[kind][4 + noptions] = NULL;
+        jobs[njobs].argv = r->argv[kind];
+        jobs[njobs].log = r->log[kind];
+        njobs++;
+      }
+    }
+
+    if (njobs == 0) {
+      break;
+    }
+
+    printf("k = %d: %d harnesses\n", k, njobs);
+    (void)fflush(stdout);
+    fsm_12B_verify_run(jobs, njobs, parallel, timeout, mem_mib, &stop);
+    njobs = 0;
+    for (i = 0; i < nreq; i++) {
+      Requirement *r = &req[i];
+      fsm_12B_VerifyVerdict base;
+      fsm_12B_VerifyVerdict step;
+      if (r->status != OPEN) {
+        continue;
+      }
+
+      base = jobs[njobs].verdict;
+      step = jobs[njobs + 1].verdict;
+      njobs += 2;
+      r->k = k;
+      if (base == FSM_12B_VERIFY_FAIL) {
+        r->status = VIOLATED;
+        r->last = base;
+      } else if (base != FSM_12B_VERIFY_PASS) {
+        r->status = INCONCLUSIVE;
+        r->last = base;
+      } else if (step == FSM_12B_VERIFY_PASS) {
+        r->status = PROVED;
+        r->last = step;
+      } else if (step != FSM_12B_VERIFY_FAIL) {
+        r->status = INCONCLUSIVE;
+        r->last = step;
+      }
+    }
+  }
+
+  printf("  req  result        k  log\n");
+  for (i = 0; i < nreq; i++) {
+    Requirement *r = &req[i];
+    const char_T *log = (r->status == PROVED) ? r->log[1] : r->log[0];
+    if ((r->status == INCONCLUSIVE) && (r->last != FSM_12B_VERIFY_NONE)) {
+      printf("  %3d  %-12s %2d  %s (%s)\n", r->req.value,
+             status_name[r->status], r->k, fsm_12B_verify_verdict_name[r->last],
+             log);
+    } else if (r->status == OPEN) {
+      printf("  %3d  %-12s %2d  step case fails up to k = %d\n", r->req.value,
+             status_name[r->status], r->k, r->k);
+    } else {
+      printf("  %3d  %-12s %2d  %s\n", r->req.value, status_name[r->status],
+             r->k, log);
+    }
+
+    count[r->status]++;
+    fsm_12B_unroll_free(&r->req);
+  }
+
+  free(text);
+  printf("%d proved, %d violated, %d open, %d inconclusive\n", count[PROVED],
+         count[VIOLATED], count[OPEN], count[INCONCLUSIVE]);
+  if (count[VIOLATED] != 0) {
+    return 1;
+  }
+
+  return (count[PROVED] != nreq) ? 3 : 0;
+}
+
+/*
+ * File trailer for unroll_main.c
+ *
+ * [EOF]
+ */
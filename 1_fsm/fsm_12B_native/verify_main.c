@@ -0,0 +1,442 @@
+/*
+ * File: verify_main.c
+ *
+ * Verifies the requirements of an fsm_12B harness one per ESBMC process,
+ * in parallel, and writes one report.
+ *
+ *   verify [-j jobs] [-t seconds] [-m MiB] [-e esbmc] [-c cachedir]
+ *          [-d db] [-o outdir] [-r list] [-v var] harness
+ *          [-- esbmc options]
+ *
+ * The model is taken from the directory of the harness.  Branch k of the
+ * "if (var == k)" chain (var defaults to sit) becomes outdir/req_k.c, and
+ * its verifier output goes to outdir/req_k.log.  -r selects requirements,
+ * e.g. 1,3,7-9.  Defaults: one job per core, no timeout or memory cap,
+ * esbmc from PATH, cache in outdir/cache, outdir verify.out.
+ *
+ * A verdict is cached under the SHA-256 of fsm_12B.c, fsm_12B.h,
+ * rtwtypes.h, the branch harness, the verifier options and the output of
+ * "esbmc --version"; only PASS and FAIL are cached.
+ *
+ * -d records every run in the SQLite store db (fsm_12B_store.h) and takes
+ * the verdict of a requirement from there when the model has not changed
+ * within its cone of influence since its last PASS or FAIL.
+ *
+ * Exit status: 0 all passed, 1 some failed, 2 usage or setup error,
+ * 3 some inconclusive and none failed.
+ */
+
+#define _POSIX_C_SOURCE                200809L
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "fsm_12B_sha256.h"
+#include "fsm_12B_store.h"
+#include "fsm_12B_util.h"
+#include "fsm_12B_verify.h"
+#include "rtwtypes.h"
+
+#define MAX_OPTIONS                    64
+#define MAX_PATH                       4096
+
+typedef struct {
+  int_T value;
+  char_T source[MAX_PATH];
+  char_T log[MAX_PATH];
+  char_T key[FSM_12B_SHA256_HEX];
+  boolean_T cached;
+  char_T hash[FSM_12B_SHA256_HEX];     /* of the branch harness */
+  fsm_12B_StoreCone cone;
+  boolean_T has_cone;
+  fsm_12B_StoreCheck stored;
+  boolean_T from_store;                /* verdict of stored.run */
+  char_T name[16];
+  int_T job;                           /* index into jobs, or -1 */
+  char_T *argv[MAX_OPTIONS + 8];
+  fsm_12B_VerifyJob result;
+} Requirement;
+
+static volatile int_T stop;
+static Requirement req[FSM_12B_VERIFY_MAX_BRANCHES];
+static fsm_12B_Store store;
+static fsm_12B_StoreModel current;
+
+static void on_signal(int sig)
+{
+  (void)sig;
+  stop = 1;
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: verify [-j jobs] [-t seconds] [-m MiB] [-e esbmc] "
+          "[-c cachedir] [-d db] [-o outdir] [-r list] [-v var] harness "
+          "[-- esbmc options]\n");
+}
+
+/* Print text indented, as fsm_12B_verify_copy_trace does */
+static void print_trace(FILE *out, const char_T *text)
+{
+  while ((text != NULL) && (*text != '\0')) {
+    const size_t n = strcspn(text, "\n");
+    fprintf(out, "  %.*s\n", (int)n, text);
+    text += (text[n] == '\n') ? n + 1U : n;
+  }
+}
+
+/* r as a run of the store, with verdict and times still to be filled in */
+static void describe(fsm_12B_StoreRun *run, const Requirement *r, const
+                     char_T *harness, const char_T *version, const char_T
+                     *options)
+{
+  memset(run, 0, sizeof(fsm_12B_StoreRun));
+  run->harness = harness;
+  run->requirement = r->name;
+  run->harness_hash = r->hash;
+  run->model_hash = current.hash;
+  run->cone = &r->cone;
+  run->tool_version = version;
+  run->options = options;
+}
+
+int_T main(int_T argc, const char *argv[])
+{
+  static fsm_12B_Harness h;
+  static fsm_12B_VerifyJob jobs[FSM_12B_VERIFY_MAX_BRANCHES];
+  static const char_T *const model_file[3] = { "fsm_12B.c", "fsm_12B.h",
+    "rtwtypes.h" };
+
+  const char_T *esbmc = "esbmc";
+  const char_T *outdir = "verify.out";
+  const char_T *cachedir = NULL;
+  const char_T *db = NULL;
+  const char_T *list = NULL;
+  const char_T *var = "sit";
+  const char_T *harness = NULL;
+  const char_T *options[MAX_OPTIONS];
+  char_T cache_default[MAX_PATH];
+  char_T modeldir[MAX_PATH];
+  char_T model_c[MAX_PATH + 16];
+  char_T include[MAX_PATH + 2];
+  char_T version[256];
+  char_T joined[MAX_PATH];
+  char_T path[MAX_PATH + 32];
+  uint8_T digest[FSM_12B_SHA256_BYTES];
+  fsm_12B_Sha256 model;
+  int_T noptions = 0;
+  int_T parallel = 0;
+  real_T timeout = 0.0;
+  uint64_T mem_mib = 0U;
+  int_T nreq = 0;
+  int_T njobs = 0;
+  int_T count[FSM_12B_VERIFY_VERDICTS];
+  char_T *text;
+  size_t len;
+  char_T *slash;
+  FILE *report;
+  int_T i;
+  int_T k;
+  for (i = 1; i < argc; i++) {
+    const char *opt = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : "";
+    if (strcmp(opt, "--") == 0) {
+      for (i++; (i < argc) && (noptions < MAX_OPTIONS); i++) {
+        options[noptions++] = argv[i];
+      }
+
+      break;
+    }
+
+    if (opt[0] != '-') {
+      if (harness != NULL) {
+        usage();
+        return 2;
+      }
+
+      harness = opt;
+      continue;
+    }
+
+    if (strcmp(opt, "-j") == 0) {
+      parallel = atoi(val);
+    } else if (strcmp(opt, "-t") == 0) {
+      timeout = atof(val);
+    } else if (strcmp(opt, "-m") == 0) {
+      mem_mib = strtoull(val, NULL, 0);
+    } else if (strcmp(opt, "-e") == 0) {
+      esbmc = val;
+    } else if (strcmp(opt, "-c") == 0) {
+      cachedir = val;
+    } else if (strcmp(opt, "-d") == 0) {
+      db = val;
+    } else if (strcmp(opt, "-o") == 0) {
+      outdir = val;
+    } else if (strcmp(opt, "-r") == 0) {
+      list = val;
+    } else if (strcmp(opt, "-v") == 0) {
+      var = val;
+    } else {
+      usage();
+      return 2;
+    }
+
+    i++;
+  }
+
+  if (harness == NULL) {
+    usage();
+    return 2;
+  }
+
+  if (parallel <= 0) {
+    parallel = (int_T)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  if (cachedir == NULL) {
+    (void)snprintf(cache_default, sizeof(cache_default), "%s/cache", outdir);
+    cachedir = cache_default;
+  }
+
+  text = fsm_12B_slurp(harness, &len);
+  if (text == NULL) {
+    fprintf(stderr, "verify: cannot read %s\n", harness);
+    return 2;
+  }
+
+  if (fsm_12B_verify_split(&h, text, len, var) <= 0) {
+    fprintf(stderr, "verify: no \"if (%s == k) { ... }\" chain in %s\n", var,
+            harness);
+    return 2;
+  }
+
+  (void)snprintf(modeldir, sizeof(modeldir), "%s", harness);
+  slash = strrchr(modeldir, '/');
+  if (slash != NULL) {
+    *slash = '\0';
+  } else {
+    (void)snprintf(modeldir, sizeof(modeldir), ".");
+  }
+
+  /* Everything but the branch harness is common to all keys */
+  fsm_12B_sha256_init(&model);
+  for (i = 0; i < 3; i++) {
+    char_T *src;
+    (void)snprintf(path, sizeof(path), "%s/%s", modeldir, model_file[i]);
+    src = fsm_12B_slurp(path, &len);
+    if (src == NULL) {
+      fprintf(stderr, "verify: cannot read %s\n", path);
+      return 2;
+    }
+
+    fsm_12B_sha256_field(&model, src, len);
+    free(src);
+  }
+
+  fsm_12B_verify_tool_version(esbmc, version, sizeof(version));
+  fsm_12B_sha256_field(&model, version, strlen(version));
+  joined[0] = '\0';
+  for (i = 0; i < noptions; i++) {
+    const size_t used = strlen(joined);
+    fsm_12B_sha256_field(&model, options[i], strlen(options[i]));
+    (void)snprintf(&joined[used], sizeof(joined) - used, "%s%s", (i > 0) ? " "
+                   : "", options[i]);
+  }
+
+  if ((db != NULL) && ((fsm_12B_store_open(&store, db) != 0) ||
+                       (fsm_12B_store_load(&current, modeldir) != 0) ||
+                       (fsm_12B_store_add_model(&store, &current) != 0))) {
+    fprintf(stderr, "verify: %s: %s\n", db, (store.error[0] != '\0') ?
+            store.error : "cannot read the model");
+    return 2;
+  }
+
+  (void)mkdir(outdir, 0755);
+  (void)snprintf(model_c, sizeof(model_c), "%s/fsm_12B.c", modeldir);
+  (void)snprintf(include, sizeof(include), "-I%s", modeldir);
+  for (i = 0; i < h.nbranches; i++) {
+    Requirement *r;
+    fsm_12B_Sha256 c = model;
+    char_T *branch;
+    FILE *fp;
+    if (!fsm_12B_selected(list, h.branch[i].value)) {
+      continue;
+    }
+
+    r = &req[nreq++];
+    r->value = h.branch[i].value;
+    r->job = -1;
+    (void)snprintf(r->name, sizeof(r->name), "%d", r->value);
+    (void)snprintf(r->source, sizeof(r->source), "%s/req_%d.c", outdir,
+                   r->value);
+    branch = fsm_12B_verify_harness(&h, i, &len);
+    fp = (branch != NULL) ? fopen(r->source, "wb") : NULL;
+    if ((fp == NULL) || (fwrite(branch, 1, len, fp) != len)) {
+      fprintf(stderr, "verify: cannot write %s\n", r->source);
+      return 2;
+    }
+
+    (void)fclose(fp);
+    fsm_12B_sha256_field(&c, branch, len);
+    fsm_12B_sha256_final(&c, digest);
+    fsm_12B_sha256_hex(digest, r->key);
+    if (db != NULL) {
+      fsm_12B_sha256_init(&c);
+      fsm_12B_sha256_field(&c, branch, len);
+      fsm_12B_sha256_final(&c, digest);
+      fsm_12B_sha256_hex(digest, r->hash);
+      r->has_cone = (fsm_12B_store_cone(&current, branch, len, false,
+        &r->cone) == 0);
+      if (!r->has_cone) {
+        fprintf(stderr, "verify: requirement %d asserts nothing of the model; "
+                "it is not recorded in %s\n", r->value, db);
+      }
+    }
+
+    free(branch);
+    if (fsm_12B_verify_cache_get(cachedir, r->key, &r->result.verdict,
+         &r->result.seconds, r->log, sizeof(r->log)) == 0) {
+      r->cached = true;
+      continue;
+    }
+
+    /* Unchanged within its cone since its last verdict */
+    if (r->has_cone) {
+      fsm_12B_StoreRun run;
+      describe(&run, r, harness, version, joined);
+      if ((fsm_12B_store_check(&store, &current, &run, &r->stored) == 0) &&
+          ((r->stored.status == FSM_12B_STORE_CURRENT) || (r->stored.status ==
+            FSM_12B_STORE_UNAFFECTED))) {
+        r->cached = true;
+        r->from_store = true;
+        r->result.verdict = r->stored.verdict;
+        r->result.seconds = r->stored.seconds;
+        (void)snprintf(r->log, sizeof(r->log), "%s run %lld", db, (long long)
+                       r->stored.run);
+        continue;
+      }
+    }
+
+    (void)snprintf(r->log, sizeof(r->log), "%s/req_%d.log", outdir, r->value);
+    r->argv[0] = (char_T *)esbmc;
+    r->argv[1] = r->source;
+    r->argv[2] = model_c;
+    r->argv[3] = include;
+    for (k = 0; k < noptions; k++) {
+      r->argv[4 + k] = (char_T *)options[k];
+    }
+
+    r->argv[4 + noptions] = NULL;
+    jobs[njobs].argv = r->argv;
+    jobs[njobs].log = r->log;
+    r->job = njobs++;
+  }
+
+  free(text);
+  if (nreq == 0) {
+    fprintf(stderr, "verify: no requirement selected\n");
+    return 2;
+  }
+
+  (void)signal(SIGINT, on_signal);
+  (void)signal(SIGTERM, on_signal);
+  printf("%s: %d requirements, %d cached, %d to run on %d jobs\n", harness,
+         nreq, nreq - njobs, njobs, parallel);
+  (void)fflush(stdout);
+  fsm_12B_verify_run(jobs, njobs, parallel, timeout, mem_mib, &stop);
+
+  /* Report */
+  (void)snprintf(path, sizeof(path), "%s/report.txt", outdir);
+  report = fopen(path, "w");
+  if (report == NULL) {
+    fprintf(stderr, "verify: cannot write %s\n", path);
+    return 2;
+  }
+
+  memset(count, 0, sizeof(count));
+  fprintf(report, "harness  %s\nmodel    %s\nverifier %s\n\n", harness,
+          modeldir, version);
+  for (k = 0; k < 2; k++) {
+    FILE *out = (k == 0) ? stdout : report;
+    fprintf(out, "  req  verdict   seconds  peak MiB  log\n");
+    for (i = 0; i < nreq; i++) {
+      Requirement *r = &req[i];
+      if (r->job >= 0) {
+        r->result = jobs[r->job];
+      }
+
+      if (r->cached) {
+        fprintf(out, "  %3d  %-8s %8.2f  %8s  %s (%s)\n", r->value,
+                fsm_12B_verify_verdict_name[r->result.verdict],
+                r->result.seconds, "-", r->log, !r->from_store ? "cached" :
+                (r->stored.status == FSM_12B_STORE_CURRENT) ? "stored" :
+                "unaffected");
+      } else {
+        fprintf(out, "  %3d  %-8s %8.2f  %8.1f  %s\n", r->value,
+                fsm_12B_verify_verdict_name[r->result.verdict],
+                r->result.seconds, (real_T)r->result.peak_kib / 1024.0, r->log);
+      }
+    }
+  }
+
+  for (i = 0; i < nreq; i++) {
+    Requirement *r = &req[i];
+    count[r->result.verdict]++;
+    if (r->result.verdict == FSM_12B_VERIFY_FAIL) {
+      fprintf(report, "\nRequirement %d: counterexample\n", r->value);
+      if (r->from_store) {
+        char_T *trace = fsm_12B_store_counterexample(&store, r->stored.run);
+        print_trace(report, (trace != NULL) ? trace : "(not recorded)");
+        free(trace);
+      } else {
+        fsm_12B_verify_copy_trace(report, r->log);
+      }
+    }
+
+    if ((db != NULL) && r->has_cone && !r->cached && (r->result.verdict !=
+         FSM_12B_VERIFY_NONE)) {
+      fsm_12B_StoreRun run;
+      char_T *trace = (r->result.verdict == FSM_12B_VERIFY_FAIL) ?
+        fsm_12B_store_trace(r->log) : NULL;
+      describe(&run, r, harness, version, joined);
+      run.verdict = r->result.verdict;
+      run.seconds = r->result.seconds;
+      run.peak_kib = r->result.peak_kib;
+      run.counterexample = trace;
+      if (fsm_12B_store_add_run(&store, &run) != 0) {
+        fprintf(stderr, "verify: cannot record requirement %d in %s: %s\n",
+                r->value, db, store.error);
+      }
+
+      free(trace);
+    }
+
+    if (!r->cached && ((r->result.verdict == FSM_12B_VERIFY_PASS) ||
+                       (r->result.verdict == FSM_12B_VERIFY_FAIL)) &&
+        (fsm_12B_verify_cache_put(cachedir, r->key, r->result.verdict,
+          r->result.seconds, r->log) != 0)) {
+      fprintf(stderr, "verify: cannot cache requirement %d in %s\n", r->value,
+              cachedir);
+    }
+  }
+
+  (void)fclose(report);
+  fsm_12B_store_close(&store);
+  fsm_12B_store_unload(&current);
+  printf("%d passed, %d failed, %d inconclusive; report in %s\n",
+         count[FSM_12B_VERIFY_PASS], count[FSM_12B_VERIFY_FAIL], nreq -
+         count[FSM_12B_VERIFY_PASS] - count[FSM_12B_VERIFY_FAIL], path);
+  if (count[FSM_12B_VERIFY_FAIL] != 0) {
+    return 1;
+  }
+
+  return (count[FSM_12B_VERIFY_PASS] != nreq) ? 3 : 0;
+}
+
+/*
+ * File trailer for verify_main.c
+ *
+ * [EOF]
+ */